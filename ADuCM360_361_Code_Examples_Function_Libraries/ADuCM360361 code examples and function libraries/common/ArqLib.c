@@ -0,0 +1,233 @@
+/**
+ *****************************************************************************
+   @addtogroup arq
+   @{
+   @file     ArqLib.c
+   @brief    Set of sliding window ARQ functions for a COBS framed link.
+   - Initialise a link with ArqInit().
+   - Queue payloads with ArqSend(), pass received frames to ArqRx().
+   - Call ArqTick() from a periodic timer interrupt and ArqPoll() from the
+     main loop.
+
+   @version  V0.1
+   @author   ADI
+   @date     October 2026
+   @par Revision History:
+   - V0.1, October 2026: initial version.
+
+   @note
+      Go-back-N: up to ARQ_WIN data frames are sent before the first is
+      acknowledged. The receiver only accepts the frame it expects next and
+      answers every data frame with a cumulative ACK carrying the next
+      sequence number it wants. If the window does not move for iTimeout
+      ticks all frames still outstanding are resent.
+      Each frame is sent as a COBS frame with CRC (see CobsLib), so frames
+      that arrive damaged are dropped by the decoder and recovered by the
+      timeout.
+      All functions except ArqTick() are called from the main loop, so no
+      frame is written to the UART from an interrupt.
+
+All files for ADuCM360 provided by ADI, including this file, are
+provided  as is without warranty of any kind, either expressed or implied.
+The user assumes any and all risk from the use of this code.
+It is the responsibility of the person integrating this code into an application
+to ensure that the resulting application performs as required and is safe.
+
+**/
+
+#include "ArqLib.h"
+
+static void ArqWrFrame(ArqLink *pLink, int iType, int iSeq, const unsigned char *pucData, int iLen);
+
+/**
+	@brief static void ArqWrFrame(ArqLink *pLink, int iType, int iSeq, const unsigned char *pucData, int iLen)
+			==========Sends one frame: type, sequence number and payload.
+**/
+
+static void ArqWrFrame(ArqLink *pLink, int iType, int iSeq, const unsigned char *pucData, int iLen)
+	{
+	unsigned char aucHdr[2];
+
+	aucHdr[0] = iType;
+	aucHdr[1] = iSeq;
+	CobsEncStart(&pLink->Enc, pLink->pfWr);
+	CobsEncPut(&pLink->Enc, aucHdr, 2);
+	CobsEncPut(&pLink->Enc, pucData, iLen);
+	CobsEncEnd(&pLink->Enc);
+	}
+
+/**
+	@brief int ArqInit(ArqLink *pLink, void (*pfWr)(const unsigned char *pucData, int iLen), void (*pfRx)(const unsigned char *pucData, int iLen), int iTimeout)
+			==========Initialises a link.
+	@param pLink :{}	\n
+		Link state.
+	@param pfWr :{}	\n
+		Function that sends encoded bytes, as for CobsEncStart().
+	@param pfRx :{0,}	\n
+		Function called by ArqRx() with each payload received in order, or 0
+		for a link that only sends.
+	@param iTimeout :{1-}	\n
+		ArqTick() calls without progress before the window is resent. Must
+		be longer than one frame there and its ACK back at the baud rate used.
+	@return 1.
+**/
+
+int ArqInit(ArqLink *pLink, void (*pfWr)(const unsigned char *pucData, int iLen),
+	void (*pfRx)(const unsigned char *pucData, int iLen), int iTimeout)
+	{
+	pLink->ucBase = 0;
+	pLink->ucNext = 0;
+	pLink->ucExp = 0;
+	pLink->iAckDue = 0;
+	pLink->iTmr = 0;
+	pLink->iTimeout = iTimeout;
+	pLink->pfWr = pfWr;
+	pLink->pfRx = pfRx;
+	pLink->uiTx = 0;
+	pLink->uiRetx = 0;
+	pLink->uiDup = 0;
+	return 1;
+	}
+
+/**
+	@brief int ArqSend(ArqLink *pLink, const unsigned char *pucData, int iLen)
+			==========Sends a payload if the window has room.
+	@param pLink :{}	\n
+		Link from ArqInit().
+	@param pucData :{}	\n
+		Payload, copied so it is not needed after the call returns.
+	@param iLen :{0-ARQ_MAX}	\n
+		Number of bytes in pucData.
+	@return 1 if the payload was sent or 0 if the window is full or iLen is too long.
+**/
+
+int ArqSend(ArqLink *pLink, const unsigned char *pucData, int iLen)
+	{
+	unsigned char *pucSlot;
+	int i1;
+
+	if((ArqFree(pLink) == 0) || (iLen > ARQ_MAX))
+		return 0;
+	pucSlot = pLink->aaucTx[pLink->ucNext % ARQ_WIN];
+	for(i1=0; i1<iLen; i1++)
+		pucSlot[i1] = pucData[i1];
+	pLink->aiTxLen[pLink->ucNext % ARQ_WIN] = iLen;
+	if(pLink->ucBase == pLink->ucNext)
+		pLink->iTmr = 0;						// Window was empty, time from now
+	ArqWrFrame(pLink, ARQ_DATA, pLink->ucNext, pucSlot, iLen);
+	pLink->ucNext++;
+	pLink->uiTx++;
+	return 1;
+	}
+
+/**
+	@brief int ArqRx(ArqLink *pLink, const unsigned char *pucFrame, int iLen)
+			==========Handles a frame from the peer.
+	@param pLink :{}	\n
+		Link from ArqInit().
+	@param pucFrame :{}	\n
+		Payload returned by CobsDecPut(), type and sequence number first.
+	@param iLen :{2-}	\n
+		Length returned by CobsDecPut().
+	@return 1 if a new payload was delivered, 0 otherwise.
+	@note
+		- The ACK for a data frame is sent by the next ArqPoll().
+**/
+
+int ArqRx(ArqLink *pLink, const unsigned char *pucFrame, int iLen)
+	{
+	unsigned char ucSeq;
+
+	if(iLen < 2)
+		return 0;
+	ucSeq = pucFrame[1];
+	if(pucFrame[0] == ARQ_ACK)
+		{
+		// Accept ACKs from just past ucBase up to ucNext, ignore stale ones
+		if((ucSeq != pLink->ucBase) &&
+			((unsigned char)(ucSeq - pLink->ucBase) <= (unsigned char)(pLink->ucNext - pLink->ucBase)))
+			{
+			pLink->ucBase = ucSeq;
+			pLink->iTmr = 0;
+			}
+		return 0;
+		}
+	if(pucFrame[0] != ARQ_DATA)
+		return 0;
+	pLink->iAckDue = 1;							// Answer duplicates too, their ACK may have been lost
+	if(ucSeq != pLink->ucExp)
+		{
+		pLink->uiDup++;
+		return 0;
+		}
+	pLink->ucExp++;
+	if(pLink->pfRx)
+		pLink->pfRx(pucFrame+2, iLen-2);
+	return 1;
+	}
+
+/**
+	@brief int ArqTick(ArqLink *pLink)
+			==========Advances the retransmit timer.
+	@param pLink :{}	\n
+		Link from ArqInit().
+	@return 1.
+	@note
+		- Call from a periodic timer interrupt, for example GP_Tmr0_Int_Handler()
+		with the timer set up by GptLd() and GptCfg().
+**/
+
+int ArqTick(ArqLink *pLink)
+	{
+	pLink->iTmr++;
+	return 1;
+	}
+
+/**
+	@brief int ArqPoll(ArqLink *pLink)
+			==========Sends a pending ACK and resends the window on timeout.
+	@param pLink :{}	\n
+		Link from ArqInit().
+	@return Number of frames resent.
+	@note
+		- Call from the main loop, as often as possible.
+**/
+
+int ArqPoll(ArqLink *pLink)
+	{
+	unsigned char ucSeq;
+	int iCnt = 0;
+
+	if(pLink->iAckDue)
+		{
+		pLink->iAckDue = 0;
+		ArqWrFrame(pLink, ARQ_ACK, pLink->ucExp, 0, 0);
+		}
+	if((pLink->ucBase != pLink->ucNext) && (pLink->iTmr >= pLink->iTimeout))
+		{
+		pLink->iTmr = 0;
+		for(ucSeq=pLink->ucBase; ucSeq!=pLink->ucNext; ucSeq++)
+			{
+			ArqWrFrame(pLink, ARQ_DATA, ucSeq, pLink->aaucTx[ucSeq % ARQ_WIN],
+				pLink->aiTxLen[ucSeq % ARQ_WIN]);
+			iCnt++;
+			}
+		pLink->uiRetx += iCnt;
+		}
+	return iCnt;
+	}
+
+/**
+	@brief int ArqFree(ArqLink *pLink)
+			==========Returns the number of frames ArqSend() can take now.
+	@param pLink :{}	\n
+		Link from ArqInit().
+	@return 0 to ARQ_WIN.
+**/
+
+int ArqFree(ArqLink *pLink)
+	{
+	return ARQ_WIN - (unsigned char)(pLink->ucNext - pLink->ucBase);
+	}
+
+/**@}*/
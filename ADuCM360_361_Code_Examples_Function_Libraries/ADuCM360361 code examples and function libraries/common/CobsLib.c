@@ -0,0 +1,255 @@
+/**
+ *****************************************************************************
+   @addtogroup cobs
+   @{
+   @file     CobsLib.c
+   @brief    Set of COBS framing functions with a CRC-16 trailer.
+   - Encode a frame with CobsEncStart(), CobsEncPut() and CobsEncEnd().
+   - Decode a byte at a time with CobsDecPut() after CobsDecInit().
+   - CRC-16/CCITT with CobsCrc().
+
+   @version  V0.2
+   @author   ADI
+   @date     October 2026
+   @par Revision History:
+   - V0.1, October 2026: initial version.
+   - V0.2, October 2026: CobsDecPut() drops frames holding a byte flagged by
+     UrtBufInt() with a line error.
+
+   @note
+      A frame on the line is COBS(payload, CRC high, CRC low) followed by a
+      0x00 delimiter. COBS removes every 0x00 from the data at a cost of one
+      code byte per 254 bytes, so binary payloads of any length can be framed
+      and a receiver resynchronises at the next 0x00.
+      The CRC is CRC-16/CCITT (polynomial 0x1021, initial value 0xFFFF) sent
+      most significant byte first, so the CRC over payload and trailer is 0
+      for a good frame.
+
+All files for ADuCM360 provided by ADI, including this file, are
+provided  as is without warranty of any kind, either expressed or implied.
+The user assumes any and all risk from the use of this code.
+It is the responsibility of the person integrating this code into an application
+to ensure that the resulting application performs as required and is safe.
+
+**/
+
+#include "CobsLib.h"
+
+// CRC-16/CCITT of each nibble value, 16 entries keep the table in 32 bytes
+static const unsigned short usCobsCrcTbl[16] = {
+	0x0000,0x1021,0x2042,0x3063,0x4084,0x50A5,0x60C6,0x70E7,
+	0x8108,0x9129,0xA14A,0xB16B,0xC18C,0xD1AD,0xE1CE,0xF1EF};
+
+static void CobsEncByte(CobsEnc *pEnc, int iByte);
+
+/**
+	@brief unsigned short CobsCrc(unsigned short usCrc, const unsigned char *pucData, int iLen)
+			==========Adds bytes to a CRC-16/CCITT.
+	@param usCrc :{0xFFFF,}	\n
+		0xFFFF to start or the value returned by the previous call.
+	@param pucData :{}	\n
+		Bytes to add.
+	@param iLen :{0-}	\n
+		Number of bytes in pucData.
+	@return Updated CRC.
+**/
+
+unsigned short CobsCrc(unsigned short usCrc, const unsigned char *pucData, int iLen)
+	{
+	int i1;
+
+	for(i1=0; i1<iLen; i1++)
+		{
+		usCrc = (usCrc<<4) ^ usCobsCrcTbl[(usCrc>>12) ^ (pucData[i1]>>4)];
+		usCrc = (usCrc<<4) ^ usCobsCrcTbl[(usCrc>>12) ^ (pucData[i1]&0xF)];
+		}
+	return usCrc;
+	}
+
+/**
+	@brief static void CobsEncByte(CobsEnc *pEnc, int iByte)
+			==========Adds one byte to the current block, sending the block when it ends.
+**/
+
+static void CobsEncByte(CobsEnc *pEnc, int iByte)
+	{
+	if(iByte == 0)								// Zero ends the block, the code carries it
+		{
+		pEnc->aucBlk[0] = pEnc->iCnt;
+		pEnc->pfWr(pEnc->aucBlk, pEnc->iCnt);
+		pEnc->iCnt = 1;
+		return;
+		}
+	pEnc->aucBlk[pEnc->iCnt++] = iByte;
+	if(pEnc->iCnt == COBS_BLK+1)				// Longest block, no zero implied
+		{
+		pEnc->aucBlk[0] = 0xFF;
+		pEnc->pfWr(pEnc->aucBlk, COBS_BLK+1);
+		pEnc->iCnt = 1;
+		}
+	}
+
+/**
+	@brief int CobsEncStart(CobsEnc *pEnc, void (*pfWr)(const unsigned char *pucData, int iLen))
+			==========Starts encoding a frame.
+	@param pEnc :{}	\n
+		Encoder state.
+	@param pfWr :{}	\n
+		Function that sends encoded bytes. It is called with one block of up to
+		255 bytes at a time and must take all of them, for example by waiting
+		on UrtBufWr().
+	@return 1.
+**/
+
+int CobsEncStart(CobsEnc *pEnc, void (*pfWr)(const unsigned char *pucData, int iLen))
+	{
+	pEnc->iCnt = 1;
+	pEnc->usCrc = 0xFFFF;
+	pEnc->pfWr = pfWr;
+	return 1;
+	}
+
+/**
+	@brief int CobsEncPut(CobsEnc *pEnc, const unsigned char *pucData, int iLen)
+			==========Encodes part of the payload.
+	@param pEnc :{}	\n
+		Encoder state from CobsEncStart().
+	@param pucData :{}	\n
+		Payload bytes, any values.
+	@param iLen :{0-}	\n
+		Number of bytes in pucData.
+	@return 1.
+	@note
+		- May be called several times per frame, pucData is not needed after
+		the call returns.
+**/
+
+int CobsEncPut(CobsEnc *pEnc, const unsigned char *pucData, int iLen)
+	{
+	int i1;
+
+	pEnc->usCrc = CobsCrc(pEnc->usCrc, pucData, iLen);
+	for(i1=0; i1<iLen; i1++)
+		CobsEncByte(pEnc, pucData[i1]);
+	return 1;
+	}
+
+/**
+	@brief int CobsEncEnd(CobsEnc *pEnc)
+			==========Appends the CRC, sends the last block and the 0x00 delimiter.
+	@param pEnc :{}	\n
+		Encoder state from CobsEncStart().
+	@return 1.
+**/
+
+int CobsEncEnd(CobsEnc *pEnc)
+	{
+	unsigned short usCrc = pEnc->usCrc;
+	static const unsigned char ucDelim = 0;
+
+	CobsEncByte(pEnc, usCrc>>8);
+	CobsEncByte(pEnc, usCrc&0xFF);
+	pEnc->aucBlk[0] = pEnc->iCnt;				// Last block, no zero implied
+	pEnc->pfWr(pEnc->aucBlk, pEnc->iCnt);
+	pEnc->pfWr(&ucDelim, 1);
+	pEnc->iCnt = 1;
+	return 1;
+	}
+
+/**
+	@brief int CobsDecInit(CobsDec *pDec, unsigned char *pucBuf, int iSize)
+			==========Initialises a decoder.
+	@param pDec :{}	\n
+		Decoder state.
+	@param pucBuf :{}	\n
+		Frame buffer the payload is decoded into.
+	@param iSize :{3-}	\n
+		Size of pucBuf in bytes. Must hold the payload plus the 2 CRC bytes.
+	@return 1.
+**/
+
+int CobsDecInit(CobsDec *pDec, unsigned char *pucBuf, int iSize)
+	{
+	pDec->pucBuf = pucBuf;
+	pDec->iSize = iSize;
+	pDec->iLen = 0;
+	pDec->iLeft = 0;
+	pDec->iCode = 0;
+	pDec->iErr = 0;
+	pDec->usCrc = 0xFFFF;
+	return 1;
+	}
+
+/**
+	@brief int CobsDecPut(CobsDec *pDec, int iByte)
+			==========Decodes one received byte.
+	@param pDec :{}	\n
+		Decoder state from CobsDecInit().
+	@param iByte :{0-255,256-}	\n
+		Byte received. Values above 0xFF are bytes flagged with a line error
+		as passed on by UrtBufInt(), the frame holding one is dropped.
+	@return
+		- Payload length when a good frame ends. The payload is at the start
+		of the frame buffer and stays valid until the next byte is decoded.
+		- COBS_BUSY (0) while a frame is arriving. Frames with no payload and
+		runs of delimiters also return COBS_BUSY.
+		- COBS_ERR (-1) when a frame ends with a CRC, length or encoding error.
+	@note
+		- Short enough to call from UART_Int_Handler() for every byte. Bytes
+		are written to the frame buffer once, as they arrive.
+**/
+
+int CobsDecPut(CobsDec *pDec, int iByte)
+	{
+	unsigned char ucByte;
+	int iLen;
+
+	if(iByte > 0xFF)							// Parity, framing or overrun error
+		{
+		pDec->iErr = 1;
+		iByte &= 0xFF;
+		}
+	if(iByte == 0)								// Delimiter, frame ends here
+		{
+		iLen = pDec->iLen;
+		if(pDec->iCode == 0)
+			{
+			pDec->iErr = 0;
+			return COBS_BUSY;					// Idle line or repeated delimiter
+			}
+		if(pDec->iErr || pDec->iLeft || (iLen < 2) || pDec->usCrc)
+			iLen = COBS_ERR;
+		else
+			iLen -= 2;							// Drop the CRC
+		pDec->iLen = 0;
+		pDec->iLeft = 0;
+		pDec->iCode = 0;
+		pDec->iErr = 0;
+		pDec->usCrc = 0xFFFF;
+		return iLen;
+		}
+	if(pDec->iLeft == 0)						// Code byte
+		{
+		iLen = pDec->iCode;
+		pDec->iCode = iByte;
+		pDec->iLeft = iByte-1;
+		if((iLen == 0) || (iLen == 0xFF))
+			return COBS_BUSY;					// No zero ended the previous block
+		ucByte = 0;
+		}
+	else
+		{
+		ucByte = iByte;
+		pDec->iLeft--;
+		}
+	if(pDec->iLen >= pDec->iSize)
+		{
+		pDec->iErr = 1;							// Too long, wait for the delimiter
+		return COBS_BUSY;
+		}
+	pDec->pucBuf[pDec->iLen++] = ucByte;
+	pDec->usCrc = CobsCrc(pDec->usCrc, &ucByte, 1);
+	return COBS_BUSY;
+	}
+
+/**@}*/
@@ -0,0 +1,64 @@
+/**
+ *****************************************************************************
+   @file     CobsLib.h
+   @brief    Set of COBS framing functions with a CRC-16 trailer.
+   - Encode a frame with CobsEncStart(), CobsEncPut() and CobsEncEnd().
+   - Decode a byte at a time with CobsDecPut() after CobsDecInit().
+   - CRC-16/CCITT with CobsCrc().
+
+   @version  V0.2
+   @author   ADI
+   @date     October 2026
+   @par Revision History:
+   - V0.1, October 2026: initial version.
+   - V0.2, October 2026: CobsDecPut() drops frames holding a byte flagged by
+     UrtBufInt() with a line error.
+
+
+
+All files for ADuCM360 provided by ADI, including this file, are
+provided  as is without warranty of any kind, either expressed or implied.
+The user assumes any and all risk from the use of this code.
+It is the responsibility of the person integrating this code into an application
+to ensure that the resulting application performs as required and is safe.
+
+**/
+#ifndef COBSLIB_H
+#define COBSLIB_H
+
+// Longest run a COBS code byte can describe
+#define COBS_BLK	254
+
+// Encoder state. Holds one block so the code byte can be sent ahead of it.
+typedef struct
+{
+   unsigned char    aucBlk[COBS_BLK+1];   // Code byte followed by up to 254 data bytes
+   int              iCnt;                 // Bytes used in aucBlk, code byte included
+   unsigned short   usCrc;                // CRC of the payload so far
+   void           (*pfWr)(const unsigned char *pucData, int iLen);   // Output, must take all iLen bytes
+} CobsEnc;
+
+// Decoder state. Decodes straight into the frame buffer supplied.
+typedef struct
+{
+   unsigned char   *pucBuf;      // Frame buffer
+   int              iSize;       // Size of pucBuf in bytes
+   int              iLen;        // Bytes decoded, CRC included
+   int              iLeft;       // Data bytes left in the current block
+   int              iCode;       // Code byte of the current block, 0 before the first
+   int              iErr;        // 1 once the frame is known to be bad
+   unsigned short   usCrc;       // CRC over the bytes decoded
+} CobsDec;
+
+extern unsigned short CobsCrc(unsigned short usCrc, const unsigned char *pucData, int iLen);
+extern int CobsEncStart(CobsEnc *pEnc, void (*pfWr)(const unsigned char *pucData, int iLen));
+extern int CobsEncPut(CobsEnc *pEnc, const unsigned char *pucData, int iLen);
+extern int CobsEncEnd(CobsEnc *pEnc);
+extern int CobsDecInit(CobsDec *pDec, unsigned char *pucBuf, int iSize);
+extern int CobsDecPut(CobsDec *pDec, int iByte);
+
+// CobsDecPut() return values other than a frame length
+#define COBS_BUSY	0     // Frame still arriving
+#define COBS_ERR	-1    // Bad frame dropped: CRC, length or encoding error
+
+#endif
@@ -0,0 +1,392 @@
+/**
+ *****************************************************************************
+   @addtogroup fix
+   @{
+   @file     FixLib.c
+   @brief    Set of fixed-point conversion functions for ADC results.
+   - Precompute a scale with FixAdcCfg() for each gain and reference, or
+     FixScaleSet() for any ratio.
+   - Convert ADC codes to microvolts with FixMul() or a DMA buffer with
+     FixMulBlk(). Average a buffer with FixAvg().
+   - Scale one value by a ratio of two others with FixRatio(), for example
+     an RTD resistance in milliohms.
+   - Linearise with a table of equally spaced points with FixLin() or
+     FixLinBlk(), for example milliohms to millidegrees.
+   - Linearise with precomputed slopes and intercepts with FixSeg() or
+     FixSegBlk(), without a divide.
+   - Evaluate a polynomial in Horner form with FixPoly() or FixPolyBlk(),
+     for example an ITS-90 thermocouple inverse polynomial.
+
+   @version  V0.3
+   @author   ADI
+   @date     October 2026
+   @par Revision History:
+   - V0.1, October 2026: initial version.
+   - V0.2, October 2026: added FixSeg() and FixSegBlk().
+   - V0.3, October 2026: added FixPoly() and FixPolyBlk().
+
+   @note
+      The Cortex-M3 has no FPU, so each float multiply or divide is a
+      library call. FixMul() is one 32x32 to 64-bit multiply and a shift.
+      The scale keeps about 30 significant bits, so a conversion is within
+      0.5 of the output unit plus 1 part in 2^30. The hardware divide is
+      32-bit: FixAvg() and FixRatio() divide 64-bit values in software once
+      per call, FixLin() only when the interpolation overflows 32 bits.
+      FixSeg() finds the segment with a multiply by the inverse of its
+      width and interpolates with one multiply-add, a few tens of cycles.
+      Its tables hold a slope and an intercept per segment, computed on a
+      host, for example by examples/TempGen for the thermocouple and RTD.
+      FixPoly() takes one 32x32 to 64-bit multiply and a shift per order
+      on an input scaled to a fraction of 2^31. Its tables hold the
+      coefficients scaled so that no partial sum reaches 2^31.
+
+All files for ADuCM360 provided by ADI, including this file, are
+provided  as is without warranty of any kind, either expressed or implied.
+The user assumes any and all risk from the use of this code.
+It is the responsibility of the person integrating this code into an application
+to ensure that the resulting application performs as required and is safe.
+
+**/
+
+#include "FixLib.h"
+
+/**
+	@brief int FixScaleSet(FixScale *pScale, unsigned long ulNum, unsigned long ulDen, int iDenShift)
+			==========Precomputes the scale ulNum/(ulDen*2^iDenShift).
+	@param pScale :{}	\n
+		Scale to set.
+	@param ulNum :{1-0xFFFFFFFF}	\n
+		Numerator.
+	@param ulDen :{1-0xFFFFFFFF}	\n
+		Denominator.
+	@param iDenShift :{0-32}	\n
+		Extra power of two of the denominator.
+	@return 1 if successful or 0 if a parameter is out of range or the
+		ratio is 2^30 or more or below 2^-62.
+**/
+
+int FixScaleSet(FixScale *pScale, unsigned long ulNum, unsigned long ulDen, int iDenShift)
+	{
+	unsigned long long ullMul;
+	int iShift = 0;
+
+	if((ulNum == 0) || (ulDen == 0) || (iDenShift < 0) || (iDenShift > 32))
+		return 0;
+	while((iShift < 32) && ((((unsigned long long)ulNum << (iShift+1)) / ulDen) < 0x40000000))
+		iShift++;					// Largest multiplier below 2^31 after rounding
+	ullMul = (((unsigned long long)ulNum << iShift) + ulDen/2) / ulDen;
+	if((ullMul > 0x7FFFFFFF) || ((iShift + iDenShift) < 1) || ((iShift + iDenShift) > 62))
+		return 0;
+	pScale->lMul = (long)ullMul;
+	pScale->iShift = iShift + iDenShift;
+	return 1;
+	}
+
+/**
+	@brief int FixAdcCfg(FixScale *pScale, int iGain, unsigned long ulRefUv)
+			==========Precomputes the microvolts per ADC code.
+	@param pScale :{}	\n
+		Scale to set.
+	@param iGain :{ADCMDE_PGA_G1,ADCMDE_PGA_G2,ADCMDE_PGA_G4,ADCMDE_PGA_G8,
+		ADCMDE_PGA_G16,ADCMDE_PGA_G32,ADCMDE_PGA_G64,ADCMDE_PGA_G128}	\n
+		Gain as passed to AdcRng(), ADCMDE_ADCMOD2 doubles it.
+	@param ulRefUv :{FIX_REF_INT_UV, 1-0xFFFFFFFF}	\n
+		Reference in microvolts.
+	@return 1 if successful or 0 if ulRefUv is 0.
+	@note For signed integer results, ADCCON_ADCCODE_INT.
+**/
+
+int FixAdcCfg(FixScale *pScale, int iGain, unsigned long ulRefUv)
+	{
+	unsigned long ulGain = 1ul << ((iGain >> 4) & 0x7);
+
+	if(iGain & 0x8)
+		ulGain <<= 1;				// Modulator gain of 2
+	return FixScaleSet(pScale, ulRefUv, ulGain, FIX_ADC_BITS);
+	}
+
+/**
+	@brief long FixMul(const FixScale *pScale, long lIn)
+			==========Scales one value.
+	@param pScale :{}	\n
+		Scale from FixScaleSet() or FixAdcCfg().
+	@param lIn :{}	\n
+		Value to scale, an ADC code for FixAdcCfg().
+	@return The scaled value rounded to nearest, microvolts for FixAdcCfg().
+**/
+
+long FixMul(const FixScale *pScale, long lIn)
+	{
+	long long llOut = (long long)lIn * pScale->lMul;
+
+	return (long)((llOut + (1ll << (pScale->iShift-1))) >> pScale->iShift);
+	}
+
+/**
+	@brief int FixMulBlk(const FixScale *pScale, const int *piIn, long *plOut, int iNum)
+			==========Scales a buffer of values, for example DMA results.
+	@param pScale :{}	\n
+		Scale from FixScaleSet() or FixAdcCfg().
+	@param piIn :{}	\n
+		iNum values to scale.
+	@param plOut :{}	\n
+		iNum scaled values. May be piIn to convert in place.
+	@param iNum :{0-}	\n
+		Number of values.
+	@return iNum.
+**/
+
+int FixMulBlk(const FixScale *pScale, const int *piIn, long *plOut, int iNum)
+	{
+	long long llRnd = 1ll << (pScale->iShift-1);
+	long lMul = pScale->lMul;
+	int iShift = pScale->iShift;
+	int i1;
+
+	for(i1=0; i1<iNum; i1++)
+		plOut[i1] = (long)(((long long)piIn[i1] * lMul + llRnd) >> iShift);
+	return iNum;
+	}
+
+/**
+	@brief long FixAvg(const int *piIn, int iNum)
+			==========Averages a buffer of ADC codes.
+	@param piIn :{}	\n
+		iNum values.
+	@param iNum :{1-}	\n
+		Number of values.
+	@return The average rounded to nearest, 0 if iNum is 0.
+	@note Convert the average rather than each result when only the average
+		is needed.
+**/
+
+long FixAvg(const int *piIn, int iNum)
+	{
+	long long llSum = 0;
+	int i1;
+
+	if(iNum < 1)
+		return 0;
+	for(i1=0; i1<iNum; i1++)
+		llSum += piIn[i1];
+	if(llSum < 0)
+		return (long)((llSum - iNum/2) / iNum);
+	return (long)((llSum + iNum/2) / iNum);
+	}
+
+/**
+	@brief long FixRatio(long lNum, long lDen, long lScale)
+			==========Returns lNum*lScale/lDen.
+	@param lNum :{}	\n
+		Numerator, for example the RTD voltage in microvolts.
+	@param lDen :{}	\n
+		Denominator, for example the voltage across the reference resistor.
+	@param lScale :{}	\n
+		Scale, for example the reference resistor in milliohms.
+	@return The result rounded to nearest, or 0x7FFFFFFF or -0x7FFFFFFF if
+		it does not fit or lDen is 0.
+	@note Both voltages should come from the same FixScale unit, the result
+		is in the unit of lScale.
+**/
+
+long FixRatio(long lNum, long lDen, long lScale)
+	{
+	long long llNum = (long long)lNum * lScale;
+	long long llOut;
+
+	if(lDen < 0)
+		{
+		llNum = -llNum;
+		lDen = -lDen;
+		}
+	if(lDen == 0)
+		return (llNum < 0) ? -0x7FFFFFFF : 0x7FFFFFFF;
+	if(llNum < 0)
+		llOut = (llNum - lDen/2) / lDen;
+	else
+		llOut = (llNum + lDen/2) / lDen;
+	if(llOut > 0x7FFFFFFF)
+		return 0x7FFFFFFF;
+	if(llOut < -0x7FFFFFFF)
+		return -0x7FFFFFFF;
+	return (long)llOut;
+	}
+
+/**
+	@brief long FixLin(const FixLinTab *pTab, long lX)
+			==========Linearises one value by interpolating a table.
+	@param pTab :{}	\n
+		Table of equally spaced points.
+	@param lX :{}	\n
+		Input, for example milliohms.
+	@return The interpolated output, for example millidegrees. Inputs
+		outside the table are extrapolated from the end segments.
+	@note Rounds toward 0, within 1 output unit of the exact interpolation.
+**/
+
+long FixLin(const FixLinTab *pTab, long lX)
+	{
+	long lD = lX - pTab->lX0;
+	long lJ = lD / pTab->lStep;		// Segment, hardware divide
+	long lDy;
+	long long llP;
+
+	if(lD < 0)
+		lJ = 0;
+	else if(lJ > pTab->iSeg-1)
+		lJ = pTab->iSeg-1;
+	lD -= lJ * pTab->lStep;
+	lDy = pTab->plY[lJ+1] - pTab->plY[lJ];
+	llP = (long long)lD * lDy;
+	if((llP <= 0x7FFFFFFF) && (llP >= -0x7FFFFFFF))
+		return pTab->plY[lJ] + (long)llP / pTab->lStep;
+	return pTab->plY[lJ] + (long)(llP / pTab->lStep);	// Far outside the table only
+	}
+
+/**
+	@brief int FixLinBlk(const FixLinTab *pTab, const long *plX, long *plY, int iNum)
+			==========Linearises a buffer of values.
+	@param pTab :{}	\n
+		Table of equally spaced points.
+	@param plX :{}	\n
+		iNum inputs.
+	@param plY :{}	\n
+		iNum outputs. May be plX to convert in place.
+	@param iNum :{0-}	\n
+		Number of values.
+	@return iNum.
+**/
+
+int FixLinBlk(const FixLinTab *pTab, const long *plX, long *plY, int iNum)
+	{
+	int i1;
+
+	for(i1=0; i1<iNum; i1++)
+		plY[i1] = FixLin(pTab, plX[i1]);
+	return iNum;
+	}
+
+/**
+	@brief long FixSeg(const FixSegTab *pTab, long lX)
+			==========Linearises one value with a table of slopes and intercepts.
+	@param pTab :{}	\n
+		Table of equally spaced segments.
+	@param lX :{}	\n
+		Input, for example microvolts.
+	@return The output of the segment of lX, for example millidegrees.
+		Inputs outside the table are extrapolated from the end segments.
+	@note The multiply by the inverse width may place an input within
+		1 part in 2^32 of a segment boundary in the segment next to it.
+		Adjacent segments meet at the boundary, so the output is the same.
+		Tables from TempGen put the intercepts half an output unit up, so
+		the result is within 1 output unit of the exact interpolation.
+**/
+
+long FixSeg(const FixSegTab *pTab, long lX)
+	{
+	long lD = lX - pTab->lX0;
+	unsigned long ulJ = 0;
+
+	if(lD > 0)
+		{
+		ulJ = (unsigned long)(((unsigned long long)lD * pTab->ulInv) >> 32);
+		if(ulJ > (unsigned long)(pTab->iSeg-1))
+			ulJ = pTab->iSeg-1;
+		}
+	return pTab->pSeg[ulJ].lB + (long)(((long long)pTab->pSeg[ulJ].lM * lD) >> pTab->iFrac);
+	}
+
+/**
+	@brief int FixSegBlk(const FixSegTab *pTab, const long *plX, long *plY, int iNum)
+			==========Linearises a buffer of values with a table of slopes and intercepts.
+	@param pTab :{}	\n
+		Table of equally spaced segments.
+	@param plX :{}	\n
+		iNum inputs, for example a DMA buffer scaled by FixMulBlk().
+	@param plY :{}	\n
+		iNum outputs. May be plX to convert in place.
+	@param iNum :{0-}	\n
+		Number of values.
+	@return iNum.
+**/
+
+int FixSegBlk(const FixSegTab *pTab, const long *plX, long *plY, int iNum)
+	{
+	const FixSegPt *pSeg = pTab->pSeg;
+	unsigned long ulInv = pTab->ulInv;
+	unsigned long ulLast = pTab->iSeg-1;
+	long lX0 = pTab->lX0;
+	int iFrac = pTab->iFrac;
+	unsigned long ulJ;
+	long lD;
+	int i1;
+
+	for(i1=0; i1<iNum; i1++)		// Table kept in registers
+		{
+		lD = plX[i1] - lX0;
+		ulJ = 0;
+		if(lD > 0)
+			{
+			ulJ = (unsigned long)(((unsigned long long)lD * ulInv) >> 32);
+			if(ulJ > ulLast)
+				ulJ = ulLast;
+			}
+		plY[i1] = pSeg[ulJ].lB + (long)(((long long)pSeg[ulJ].lM * lD) >> iFrac);
+		}
+	return iNum;
+	}
+
+/**
+	@brief long FixPoly(const FixPolyTab *pTab, long lX)
+			==========Evaluates a polynomial in Horner form.
+	@param pTab :{}	\n
+		Polynomial.
+	@param lX :{}	\n
+		Input, for example microvolts. Clamped to lXMin..lXMax.
+	@return The output rounded to the nearest unit, for example
+		millidegrees.
+	@note Each order truncates the sum by up to 1 part in 2^iFrac of
+		the output unit.
+**/
+
+long FixPoly(const FixPolyTab *pTab, long lX)
+	{
+	const long *plC = pTab->plC;
+	long lU, lAcc;
+	int i1;
+
+	if(lX < pTab->lXMin)
+		lX = pTab->lXMin;
+	else if(lX > pTab->lXMax)
+		lX = pTab->lXMax;
+	lU = (lX - pTab->lX0) << pTab->iShift;
+	lAcc = plC[pTab->iOrder];
+	for(i1=pTab->iOrder-1; i1>=0; i1--)
+		lAcc = plC[i1] + (long)(((long long)lAcc * lU) >> 31);
+	return (lAcc + (1L << (pTab->iFrac-1))) >> pTab->iFrac;
+	}
+
+/**
+	@brief int FixPolyBlk(const FixPolyTab *pTab, const long *plX, long *plY, int iNum)
+			==========Evaluates a polynomial for a buffer of values.
+	@param pTab :{}	\n
+		Polynomial.
+	@param plX :{}	\n
+		iNum inputs, for example a DMA buffer scaled by FixMulBlk().
+	@param plY :{}	\n
+		iNum outputs. May be plX to convert in place.
+	@param iNum :{0-}	\n
+		Number of values.
+	@return iNum.
+**/
+
+int FixPolyBlk(const FixPolyTab *pTab, const long *plX, long *plY, int iNum)
+	{
+	int i1;
+
+	for(i1=0; i1<iNum; i1++)
+		plY[i1] = FixPoly(pTab, plX[i1]);
+	return iNum;
+	}
+
+/**@}*/
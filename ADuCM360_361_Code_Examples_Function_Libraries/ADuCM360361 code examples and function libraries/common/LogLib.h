@@ -0,0 +1,56 @@
+/**
+ *****************************************************************************
+   @file     LogLib.h
+   @brief    Set of deferred binary logging functions.
+   - Set up the record ring and output with LogCfg().
+   - Log a format ID and raw arguments with LogWr0(), LogWr1(), LogWr2()
+     or LogWr().
+   - Send queued records from the main loop with LogPoll().
+
+   @version  V0.1
+   @author   ADI
+   @date     October 2026
+   @par Revision History:
+   - V0.1, October 2026: initial version.
+
+
+
+All files for ADuCM360 provided by ADI, including this file, are
+provided  as is without warranty of any kind, either expressed or implied.
+The user assumes any and all risk from the use of this code.
+It is the responsibility of the person integrating this code into an application
+to ensure that the resulting application performs as required and is safe.
+
+**/
+#ifndef LOGLIB_H
+#define LOGLIB_H
+
+// Most arguments one record can carry
+#ifndef LOG_ARGS
+#define LOG_ARGS	4
+#endif
+
+// Longest record payload: sequence number, format ID and arguments
+#define LOG_REC_MAX	(2+4*LOG_ARGS)
+
+// Format table entry. An application lists its formats once in a header of
+// LOG_FMT(eId, szFmt) lines and includes it twice: on the target to build an
+// enum of IDs, on the host to build the table LogDec uses. For example:
+//    enum {
+//    #define LOG_FMT(eId, szFmt)   eId,
+//    #include "LogFmt.h"
+//    #undef LOG_FMT
+//    };
+// Formats take %d, %i, %u, %x, %X, %o, %c (an int argument) and %f, %e, %g
+// (a float argument, passed through LogFlt()).
+
+extern int LogCfg(unsigned long *pulBuf, int iSize, int (*pfWr)(const unsigned char *pucData, int iLen));
+extern int LogWr(int iId, int iCnt, const unsigned long *pulArg);
+extern int LogWr0(int iId);
+extern int LogWr1(int iId, unsigned long ulArg0);
+extern int LogWr2(int iId, unsigned long ulArg0, unsigned long ulArg1);
+extern unsigned long LogFlt(float fVal);
+extern int LogPoll(void);
+extern int LogDrop(void);
+
+#endif
@@ -2,9 +2,12 @@
  *****************************************************************************
    @file     PwrLib.h
    @brief    Functions for controling power modes
-   @version  V0.1
+   @version  V0.2
    @author   ADI
-   @date     September 2012 
+   @date     October 2026
+   @par Revision History:
+   - V0.1, September 2012: initial version.
+   - V0.2, October 2026: Added PwrWait().
 
 
 All files for ADuCM360/361 provided by ADI, including this file, are
@@ -17,5 +20,6 @@ to ensure that the resulting application performs as required and is safe.
 #include <ADuCM360.h>
 
 extern int PwrCfg(int iMode);
+extern int PwrWait(int iMode, volatile int *piFlag);
 extern int PwrRead(void);
 
@@ -0,0 +1,140 @@
+/**
+ *****************************************************************************
+   @example    ADC_Fast.c
+   @brief      This example shows a fast SINC2 channel next to the slow main
+               filter of ADC0.
+   - ADC0 converts AIN0/AIN1 continuously with the main filter at 3.75Hz with
+     chop on. Each result is read in the ADC0 interrupt.
+   - The SINC2 filter follows the same modulator with a result every 2ms.
+     AdcFastStart() moves its results over DMA into a ring of 2*16 results.
+   - The main loop reads the SINC2 results with AdcFastRd() as they come. If
+     one differs from the one before by more than STEP codes a step alarm is
+     sent to the UART at once, with the last precise result of the main filter.
+   - Every main filter result is sent to the UART with the SINC2 results lost.
+   - Default Baud rate is 9600
+   - EVAL-ADuCM360MKZ or similar hardware is assumed
+
+   @version V0.1
+   @author  ADI
+   @date    October 2026
+
+   @par     Revision History:
+   - V0.1, October 2026: initial version.
+
+
+All files for ADuCM360/361 provided by ADI, including this file, are
+provided  as is without warranty of any kind, either expressed or implied.
+The user assumes any and all risk from the use of this code.
+It is the responsibility of the person integrating this code into an application
+to ensure that the resulting application performs as required and is safe.
+
+**/
+
+#include <stdio.h>
+#include <aducm360.h>
+
+#include <..\common\AdcLib.h>
+#include <..\common\ClkLib.h>
+#include <..\common\WdtLib.h>
+#include <..\common\DioLib.h>
+#include <..\common\UrtLib.h>
+#include <..\common\DmaLib.h>
+
+#define HALF	16                            // SINC2 results per half of the ring
+#define STEP	0x10000                       // Alarm threshold in SINC2 codes
+
+void ADC0INIT(void);                          // Init ADC0
+void UARTINIT(void);                          // Init UART
+void SendString(char *szStr);                 // Transmit string using UART
+
+int iFastRing[2*HALF];                        // Ring filled by the SINC2 DMA channel
+volatile int iSlow = 0;                       // Latest main filter result
+volatile unsigned char ucSlowRdy = 0;         // New main filter result
+char szTxt[80];
+
+int main (void)
+{
+   int iFast[HALF];                                  // SINC2 results read at once
+   int iPrev = 0;
+   int iNum, iGaps;
+   int i1;
+
+   pADI_WDT ->T3CON = 0;                             // Disable the watchdog timer
+   WdtCfg(T3CON_PRE_DIV1,T3CON_IRQ_EN,T3CON_PD_DIS); // Disable Watchdog timer resets
+   ClkCfg(CLK_CD0,CLK_HF,CLKSYSDIV_DIV2EN_DIS,CLK_UCLKCG); // Select CD0 for CPU clock - 16MHz
+   ClkSel(CLK_CD7,CLK_CD7,CLK_CD0,CLK_CD7);          // Select CD0 for UART clock
+   UARTINIT();
+   DmaBase();                                        // Setup DMA controller
+   ADC0INIT();
+   AdcFastStart(pADI_ADC0,DETCON_RATE_2ms,iFastRing,HALF); // SINC2 of ADC0 every 2ms into the ring
+   NVIC_EnableIRQ(ADC0_IRQn);                        // Enable ADC0 interrupt
+   AdcGo(pADI_ADC0,ADCMDE_ADCMD_CONT);               // Start ADC0 for continuous conversions
+   if (AdcFastRd(iFast,1))                           // First result sets the reference
+      iPrev = iFast[0];
+   while (1)
+   {
+      iNum = AdcFastRd(iFast,HALF);                  // SINC2 results since the last read
+      for (i1 = 0; i1 < iNum; i1++)
+      {
+         if ((iFast[i1] - iPrev > STEP) || (iPrev - iFast[i1] > STEP))
+         {
+            sprintf(szTxt, "STEP %d to %d, slow %d\r\n", iPrev, iFast[i1], iSlow);
+            SendString(szTxt);
+         }
+         iPrev = iFast[i1];
+      }
+      if (ucSlowRdy)
+      {
+         ucSlowRdy = 0;
+         sprintf(szTxt, "slow %d fast %d lost %d", iSlow, AdcFastLast(), AdcFastSta(&iGaps));
+         SendString(szTxt);
+         sprintf(szTxt, " gaps %d\r\n", iGaps);
+         SendString(szTxt);
+      }
+   }
+}
+
+void ADC0INIT(void)
+{
+   AdcGo(pADI_ADC0,ADCMDE_ADCMD_IDLE);               // Place ADC0 in Idle mode
+   AdcMski(pADI_ADC0,ADCMSKI_RDY,1);                 // Enable ADC ready interrupt source
+   AdcFlt(pADI_ADC0,124,14,FLT_NORMAL|ADCFLT_NOTCH2|ADCFLT_CHOP); // ADC filter set for 3.75Hz update rate with chop on enabled
+   AdcRng(pADI_ADC0,ADCCON_ADCREF_INTREF,ADCMDE_PGA_G1,ADCCON_ADCCODE_INT); // Internal reference selected, Gain of 1, Signed integer output
+   AdcBuf(pADI_ADC0,ADCCFG_EXTBUF_OFF,ADC_BUF_ON);   // Turn on input buffers
+   AdcPin(pADI_ADC0,ADCCON_ADCCN_AIN1,ADCCON_ADCCP_AIN0); // Select AIN0 as postive input and AIN1 as negative input
+}
+
+void UARTINIT(void)
+{
+   DioCfg(pADI_GP0,0x3C);                            // Configure P0.2/P0.1 for UART
+   UrtCfg(pADI_UART,B9600,COMLCR_WLS_8BITS,0);       // setup baud rate for 9600, 8-bits
+   UrtMod(pADI_UART,COMMCR_DTR,0);                   // Setup modem bits
+}
+
+void SendString(char *szStr)
+{
+   while(*szStr)
+   {
+      while((UrtLinSta(pADI_UART) & COMLSR_THRE) == 0);
+      UrtTx(pADI_UART, *szStr++);
+   }
+}
+
+void ADC0_Int_Handler ()
+{
+   if ((AdcSta(pADI_ADC0) & 0x1) == 0x1)             // Main filter result ready
+   {
+      iSlow = AdcRd(pADI_ADC0);
+      ucSlowRdy = 1;
+   }
+}
+
+void DMA_SINC2_Int_Handler ()
+{
+   AdcFastInt();                                     // Re-arm the full half of the ring
+}
+
+void DMA_Err_Int_Handler ()
+{
+   DmaErrInt();                                      // Clear the error, re-arm the SINC2 channel
+}
@@ -0,0 +1,152 @@
+/**
+ *****************************************************************************
+   @example    ADC_Filter.c
+   @brief      This example shows DspLib filters run on the ADC0 DMA stream.
+   - ADC0 converts AIN0/AIN1 continuously at about 1kHz into a ping-pong
+     buffer with AdcStreamStart(). Each half of 64 results is filtered in
+     the DMA interrupt while the other half fills, so no result is dropped.
+   - Every result goes through a moving average of 16 and an exponential
+     average with a time constant of 64 results.
+   - A second order CIC decimates by 16 to about 62.5Hz and a 5Hz
+     Butterworth low pass biquad smooths its output.
+   - The latest output of each filter is sent to the UART after each half.
+   - Default Baud rate is 9600
+   - EVAL-ADuCM360MKZ or similar hardware is assumed
+
+   @version V0.1
+   @author  ADI
+   @date    October 2026
+
+   @par     Revision History:
+   - V0.1, October 2026: initial version.
+
+
+All files for ADuCM360/361 provided by ADI, including this file, are
+provided  as is without warranty of any kind, either expressed or implied.
+The user assumes any and all risk from the use of this code.
+It is the responsibility of the person integrating this code into an application
+to ensure that the resulting application performs as required and is safe.
+
+**/
+
+#include <stdio.h>
+#include <aducm360.h>
+
+#include <..\common\AdcLib.h>
+#include <..\common\ClkLib.h>
+#include <..\common\WdtLib.h>
+#include <..\common\DioLib.h>
+#include <..\common\UrtLib.h>
+#include <..\common\DmaLib.h>
+#include <..\common\DspLib.h>
+
+#define BLOCK	64                            // Results per half of the buffer
+#define DECIM	16                            // CIC decimation
+
+void ADC0INIT(void);                          // Init ADC0
+void UARTINIT(void);                          // Init UART
+void SendString(char *szStr);                 // Transmit string using UART
+void BlockDone(int *piData, int iNum);        // Called with each full half
+
+int iAdcBuf[2*BLOCK];                         // Ping-pong buffer filled by the DMA
+long lMaHist[16];                             // History of the moving average
+DspMaFlt Ma;
+DspEmaFlt Ema;
+DspCicFlt Cic;
+DspBqFlt Lp;
+volatile long lMaOut = 0;                     // Latest output of each filter
+volatile long lEmaOut = 0;
+volatile long lLpOut = 0;
+volatile unsigned long ulBlocks = 0;          // Blocks filtered
+char szTxt[80];
+
+int main (void)
+{
+   unsigned long ulSent = 0;
+   long lMa, lEma, lLp;
+
+   pADI_WDT ->T3CON = 0;                             // Disable the watchdog timer
+   WdtCfg(T3CON_PRE_DIV1,T3CON_IRQ_EN,T3CON_PD_DIS); // Disable Watchdog timer resets
+   ClkCfg(CLK_CD0,CLK_HF,CLKSYSDIV_DIV2EN_DIS,CLK_UCLKCG); // Select CD0 for CPU clock - 16MHz
+   ClkSel(CLK_CD7,CLK_CD7,CLK_CD0,CLK_CD7);          // Select CD0 for UART clock
+   UARTINIT();
+   DspMaInit(&Ma,lMaHist,4);                         // 16 results
+   DspEmaInit(&Ema,6);                               // Time constant of 64 results
+   DspCicInit(&Cic,2,DECIM);                         // Second order, 1kHz to 62.5Hz
+   DspBqInit(&Lp,DSP_BQ_COEF(0.0461318),DSP_BQ_COEF(0.0922636),DSP_BQ_COEF(0.0461318),
+      DSP_BQ_COEF(-1.30728503),DSP_BQ_COEF(0.49181224)); // 5Hz low pass at 62.5Hz
+   DmaBase();                                        // Setup DMA controller
+   ADC0INIT();
+   AdcStreamStart(pADI_ADC0,iAdcBuf,BLOCK,BlockDone); // Start ADC0 for continuous conversions
+   while (1)
+   {
+      if (ulBlocks != ulSent)
+      {
+         __disable_irq();                            // Copy the outputs of one block
+         lMa = lMaOut;
+         lEma = lEmaOut;
+         lLp = lLpOut;
+         ulSent = ulBlocks;
+         __enable_irq();
+         sprintf(szTxt, "%lu: ma %ld ema %ld cic+lp %ld gaps %d\r\n",
+            ulSent, lMa, lEma, lLp, AdcStreamSta(pADI_ADC0));
+         SendString(szTxt);
+      }
+   }
+}
+
+// Runs in the DMA interrupt while the other half fills
+void BlockDone(int *piData, int iNum)
+{
+   long lDec[BLOCK/DECIM+1];                         // CIC outputs of this block
+   long lOut = 0;
+   int iDec;
+   int i1;
+
+   for (i1 = 0; i1 < iNum; i1++)
+   {
+      lOut = DspMa(&Ma, piData[i1]);
+      lEmaOut = DspEma(&Ema, piData[i1]);
+   }
+   lMaOut = lOut;
+   iDec = DspCicBlk(&Cic, piData, iNum, lDec);
+   for (i1 = 0; i1 < iDec; i1++)
+      lLpOut = DspBq(&Lp, lDec[i1]);
+   ulBlocks++;
+}
+
+void ADC0INIT(void)
+{
+   AdcGo(pADI_ADC0,ADCMDE_ADCMD_IDLE);               // Place ADC0 in Idle mode
+   AdcMski(pADI_ADC0,ADCMSKI_RDY,1);                 // Enable ADC ready interrupt source
+   AdcFlt(pADI_ADC0,7,0,FLT_NORMAL);                 // ADC filter set for about 1kHz update rate
+   AdcRng(pADI_ADC0,ADCCON_ADCREF_INTREF,ADCMDE_PGA_G1,ADCCON_ADCCODE_INT); // Internal reference selected, Gain of 1, Signed integer output
+   AdcBuf(pADI_ADC0,ADCCFG_EXTBUF_OFF,ADC_BUF_ON);   // Turn on input buffers
+   AdcPin(pADI_ADC0,ADCCON_ADCCN_AIN1,ADCCON_ADCCP_AIN0); // Select AIN0 as postive input and AIN1 as negative input
+}
+
+void UARTINIT(void)
+{
+   DioCfg(pADI_GP0,0x3C);                            // Configure P0.2/P0.1 for UART
+   UrtCfg(pADI_UART,B9600,COMLCR_WLS_8BITS,0);       // setup baud rate for 9600, 8-bits
+   UrtMod(pADI_UART,COMMCR_DTR,0);                   // Setup modem bits
+}
+
+void SendString(char *szStr)
+{
+   while(*szStr)
+   {
+      while((UrtLinSta(pADI_UART) & COMLSR_THRE) == 0);
+      UrtTx(pADI_UART, *szStr++);
+   }
+}
+
+void DMA_ADC0_Int_Handler ()
+{
+   AdcStreamInt(pADI_ADC0);                          // Re-arm the full half and filter it
+}
+
+void DMA_Err_Int_Handler ()
+{
+   DmaErrInt();                                      // Clear the error, re-arm the ADC channel
+}
@@ -0,0 +1,158 @@
+/**
+ *****************************************************************************
+   @example    ADC_Scan.c
+   @brief      This example shows a DMA run ADC0 scan list with AdcScanStart().
+   - The three RTD measurements of ADC0_DMA.c run as one scan, the DMA
+     switches inputs, gain and buffers between them with no CPU involved:
+   - 1) AIN1/AGND, gain 1, buffers bypassed, for the excitation current.
+   - 2) AIN0/AGND, gain 1, buffers bypassed, as a diagnostic.
+   - 3) AIN0/AIN1, gain 32, buffers on, for the voltage across the RTD.
+   - AIN6 is used as the excitation current source for the RTD.
+   - 100ohm PT100 RTD expected connected to AIN0 and AIN1, 5.6kohm from AIN1
+     to AGND.
+   - The averages of 16 results per measurement in microvolts, the RTD
+     resistance in milliohms and its temperature in millidegrees are sent to
+     the UART after each scan. FixLib converts without floating point.
+   - Default Baud rate is 9600
+   - EVAL-ADuCM360MKZ or similar hardware is assumed
+
+   @version V0.2
+   @author  ADI
+   @date    October 2026
+
+   @par     Revision History:
+   - V0.1, October 2026: initial version.
+   - V0.2, October 2026: fixed-point conversion with FixLib.
+
+
+All files for ADuCM360/361 provided by ADI, including this file, are
+provided  as is without warranty of any kind, either expressed or implied.
+The user assumes any and all risk from the use of this code.
+It is the responsibility of the person integrating this code into an application
+to ensure that the resulting application performs as required and is safe.
+
+**/
+
+#include <stdio.h>
+#include <aducm360.h>
+
+#include <..\common\AdcLib.h>
+#include <..\common\ClkLib.h>
+#include <..\common\WdtLib.h>
+#include <..\common\DioLib.h>
+#include <..\common\UrtLib.h>
+#include <..\common\DmaLib.h>
+#include <..\common\IexcLib.h>
+#include <..\common\FixLib.h>
+
+#define STEPS	3                             // Measurements per scan
+#define SAMPLES	16                            // Results per measurement
+#define RREF	5600000                       // Reference resistor in milliohms
+
+void ADC0INIT(void);                          // Init ADC0
+void IEXCINIT(void);                          // Init excitation current
+void UARTINIT(void);                          // Init UART
+void SendString(char *szStr);                 // Transmit string using UART
+void ScanDone(ADI_ADC_TypeDef *pPort);        // Called at the end of each scan
+
+int iAdcData[STEPS][SAMPLES];                 // Results, filled by the DMA
+AdcScanEntry Scan[STEPS] =
+{
+   {ADCCON_ADCCN_AGND, ADCCON_ADCCP_AIN1, ADCMDE_PGA_G1, ADCCON_ADCREF_INTREF,
+      ADCCON_BUFBYPN|ADCCON_BUFBYPP, SAMPLES, iAdcData[0]},
+   {ADCCON_ADCCN_AGND, ADCCON_ADCCP_AIN0, ADCMDE_PGA_G1, ADCCON_ADCREF_INTREF,
+      ADCCON_BUFBYPN|ADCCON_BUFBYPP, SAMPLES, iAdcData[1]},
+   {ADCCON_ADCCN_AIN1, ADCCON_ADCCP_AIN0, ADCMDE_PGA_G32, ADCCON_ADCREF_INTREF,
+      ADC_BUF_ON, SAMPLES, iAdcData[2]},
+};
+DmaDesc ScanList[ADCSCAN_TASKS(STEPS)];       // Task list run by the ADC0 DMA channel
+volatile unsigned char ucScanDone = 0;
+FixScale G1Uv, G32Uv;                         // Microvolts per code at gain 1 and 32
+// Pt100 temperature in millidegrees from 84.271ohm (-40C) in 2.123ohm steps
+const long lRtdTab[] = {-39999,-34630,-29251,-23863,-18466,-13060,-7644,-2220,3213,8654,14105,
+   19564,25032,30509,35995,41490,46994,52507,58029,63560,69101,74651,80210,
+   85779,91357,96944,102541,108148,113764,119390,125025};
+const FixLinTab RtdTab = {84271, 2123, 30, lRtdTab};
+char szTxt[100];
+
+int main (void)
+{
+   long lVAIN1_AGND, lVAIN0_AGND, lVRTD, lRrtd;
+
+   pADI_WDT ->T3CON = 0;                             // Disable the watchdog timer
+   WdtCfg(T3CON_PRE_DIV1,T3CON_IRQ_EN,T3CON_PD_DIS); // Disable Watchdog timer resets
+   ClkCfg(CLK_CD0,CLK_HF,CLKSYSDIV_DIV2EN_DIS,CLK_UCLKCG); // Select CD0 for CPU clock - 16MHz
+   ClkSel(CLK_CD7,CLK_CD7,CLK_CD0,CLK_CD7);          // Select CD0 for UART clock
+   UARTINIT();
+   DioOen(pADI_GP1,0x8);                             // Set P1.3 as an output to toggle the LED
+   DmaBase();                                        // Setup DMA controller
+   NVIC_EnableIRQ(DMA_ERR_IRQn);
+   IEXCINIT();
+   ADC0INIT();
+   FixAdcCfg(&G1Uv,ADCMDE_PGA_G1,FIX_REF_INT_UV);   // Precompute the conversions
+   FixAdcCfg(&G32Uv,ADCMDE_PGA_G32,FIX_REF_INT_UV);
+   while (1)
+   {
+      ucScanDone = 0;
+      if (AdcScanStart(pADI_ADC0,Scan,STEPS,ScanList,ScanDone) == 0)
+      {
+         SendString("Scan list error\r\n");
+         while (1);
+      }
+      while (ucScanDone == 0)                        // The CPU is free during the scan
+      {}
+      lVAIN1_AGND = FixMul(&G1Uv, FixAvg(iAdcData[0], SAMPLES));
+      lVAIN0_AGND = FixMul(&G1Uv, FixAvg(iAdcData[1], SAMPLES));
+      lVRTD = FixMul(&G32Uv, FixAvg(iAdcData[2], SAMPLES));
+      lRrtd = FixRatio(lVRTD, lVAIN1_AGND, RREF);    // Same excitation current through both
+      sprintf(szTxt, "AIN1 %lduV AIN0 %lduV RTD %lduV %ldmohm %ldmC\r\n",
+         lVAIN1_AGND, lVAIN0_AGND, lVRTD, lRrtd, FixLin(&RtdTab, lRrtd));
+      SendString(szTxt);
+      DioTgl(pADI_GP1,0x8);                          // Toggle LED, P1.3
+   }
+}
+
+// Runs in the DMA interrupt once the last results are in
+void ScanDone(ADI_ADC_TypeDef *pPort)
+{
+   ucScanDone = 1;
+}
+
+void ADC0INIT(void)
+{
+   AdcGo(pADI_ADC0,ADCMDE_ADCMD_IDLE);               // Place ADC0 in Idle mode
+   AdcFlt(pADI_ADC0,124,14,FLT_NORMAL|ADCFLT_NOTCH2|ADCFLT_CHOP); // ADC filter set for 3.75Hz update rate with chop on enabled
+   AdcRng(pADI_ADC0,ADCCON_ADCREF_INTREF,ADCMDE_PGA_G1,ADCCON_ADCCODE_INT); // Signed integer output, the scan sets gain and reference
+}
+
+void IEXCINIT(void)
+{
+   IexcDat(IEXCDAT_IDAT_200uA,IDAT0En);              // Set output for 200uA
+   IexcCfg(IEXCCON_PD_off,IEXCCON_REFSEL_Int,IEXCCON_IPSEL1_Off,IEXCCON_IPSEL0_AIN6); // Setup IEXC0 for AIN6
+}
+
+void UARTINIT(void)
+{
+   DioCfg(pADI_GP0,0x3C);                            // Configure P0.2/P0.1 for UART
+   UrtCfg(pADI_UART,B9600,COMLCR_WLS_8BITS,0);       // setup baud rate for 9600, 8-bits
+   UrtMod(pADI_UART,COMMCR_DTR,0);                   // Setup modem bits
+}
+
+void SendString(char *szStr)
+{
+   while(*szStr)
+   {
+      while((UrtLinSta(pADI_UART) & COMLSR_THRE) == 0);
+      UrtTx(pADI_UART, *szStr++);
+   }
+}
+
+void DMA_ADC0_Int_Handler ()
+{
+   AdcScanInt(pADI_ADC0);                            // Stop ADC0 and end the scan
+}
+
+void DMA_Err_Int_Handler ()
+{
+   DmaErrInt();                                      // Clear the error, re-arm the ADC channel
+}
@@ -0,0 +1,145 @@
+/**
+ *****************************************************************************
+   @example    ADC_StepWake.c
+   @brief      This example shows a slow input watched with the core asleep.
+   - ADC0 converts AIN0/AIN1 continuously at 3.75Hz with chop on. Its ready
+     interrupt stays off, so conversions do not wake the core.
+   - The SINC2 filter follows ADC0 every 8ms. AdcStpCfg() has it interrupt
+     only when two results differ by more than STEP_TH.
+   - The wake-up timer interrupts every ALIVE_S seconds from the 32kHz
+     oscillator for a keep-alive report.
+   - Between the two the core is halted with PwrWait(). Each report is sent
+     to the UART with the last ADC0 result and the wake-ups since the one
+     before, a measure of the time spent awake.
+   - Default Baud rate is 9600
+   - EVAL-ADuCM360MKZ or similar hardware is assumed
+
+   @version V0.1
+   @author  ADI
+   @date    October 2026
+
+   @par     Revision History:
+   - V0.1, October 2026: initial version.
+
+
+All files for ADuCM360/361 provided by ADI, including this file, are
+provided  as is without warranty of any kind, either expressed or implied.
+The user assumes any and all risk from the use of this code.
+It is the responsibility of the person integrating this code into an application
+to ensure that the resulting application performs as required and is safe.
+
+**/
+
+#include <stdio.h>
+#include <aducm360.h>
+
+#include <..\common\AdcLib.h>
+#include <..\common\ClkLib.h>
+#include <..\common\WdtLib.h>
+#include <..\common\DioLib.h>
+#include <..\common\UrtLib.h>
+#include <..\common\PwrLib.h>
+#include <..\common\WutLib.h>
+
+#define STEP_TH 0x100                         // Step threshold in SINC2 codes
+#define ALIVE_S 10                            // Seconds between keep-alive reports
+
+void ADC0INIT(void);                          // Init ADC0
+void UARTINIT(void);                          // Init UART
+void WUTINIT(void);                           // Init wake-up timer
+void SendString(char *szStr);                 // Transmit string using UART
+
+volatile int iWake = 0;                       // Set by the handlers that need the core
+volatile unsigned char ucStep = 0;            // Step seen
+volatile unsigned char ucAlive = 0;           // Keep-alive due
+volatile int iStepDat = 0;                    // SINC2 result after the step
+char szTxt[80];
+
+int main (void)
+{
+   int iWakes = 0;
+
+   pADI_WDT ->T3CON = 0;                             // Disable the watchdog timer
+   WdtCfg(T3CON_PRE_DIV1,T3CON_IRQ_EN,T3CON_PD_DIS); // Disable Watchdog timer resets
+   ClkDis(CLKDIS_DISSPI0CLK|CLKDIS_DISSPI1CLK|CLKDIS_DISI2CCLK|CLKDIS_DISPWMCLK|CLKDIS_DIST0CLK|CLKDIS_DIST1CLK|CLKDIS_DISDACCLK|CLKDIS_DISDMACLK); // Only enable clock to used blocks
+   ClkCfg(CLK_CD0,CLK_HF,CLKSYSDIV_DIV2EN_DIS,CLK_UCLKCG); // Select CD0 for CPU clock - 16MHz
+   ClkSel(CLK_CD7,CLK_CD7,CLK_CD0,CLK_CD7);          // Select CD0 for UART clock
+   UARTINIT();
+   ADC0INIT();
+   AdcGo(pADI_ADC0,ADCMDE_ADCMD_CONT);               // Start ADC0 for continuous conversions
+   AdcStpCfg(pADI_ADCSTEP,0,DETCON_RATE_8ms,STEP_TH); // SINC2 of ADC0, interrupt on steps only
+   WUTINIT();
+   SendString("Watching AIN0/AIN1\r\n");
+   while (1)
+   {
+      iWakes += PwrWait(PWRMOD_MOD_MCUHALT,&iWake);  // Core halted until a step or keep-alive
+      iWake = 0;                                     // Cleared before the flags, a new event wakes again
+      if (ucStep)
+      {
+         ucStep = 0;
+         sprintf(szTxt, "STEP to %d, adc %d, wakes %d\r\n", iStepDat, AdcRd(pADI_ADC0), iWakes);
+         SendString(szTxt);
+         iWakes = 0;
+      }
+      if (ucAlive)
+      {
+         ucAlive = 0;
+         sprintf(szTxt, "alive adc %d, wakes %d\r\n", AdcRd(pADI_ADC0), iWakes);
+         SendString(szTxt);
+         iWakes = 0;
+      }
+   }
+}
+
+void ADC0INIT(void)
+{
+   AdcGo(pADI_ADC0,ADCMDE_ADCMD_IDLE);               // Place ADC0 in Idle mode
+   AdcMski(pADI_ADC0,0,1);                           // No ADC0 interrupt, results are read when reporting
+   AdcFlt(pADI_ADC0,124,14,FLT_NORMAL|ADCFLT_NOTCH2|ADCFLT_CHOP); // ADC filter set for 3.75Hz update rate with chop on enabled
+   AdcRng(pADI_ADC0,ADCCON_ADCREF_INTREF,ADCMDE_PGA_G1,ADCCON_ADCCODE_INT); // Internal reference selected, Gain of 1, Signed integer output
+   AdcBuf(pADI_ADC0,ADCCFG_EXTBUF_OFF,ADC_BUF_ON);   // Turn on input buffers
+   AdcPin(pADI_ADC0,ADCCON_ADCCN_AIN1,ADCCON_ADCCP_AIN0); // Select AIN0 as postive input and AIN1 as negative input
+}
+
+void WUTINIT(void)
+{
+   WutCfg(T2CON_MOD_PERIODIC,T2CON_WUEN_EN,T2CON_PRE_DIV32768,T2CON_CLK_LFOSC); // 1Hz ticks from the 32kHz oscillator
+   WutCfgInt(T2IEN_WUFD,1);                          // Interrupt on compare to D register
+   WutLdWr(3,ALIVE_S);                               // Keep-alive period
+   WutGo(T2CON_ENABLE_EN);                           // Start wake-up timer
+   NVIC_EnableIRQ(WUT_IRQn);
+}
+
+void UARTINIT(void)
+{
+   DioCfg(pADI_GP0,0x3C);                            // Configure P0.2/P0.1 for UART
+   UrtCfg(pADI_UART,B9600,COMLCR_WLS_8BITS,0);       // setup baud rate for 9600, 8-bits
+   UrtMod(pADI_UART,COMMCR_DTR,0);                   // Setup modem bits
+}
+
+void SendString(char *szStr)
+{
+   while(*szStr)
+   {
+      while((UrtLinSta(pADI_UART) & COMLSR_THRE) == 0);
+      UrtTx(pADI_UART, *szStr++);
+   }
+   while((UrtLinSta(pADI_UART) & COMLSR_TEMT) == 0); // Last character out before the core halts
+}
+
+void SINC2_Int_Handler ()
+{
+   if (AdcDetSta(pADI_ADCSTEP) & 0x2)                // DETSTA_STEPFLAG
+   {
+      iStepDat = AdcStpRd(pADI_ADCSTEP);
+      ucStep = 1;
+      iWake = 1;
+   }
+}
+
+void WakeUp_Int_Handler(void)
+{
+   WutClrInt(T2CLRI_WUFD);                           // Clear wakeup for D register interrupt
+   ucAlive = 1;
+   iWake = 1;
+}
@@ -0,0 +1,138 @@
+/**
+ *****************************************************************************
+   @example    ADC_Stream.c
+   @brief      This example shows gapless ADC0 streaming with AdcStreamStart().
+   - ADC0 converts AIN0/AIN1 continuously at about 1kHz. The DMA fills one
+     half of a ping-pong buffer while the other half is processed, so the
+     ADC is never stopped and no result is lost.
+   - For every block of 128 results the average, the minimum and the
+     maximum are sent to the UART, with the number of gaps in the stream.
+   - Default Baud rate is 9600
+   - EVAL-ADuCM360MKZ or similar hardware is assumed
+
+   @version V0.1
+   @author  ADI
+   @date    October 2026
+
+   @par     Revision History:
+   - V0.1, October 2026: initial version.
+
+
+All files for ADuCM360/361 provided by ADI, including this file, are
+provided  as is without warranty of any kind, either expressed or implied.
+The user assumes any and all risk from the use of this code.
+It is the responsibility of the person integrating this code into an application
+to ensure that the resulting application performs as required and is safe.
+
+**/
+
+#include <stdio.h>
+#include <aducm360.h>
+
+#include <..\common\AdcLib.h>
+#include <..\common\ClkLib.h>
+#include <..\common\WdtLib.h>
+#include <..\common\DioLib.h>
+#include <..\common\UrtLib.h>
+#include <..\common\DmaLib.h>
+
+#define BLOCK	128                           // Results per half of the buffer
+
+void ADC0INIT(void);                          // Init ADC0
+void UARTINIT(void);                          // Init UART
+void SendString(char *szStr);                 // Transmit string using UART
+void BlockDone(int *piData, int iNum);        // Called with each full half
+
+int iAdcBuf[2*BLOCK];                         // Ping-pong buffer filled by the DMA
+volatile long lBlockAvg = 0;                  // Average, minimum and maximum of the last block
+volatile int iBlockMin = 0;
+volatile int iBlockMax = 0;
+volatile unsigned long ulBlocks = 0;          // Blocks processed
+char szTxt[80];
+
+int main (void)
+{
+   unsigned long ulSent = 0;
+   long lAvg;
+   int iMin, iMax;
+
+   pADI_WDT ->T3CON = 0;                             // Disable the watchdog timer
+   WdtCfg(T3CON_PRE_DIV1,T3CON_IRQ_EN,T3CON_PD_DIS); // Disable Watchdog timer resets
+   ClkCfg(CLK_CD0,CLK_HF,CLKSYSDIV_DIV2EN_DIS,CLK_UCLKCG); // Select CD0 for CPU clock - 16MHz
+   ClkSel(CLK_CD7,CLK_CD7,CLK_CD0,CLK_CD7);          // Select CD0 for UART clock
+   UARTINIT();
+   DmaBase();                                        // Setup DMA controller
+   ADC0INIT();
+   AdcStreamStart(pADI_ADC0,iAdcBuf,BLOCK,BlockDone); // Start ADC0 for continuous conversions
+   while (1)
+   {
+      if (ulBlocks != ulSent)
+      {
+         __disable_irq();                            // Copy the results of one block
+         lAvg = lBlockAvg;
+         iMin = iBlockMin;
+         iMax = iBlockMax;
+         ulSent = ulBlocks;
+         __enable_irq();
+         sprintf(szTxt, "%lu: avg %ld min %d max %d gaps %d\r\n",
+            ulSent, lAvg, iMin, iMax, AdcStreamSta(pADI_ADC0));
+         SendString(szTxt);
+      }
+   }
+}
+
+// Runs in the DMA interrupt while the other half fills
+void BlockDone(int *piData, int iNum)
+{
+   long lSum = 0;
+   int iMin = piData[0];
+   int iMax = piData[0];
+   int i1;
+
+   for (i1 = 0; i1 < iNum; i1++)
+   {
+      lSum += piData[i1] >> 8;                       // Keep 20 bits so 128 results fit in the sum
+      if (piData[i1] < iMin) iMin = piData[i1];
+      if (piData[i1] > iMax) iMax = piData[i1];
+   }
+   lBlockAvg = (lSum / iNum) * 256;
+   iBlockMin = iMin;
+   iBlockMax = iMax;
+   ulBlocks++;
+}
+
+void ADC0INIT(void)
+{
+   AdcGo(pADI_ADC0,ADCMDE_ADCMD_IDLE);               // Place ADC0 in Idle mode
+   AdcMski(pADI_ADC0,ADCMSKI_RDY,1);                 // Enable ADC ready interrupt source
+   AdcFlt(pADI_ADC0,7,0,FLT_NORMAL);                 // ADC filter set for about 1kHz update rate
+   AdcRng(pADI_ADC0,ADCCON_ADCREF_INTREF,ADCMDE_PGA_G1,ADCCON_ADCCODE_INT); // Internal reference selected, Gain of 1, Signed integer output
+   AdcBuf(pADI_ADC0,ADCCFG_EXTBUF_OFF,ADC_BUF_ON);   // Turn on input buffers
+   AdcPin(pADI_ADC0,ADCCON_ADCCN_AIN1,ADCCON_ADCCP_AIN0); // Select AIN0 as postive input and AIN1 as negative input
+}
+
+void UARTINIT(void)
+{
+   DioCfg(pADI_GP0,0x3C);                            // Configure P0.2/P0.1 for UART
+   UrtCfg(pADI_UART,B9600,COMLCR_WLS_8BITS,0);       // setup baud rate for 9600, 8-bits
+   UrtMod(pADI_UART,COMMCR_DTR,0);                   // Setup modem bits
+}
+
+void SendString(char *szStr)
+{
+   while(*szStr)
+   {
+      while((UrtLinSta(pADI_UART) & COMLSR_THRE) == 0);
+      UrtTx(pADI_UART, *szStr++);
+   }
+}
+
+void DMA_ADC0_Int_Handler ()
+{
+   AdcStreamInt(pADI_ADC0);                          // Re-arm the full half and process it
+}
+
+void DMA_Err_Int_Handler ()
+{
+   DmaErrInt();                                      // Clear the error, re-arm the ADC channel
+}
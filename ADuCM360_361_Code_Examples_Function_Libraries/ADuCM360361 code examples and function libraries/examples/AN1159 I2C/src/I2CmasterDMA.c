@@ -8,13 +8,15 @@
    - Configures the ADuCM301 for I2C DMA transfer. 
    - Code to use with I2Cslave.c
 
-   @version  V0.2
+   @version  V0.3
    @author   ADI
-   @date     October 2012 
+   @date     October 2026
               
    @par Revision History:
    - V0.1, May 2012: initial version. 
    - V0.2, October 2012: using new version of ClkLib
+   - V0.3, October 2026: descriptors and types from DmaLib, which the
+     project links for UrtLib.
               
 
 All files for ADuCM360/361 provided by ADI, including this file, are
@@ -31,42 +33,11 @@ to ensure that the resulting application performs as required and is safe.
 #include <..\common\WdtLib.h>
 #include <..\common\DioLib.h>
 #include <..\common\I2cLib.h>
+#include <..\common\DmaLib.h>
 
 #define MAX_COUNT_TX   0x10
  
-typedef struct ctrl_cfg 
-{
-   unsigned int cycle_ctrl:3;
-   unsigned int next_useburst:1;
-   unsigned int n_minus_1:10;
-   unsigned int r_power:4;
-   unsigned int src_prot_ctrl:3;
-   unsigned int dst_prot_ctrl:3;
-   unsigned int src_size:2;
-   unsigned int src_inc:2;
-   unsigned int dst_size:2;
-   unsigned int dst_inc:2;
-} CtrlCfg;
-
-typedef struct dma_desc // Define the structure of a DMA descriptor.
-{
-   unsigned int srcEndPtr;
-   unsigned int destEndPtr;
-   CtrlCfg ctrlCfg;
-   unsigned int reserved4Bytes;
-} DmaDesc;
-
-#define CCD_SIZE 16
-#define DMACHAN_DSC_ALIGN 0x200
-
-#if defined(__ARMCC_VERSION) || defined(__GNUC__)
-DmaDesc dmaChanDesc     [CCD_SIZE * 2] __attribute__ ((aligned (DMACHAN_DSC_ALIGN)));      
-#endif
-
-#ifdef __ICCARM__
-#pragma data_alignment=(DMACHAN_DSC_ALIGN)
-DmaDesc dmaChanDesc     [CCD_SIZE * 2];
-#endif
+extern DmaDesc dmaChanDesc[];             // Defined and aligned in DmaLib.c
 DmaDesc *I2CMTxDmaDesc, *I2CMRxDmaDesc;
   
 volatile unsigned char ucTxBuffer[] = {0x01,0x02,0x03,0x04,0x05};
@@ -93,31 +64,31 @@ int main(void)
   I2CMRxDmaDesc = &dmaChanDesc[7];	
   I2CMRxDmaDesc->srcEndPtr = (unsigned int) &pADI_I2C->I2CMRX;
   I2CMRxDmaDesc->destEndPtr =  (unsigned int)(ucRxBuffer + DMA_RX_COUNT -1 );
-  I2CMRxDmaDesc->ctrlCfg.dst_inc = 0;   // no increment as the dest is a reg
-  I2CMRxDmaDesc->ctrlCfg.dst_size = 0;  // byte data
-  I2CMRxDmaDesc->ctrlCfg.src_inc = 3;   // byte incr. 
-  I2CMRxDmaDesc->ctrlCfg.src_size = 0;  // byte data
-  I2CMRxDmaDesc->ctrlCfg.dst_prot_ctrl = 0;
-  I2CMRxDmaDesc->ctrlCfg.src_prot_ctrl = 0;
-  I2CMRxDmaDesc->ctrlCfg.r_power = 0;
-  I2CMRxDmaDesc->ctrlCfg.n_minus_1 = DMA_RX_COUNT - 1;
-  I2CMRxDmaDesc->ctrlCfg.next_useburst = 0;
-  I2CMRxDmaDesc->ctrlCfg.cycle_ctrl = 1; //  Basic DMA transfer  
+  I2CMRxDmaDesc->ctrlCfg.Bits.dst_inc = 0;   // no increment as the dest is a reg
+  I2CMRxDmaDesc->ctrlCfg.Bits.dst_size = 0;  // byte data
+  I2CMRxDmaDesc->ctrlCfg.Bits.src_inc = 3;   // byte incr. 
+  I2CMRxDmaDesc->ctrlCfg.Bits.src_size = 0;  // byte data
+  I2CMRxDmaDesc->ctrlCfg.Bits.dst_prot_ctrl = 0;
+  I2CMRxDmaDesc->ctrlCfg.Bits.src_prot_ctrl = 0;
+  I2CMRxDmaDesc->ctrlCfg.Bits.r_power = 0;
+  I2CMRxDmaDesc->ctrlCfg.Bits.n_minus_1 = DMA_RX_COUNT - 1;
+  I2CMRxDmaDesc->ctrlCfg.Bits.next_useburst = 0;
+  I2CMRxDmaDesc->ctrlCfg.Bits.cycle_ctrl = 1; //  Basic DMA transfer  
 
   // I2C master transmit  
   I2CMTxDmaDesc = &dmaChanDesc[6];	
   I2CMTxDmaDesc->srcEndPtr = (unsigned int)(ucTxBuffer + DMA_TRAN_COUNT -1 );
   I2CMTxDmaDesc->destEndPtr = (unsigned int) &pADI_I2C->I2CMTX; 
-  I2CMTxDmaDesc->ctrlCfg.dst_inc = 3;   // no increment as the dest is a reg
-  I2CMTxDmaDesc->ctrlCfg.dst_size = 0;  // byte data
-  I2CMTxDmaDesc->ctrlCfg.src_inc = 0;   // byte incr. 
-  I2CMTxDmaDesc->ctrlCfg.src_size = 0;  // byte data
-  I2CMTxDmaDesc->ctrlCfg.dst_prot_ctrl = 0;
-  I2CMTxDmaDesc->ctrlCfg.src_prot_ctrl = 0;
-  I2CMTxDmaDesc->ctrlCfg.r_power = 0;
-  I2CMTxDmaDesc->ctrlCfg.n_minus_1 = DMA_TRAN_COUNT - 1;
-  I2CMTxDmaDesc->ctrlCfg.next_useburst = 0;
-  I2CMTxDmaDesc->ctrlCfg.cycle_ctrl = 1; //  Basic DMA transfer  
+  I2CMTxDmaDesc->ctrlCfg.Bits.dst_inc = 3;   // no increment as the dest is a reg
+  I2CMTxDmaDesc->ctrlCfg.Bits.dst_size = 0;  // byte data
+  I2CMTxDmaDesc->ctrlCfg.Bits.src_inc = 0;   // byte incr. 
+  I2CMTxDmaDesc->ctrlCfg.Bits.src_size = 0;  // byte data
+  I2CMTxDmaDesc->ctrlCfg.Bits.dst_prot_ctrl = 0;
+  I2CMTxDmaDesc->ctrlCfg.Bits.src_prot_ctrl = 0;
+  I2CMTxDmaDesc->ctrlCfg.Bits.r_power = 0;
+  I2CMTxDmaDesc->ctrlCfg.Bits.n_minus_1 = DMA_TRAN_COUNT - 1;
+  I2CMTxDmaDesc->ctrlCfg.Bits.next_useburst = 0;
+  I2CMTxDmaDesc->ctrlCfg.Bits.cycle_ctrl = 1; //  Basic DMA transfer  
 
   I2cMCfg(I2CMCON_TXDMA|I2CMCON_RXDMA,I2CMCON_IENCMP,I2CMCON_MAS_EN);
   I2cBaud(0x4E,0x4F); // 100kHz clock
@@ -170,8 +141,8 @@ void delay (int length)
 ///////////////////////////////////////////////////////////////////////////
 void DMA_I2C0_MTX_Int_Handler ()
 {
-  I2CMTxDmaDesc->ctrlCfg.n_minus_1 = DMA_TRAN_COUNT - 1;
-  I2CMTxDmaDesc->ctrlCfg.cycle_ctrl = 1; //  Basic DMA transfer  
+  I2CMTxDmaDesc->ctrlCfg.Bits.n_minus_1 = DMA_TRAN_COUNT - 1;
+  I2CMTxDmaDesc->ctrlCfg.Bits.cycle_ctrl = 1; //  Basic DMA transfer  
   pADI_DMA->DMAENSET |= DMAENSET_I2CMTX; // Enable DMA channel
   pADI_DMA->DMARMSKSET |= DMARMSKSET_I2CMTX; //Disable further DMA requests from the I2C peripheral
 }
@@ -181,8 +152,8 @@ void DMA_I2C0_MTX_Int_Handler ()
 ///////////////////////////////////////////////////////////////////////////
 void DMA_I2C0_MRX_Int_Handler ()
 {
-  I2CMRxDmaDesc->ctrlCfg.n_minus_1 = DMA_RX_COUNT - 1;
-  I2CMRxDmaDesc->ctrlCfg.cycle_ctrl = 1; //  Basic DMA transfer  
+  I2CMRxDmaDesc->ctrlCfg.Bits.n_minus_1 = DMA_RX_COUNT - 1;
+  I2CMRxDmaDesc->ctrlCfg.Bits.cycle_ctrl = 1; //  Basic DMA transfer  
   pADI_DMA->DMAENSET |= DMAENSET_I2CMRX; // Enable DMA channel
 }
 
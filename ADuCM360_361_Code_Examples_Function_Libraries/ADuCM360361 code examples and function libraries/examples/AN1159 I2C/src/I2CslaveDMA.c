@@ -8,13 +8,15 @@
    - Configures the ADuCM301 for I2C DMA transfer. 
    - Code to use with I2Cmaster.c
 
-   @version  V0.2
+   @version  V0.3
    @author   ADI
-   @date     October 2012 
+   @date     October 2026
 
    @par Revision History:
    - V0.1, May 2012: initial version. 
    - V0.2, October 2012: using new version of ClkLib
+   - V0.3, October 2026: descriptors and types from DmaLib, which the
+     project links for UrtLib.
  
 
 All files for ADuCM360/361 provided by ADI, including this file, are
@@ -31,41 +33,10 @@ to ensure that the resulting application performs as required and is safe.
 #include <..\common\WdtLib.h>
 #include <..\common\DioLib.h>
 #include <..\common\I2cLib.h>
+#include <..\common\DmaLib.h>
 
 
-typedef struct ctrl_cfg 
-{
-   unsigned int cycle_ctrl:3;
-   unsigned int next_useburst:1;
-   unsigned int n_minus_1:10;
-   unsigned int r_power:4;
-   unsigned int src_prot_ctrl:3;
-   unsigned int dst_prot_ctrl:3;
-   unsigned int src_size:2;
-   unsigned int src_inc:2;
-   unsigned int dst_size:2;
-   unsigned int dst_inc:2;
-} CtrlCfg;
-
-typedef struct dma_desc // Define the structure of a DMA descriptor.
-{
-   unsigned int srcEndPtr;
-   unsigned int destEndPtr;
-   CtrlCfg ctrlCfg;
-   unsigned int reserved4Bytes;
-} DmaDesc;
-
-#define CCD_SIZE 16
-#define DMACHAN_DSC_ALIGN 0x200
-
-#if defined(__ARMCC_VERSION) || defined(__GNUC__)
-DmaDesc dmaChanDesc     [CCD_SIZE * 2] __attribute__ ((aligned (DMACHAN_DSC_ALIGN)));      
-#endif
-
-#ifdef __ICCARM__
-#pragma data_alignment=(DMACHAN_DSC_ALIGN)
-DmaDesc dmaChanDesc     [CCD_SIZE * 2];
-#endif
+extern DmaDesc dmaChanDesc[];             // Defined and aligned in DmaLib.c
 DmaDesc *I2CSRxDmaDesc, *I2CSTxDmaDesc;
   
 volatile unsigned char ucRxBuffer[5];
@@ -90,31 +61,31 @@ int main(void)
   I2CSRxDmaDesc = &dmaChanDesc[5];	
   I2CSRxDmaDesc->srcEndPtr = (unsigned int) &pADI_I2C->I2CSRX;
   I2CSRxDmaDesc->destEndPtr =  (unsigned int)(ucRxBuffer + DMA_RX_COUNT -1 );
-  I2CSRxDmaDesc->ctrlCfg.dst_inc = 0;   // no increment as the dest is a reg
-  I2CSRxDmaDesc->ctrlCfg.dst_size = 0;  // byte data
-  I2CSRxDmaDesc->ctrlCfg.src_inc = 3;   // byte incr. 
-  I2CSRxDmaDesc->ctrlCfg.src_size = 0;  // byte data
-  I2CSRxDmaDesc->ctrlCfg.dst_prot_ctrl = 0;
-  I2CSRxDmaDesc->ctrlCfg.src_prot_ctrl = 0;
-  I2CSRxDmaDesc->ctrlCfg.r_power = 0;
-  I2CSRxDmaDesc->ctrlCfg.n_minus_1 = DMA_RX_COUNT - 1;
-  I2CSRxDmaDesc->ctrlCfg.next_useburst = 0;
-  I2CSRxDmaDesc->ctrlCfg.cycle_ctrl = 1; //  Basic DMA transfer  
+  I2CSRxDmaDesc->ctrlCfg.Bits.dst_inc = 0;   // no increment as the dest is a reg
+  I2CSRxDmaDesc->ctrlCfg.Bits.dst_size = 0;  // byte data
+  I2CSRxDmaDesc->ctrlCfg.Bits.src_inc = 3;   // byte incr. 
+  I2CSRxDmaDesc->ctrlCfg.Bits.src_size = 0;  // byte data
+  I2CSRxDmaDesc->ctrlCfg.Bits.dst_prot_ctrl = 0;
+  I2CSRxDmaDesc->ctrlCfg.Bits.src_prot_ctrl = 0;
+  I2CSRxDmaDesc->ctrlCfg.Bits.r_power = 0;
+  I2CSRxDmaDesc->ctrlCfg.Bits.n_minus_1 = DMA_RX_COUNT - 1;
+  I2CSRxDmaDesc->ctrlCfg.Bits.next_useburst = 0;
+  I2CSRxDmaDesc->ctrlCfg.Bits.cycle_ctrl = 1; //  Basic DMA transfer  
 
 // I2C slave transmit
   I2CSTxDmaDesc = &dmaChanDesc[4];	
   I2CSTxDmaDesc->srcEndPtr = (unsigned int)(ucTxBuffer + DMA_TX_COUNT -1 );
   I2CSTxDmaDesc->destEndPtr = (unsigned int) &pADI_I2C->I2CSTX; 
-  I2CSTxDmaDesc->ctrlCfg.dst_inc = 3;   // no increment as the dest is a reg
-  I2CSTxDmaDesc->ctrlCfg.dst_size = 0;  // byte data
-  I2CSTxDmaDesc->ctrlCfg.src_inc = 0;   // byte incr. 
-  I2CSTxDmaDesc->ctrlCfg.src_size = 0;  // byte data
-  I2CSTxDmaDesc->ctrlCfg.dst_prot_ctrl = 0;
-  I2CSTxDmaDesc->ctrlCfg.src_prot_ctrl = 0;
-  I2CSTxDmaDesc->ctrlCfg.r_power = 0;
-  I2CSTxDmaDesc->ctrlCfg.n_minus_1 = DMA_TX_COUNT - 1;
-  I2CSTxDmaDesc->ctrlCfg.next_useburst = 0;
-  I2CSTxDmaDesc->ctrlCfg.cycle_ctrl = 1; //  Basic DMA transfer  
+  I2CSTxDmaDesc->ctrlCfg.Bits.dst_inc = 3;   // no increment as the dest is a reg
+  I2CSTxDmaDesc->ctrlCfg.Bits.dst_size = 0;  // byte data
+  I2CSTxDmaDesc->ctrlCfg.Bits.src_inc = 0;   // byte incr. 
+  I2CSTxDmaDesc->ctrlCfg.Bits.src_size = 0;  // byte data
+  I2CSTxDmaDesc->ctrlCfg.Bits.dst_prot_ctrl = 0;
+  I2CSTxDmaDesc->ctrlCfg.Bits.src_prot_ctrl = 0;
+  I2CSTxDmaDesc->ctrlCfg.Bits.r_power = 0;
+  I2CSTxDmaDesc->ctrlCfg.Bits.n_minus_1 = DMA_TX_COUNT - 1;
+  I2CSTxDmaDesc->ctrlCfg.Bits.next_useburst = 0;
+  I2CSTxDmaDesc->ctrlCfg.Bits.cycle_ctrl = 1; //  Basic DMA transfer  
 
   I2cSCfg(I2CSCON_RXDMA|I2CSCON_TXDMA, 0, I2CSCON_SLV); // configure I2C Slave mode
   I2cSIDCfg(0xA0,0,0,0); // only using 1 address in this example
@@ -136,8 +107,8 @@ int main(void)
 ///////////////////////////////////////////////////////////////////////////
 void DMA_I2C0_SRX_Int_Handler ()
 {
-  I2CSRxDmaDesc->ctrlCfg.n_minus_1 = DMA_RX_COUNT - 1;
-  I2CSRxDmaDesc->ctrlCfg.cycle_ctrl = 1; //  Basic DMA transfer  
+  I2CSRxDmaDesc->ctrlCfg.Bits.n_minus_1 = DMA_RX_COUNT - 1;
+  I2CSRxDmaDesc->ctrlCfg.Bits.cycle_ctrl = 1; //  Basic DMA transfer  
   pADI_DMA->DMAENSET |= DMAENSET_I2CSRX; // Enable DMA channel  
 }
 
@@ -146,8 +117,8 @@ void DMA_I2C0_SRX_Int_Handler ()
 ///////////////////////////////////////////////////////////////////////////
 void DMA_I2C0_STX_Int_Handler ()
 {
-  I2CSTxDmaDesc->ctrlCfg.n_minus_1 = DMA_TX_COUNT - 1;
-  I2CSTxDmaDesc->ctrlCfg.cycle_ctrl = 1; //  Basic DMA transfer  
+  I2CSTxDmaDesc->ctrlCfg.Bits.n_minus_1 = DMA_TX_COUNT - 1;
+  I2CSTxDmaDesc->ctrlCfg.Bits.cycle_ctrl = 1; //  Basic DMA transfer  
   pADI_DMA->DMAENSET |= DMAENSET_I2CSTX; // Enable DMA channel
 }
 
@@ -0,0 +1,265 @@
+/**
+ *****************************************************************************
+   @example  ArqLoop.c
+   @brief    Host side loopback test of ArqLib over a lossy COBS link.
+   - Runs on a PC, not on the ADuCM360.
+   - Connects a sending link set up as in FW_TX to a receiving link set up
+     as in FW_RX through two simulated serial lines, one each way, run in
+     1 ms ticks at the baud rate given with 8 data bits, parity and one
+     stop bit.
+   - Each frame put on either line is dropped or has one byte corrupted at
+     the rates given. Corrupted frames are dropped by the CRC of CobsLib.
+   - Every payload carries its index, the receiver checks that each one
+     arrives once, whole and in order. Prints the goodput, payload bytes
+     delivered per second, against the line rate.
+   - Build and run:
+        gcc -O2 -I../../common -o ArqLoop ArqLoop.c ../../common/ArqLib.c
+            ../../common/CobsLib.c
+        ./ArqLoop [drop %] [corrupt %] [payloads] [baud] [timeout ms]
+     for example ./ArqLoop 5 5 1000 1200 2000 for the FW_TX settings with
+     one frame in ten lost.
+
+   @version V0.1
+   @author  ADI
+   @date    October 2026
+
+   @par     Revision History:
+   - V0.1, October 2026: initial version.
+
+All files for ADuCM360/361 provided by ADI, including this file, are
+provided  as is without warranty of any kind, either expressed or implied.
+The user assumes any and all risk from the use of this code.
+It is the responsibility of the person integrating this code into an application
+to ensure that the resulting application performs as required and is safe.
+
+**/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "ArqLib.h"
+
+#define CHAR_BITS	11                     // Start, 8 data, parity and stop bit
+#define LINE_SIZE	65536                  // Bytes a simulated line can hold
+#define FRAME_SIZE	(ARQ_MAX+4)            // ARQ header, payload and CRC
+#define TICK_MAX	100000000L             // Gives up after this many ms
+
+// One direction of the serial link
+typedef struct
+{
+   unsigned char aucBuf[LINE_SIZE];        // Bytes on the line, oldest first
+   int iHead;
+   int iTail;
+   long lCredit;                           // Bit times owed, times 1000
+   unsigned char aucFrame[LINE_SIZE];      // Frame being written by the link
+   int iFrameLen;
+   long lFrames;                           // Frames put on the line
+   long lDrop;                             // Frames dropped
+   long lCorrupt;                          // Frames with a byte corrupted
+} Line;
+
+static Line LineTx;                        // Data, sender to receiver
+static Line LineRx;                        // ACKs, receiver to sender
+static ArqLink Tx;
+static ArqLink Rx;
+static CobsDec DecTx, DecRx;
+static unsigned char aucDecTx[FRAME_SIZE];
+static unsigned char aucDecRx[FRAME_SIZE];
+
+static int iDropPct;
+static int iCorruptPct;
+static unsigned int uiRand = 0x1234567;
+static long lDelivered;                    // Payloads delivered in order
+static long lBytes;                        // Payload bytes delivered
+static long lBad;                          // Frames dropped by the decoders
+static int iErr;
+
+static unsigned int Rand(void);
+static void LineWr(Line *pLine, const unsigned char *pucData, int iLen);
+static int LineRun(Line *pLine, int iBaud, CobsDec *pDec, ArqLink *pLink);
+static void WrTx(const unsigned char *pucData, int iLen);
+static void WrRx(const unsigned char *pucData, int iLen);
+static void RxPayload(const unsigned char *pucData, int iLen);
+static void MakePayload(long lIdx, unsigned char *pucData);
+
+int main(int argc, char *argv[])
+{
+   unsigned char aucPay[ARQ_MAX];
+   long lPayloads = 1000;
+   long lSent = 0;
+   long lTick;
+   int iBaud = 1200;
+   int iTimeout = 2000;
+
+   if(argc > 1)
+      iDropPct = atoi(argv[1]);
+   if(argc > 2)
+      iCorruptPct = atoi(argv[2]);
+   if(argc > 3)
+      lPayloads = atol(argv[3]);
+   if(argc > 4)
+      iBaud = atoi(argv[4]);
+   if(argc > 5)
+      iTimeout = atoi(argv[5]);
+   if((iBaud <= 0) || (iTimeout <= 0) || (lPayloads <= 0))
+   {
+      printf("usage: ArqLoop [drop %%] [corrupt %%] [payloads] [baud] [timeout ms]\n");
+      return 1;
+   }
+
+   ArqInit(&Tx, WrTx, 0, iTimeout);        // As FW_TX
+   ArqInit(&Rx, WrRx, RxPayload, 1);       // As FW_RX, only acknowledges
+   CobsDecInit(&DecTx, aucDecTx, sizeof(aucDecTx));
+   CobsDecInit(&DecRx, aucDecRx, sizeof(aucDecRx));
+
+   for(lTick=0; (lTick < TICK_MAX) && !iErr; lTick++)
+   {
+      if((lDelivered == lPayloads) && (ArqFree(&Tx) == ARQ_WIN))
+         break;
+      ArqTick(&Tx);                        // 1 ms timer interrupt
+      ArqTick(&Rx);
+      LineRun(&LineTx, iBaud, &DecRx, &Rx);
+      LineRun(&LineRx, iBaud, &DecTx, &Tx);
+      ArqPoll(&Rx);
+      ArqPoll(&Tx);
+      while(lSent < lPayloads)
+      {
+         MakePayload(lSent, aucPay);
+         if(!ArqSend(&Tx, aucPay, ARQ_MAX))
+            break;
+         lSent++;
+      }
+   }
+
+   printf("%ld of %ld payloads of %d bytes delivered in order in %.1f s\n",
+          lDelivered, lPayloads, ARQ_MAX, lTick/1000.0);
+   printf("data line: %ld frames, %ld dropped, %ld corrupted\n",
+          LineTx.lFrames, LineTx.lDrop, LineTx.lCorrupt);
+   printf("ACK line:  %ld frames, %ld dropped, %ld corrupted\n",
+          LineRx.lFrames, LineRx.lDrop, LineRx.lCorrupt);
+   printf("sent %u, resent %u, duplicates %u, bad frames %ld\n",
+          Tx.uiTx, Tx.uiRetx, Rx.uiDup, lBad);
+   if(lTick)
+      printf("goodput %.1f bytes/s, %.1f %% of the %d bytes/s line rate\n",
+             lBytes*1000.0/lTick, lBytes*1000.0*CHAR_BITS*100/((double)lTick*iBaud),
+             iBaud/CHAR_BITS);
+   if(iErr || (lDelivered != lPayloads))
+   {
+      printf("FAIL\n");
+      return 1;
+   }
+   printf("PASS\n");
+   return 0;
+}
+
+// xorshift32, the same run for the same arguments
+static unsigned int Rand(void)
+{
+   uiRand ^= uiRand << 13;
+   uiRand ^= uiRand >> 17;
+   uiRand ^= uiRand << 5;
+   return uiRand;
+}
+
+// Collects bytes from the encoder, each delimiter puts a frame on the line
+static void LineWr(Line *pLine, const unsigned char *pucData, int iLen)
+{
+   int iPos;
+   int i1;
+
+   for(i1=0; i1<iLen; i1++)
+   {
+      pLine->aucFrame[pLine->iFrameLen++] = pucData[i1];
+      if(pucData[i1] != 0)
+         continue;
+      pLine->lFrames++;
+      if((int)(Rand()%100) < iDropPct)
+      {
+         pLine->lDrop++;
+         pLine->iFrameLen = 0;
+         continue;
+      }
+      if(((int)(Rand()%100) < iCorruptPct) && (pLine->iFrameLen > 1))
+      {
+         iPos = Rand() % (pLine->iFrameLen-1);   // Not the delimiter
+         pLine->aucFrame[iPos] ^= 1 + Rand()%255;
+         pLine->lCorrupt++;
+      }
+      for(iPos=0; iPos<pLine->iFrameLen; iPos++)
+      {
+         pLine->aucBuf[pLine->iHead] = pLine->aucFrame[iPos];
+         pLine->iHead = (pLine->iHead+1) % LINE_SIZE;
+         if(pLine->iHead == pLine->iTail)
+         {
+            printf("line overflow\n");
+            iErr = 1;
+         }
+      }
+      pLine->iFrameLen = 0;
+   }
+}
+
+// Moves the bytes one ms of line time allows to the decoder of the far end
+static int LineRun(Line *pLine, int iBaud, CobsDec *pDec, ArqLink *pLink)
+{
+   int iCnt = 0;
+   int iLen;
+
+   pLine->lCredit += iBaud;
+   while((pLine->lCredit >= CHAR_BITS*1000L) && (pLine->iTail != pLine->iHead))
+   {
+      pLine->lCredit -= CHAR_BITS*1000L;
+      iLen = CobsDecPut(pDec, pLine->aucBuf[pLine->iTail]);
+      pLine->iTail = (pLine->iTail+1) % LINE_SIZE;
+      if(iLen == COBS_ERR)
+         lBad++;
+      else if(iLen > 0)
+         ArqRx(pLink, pDec->pucBuf, iLen);
+      iCnt++;
+   }
+   if(pLine->iTail == pLine->iHead)
+      pLine->lCredit = 0;                  // Idle line, no credit builds up
+   return iCnt;
+}
+
+static void WrTx(const unsigned char *pucData, int iLen)
+{
+   LineWr(&LineTx, pucData, iLen);
+}
+
+static void WrRx(const unsigned char *pucData, int iLen)
+{
+   LineWr(&LineRx, pucData, iLen);
+}
+
+// Checks each payload is the next one, byte for byte
+static void RxPayload(const unsigned char *pucData, int iLen)
+{
+   unsigned char aucExp[ARQ_MAX];
+   int i1;
+
+   MakePayload(lDelivered, aucExp);
+   if(iLen != ARQ_MAX)
+      iErr = 1;
+   for(i1=0; (i1<iLen) && (i1<ARQ_MAX); i1++)
+      if(pucData[i1] != aucExp[i1])
+         iErr = 1;
+   if(iErr)
+   {
+      printf("payload %ld wrong or out of order\n", lDelivered);
+      return;
+   }
+   lDelivered++;
+   lBytes += iLen;
+}
+
+// Index in the first 4 bytes, then a pattern that includes zeros
+static void MakePayload(long lIdx, unsigned char *pucData)
+{
+   int i1;
+
+   for(i1=0; i1<4; i1++)
+      pucData[i1] = lIdx >> (8*i1);
+   for(i1=4; i1<ARQ_MAX; i1++)
+      pucData[i1] = lIdx*7 + i1;
+}
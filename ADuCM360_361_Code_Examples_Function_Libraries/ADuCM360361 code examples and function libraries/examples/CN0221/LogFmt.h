@@ -0,0 +1,33 @@
+/**
+ *****************************************************************************
+   @file     LogFmt.h
+   @brief    Format table of the records Thermocouple_to_UART.c logs.
+   - Included by Thermocouple_to_UART.c to number the formats and by the
+     host decoder LogDec.c to print them. Add new formats at the end so
+     decoders built for older firmware still print the existing ones.
+
+   @version V0.1
+   @author  ADI
+   @date    October 2026
+
+   @par     Revision History:
+   - V0.1, October 2026: initial version.
+
+All files for ADuCM360/361 provided by ADI, including this file, are
+provided  as is without warranty of any kind, either expressed or implied.
+The user assumes any and all risk from the use of this code.
+It is the responsibility of the person integrating this code into an application
+to ensure that the resulting application performs as required and is safe.
+
+**/
+
+LOG_FMT(LOG_START,      "Program Started. Please wait for the first temperature result\r\n")
+LOG_FMT(LOG_ADC0_ERR,   "ADC error on ADC0  \r\n")
+LOG_FMT(LOG_ADC1_ERR,   "ADC error on ADC1  \r\n")
+LOG_FMT(LOG_ZERO_CAL,   "Set Zero Scale Voltage - Press return when ready \r\n")
+LOG_FMT(LOG_FULL_CAL,   "Set Full Scale Voltage - Press return when ready \r\n")
+LOG_FMT(LOG_RTD_R,      "RTD Resistance: %fOhms \r\n")
+LOG_FMT(LOG_RTD_T,      "RTD Temperature: %fC \r\n")
+LOG_FMT(LOG_CJ_V,       "Cold Junction Voltage: %fmV \r\n")
+LOG_FMT(LOG_TC_V,       "Thermoucouple Voltage: %fmV \r\n")
+LOG_FMT(LOG_FINAL_T,    "Final Temperature: %fC \r\n\n\n\n")
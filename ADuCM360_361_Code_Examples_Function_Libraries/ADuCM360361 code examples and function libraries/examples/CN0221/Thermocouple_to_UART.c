@@ -5,17 +5,24 @@
    - The RTD connected to AIN0/AIN1 will be used for Cold Junction compensation.
    - This file will measure the thermocouple/RTD inputs and send the measured voltages and
      temperature to the UART (9600 baud by default).
+   - Results are logged as binary records with LogLib, read them on a PC with
+     examples/LogDec built with LOG_FMT_FILE set to CN0221/LogFmt.h.
    - For this simple example, the internal reference will used for the thermocouple measurement
      and a precision 5k6 resistor as the reference for the RTD
 
-   @version V0.2
+   @version V0.4
    @author  ADI
-   @date    February 2013
+   @date    October 2026
 
    @par     Revision History:
    - V0.1, September 2012: initial version. 
    - V0.2, February 2013: Fixed a bug in SendString().
                           Corrected C_cold_junctionN variable.
+   - V0.3, October 2026: Log results with LogWr1() instead of sprintf() and
+                         SendString(), records are sent from the main loop by
+                         LogPoll() through the UART transmit ring.
+   - V0.4, October 2026: CalculateColdJVoltage() finds the segment of a
+                         negative cold junction temperature from t, not j.
 
 All files for ADuCM360/361 provided by ADI, including this file, are
 provided  as is without warranty of any kind, either expressed or implied.
@@ -25,8 +32,6 @@ to ensure that the resulting application performs as required and is safe.
 
 **/
 
-#include <stdio.h>
-#include <string.h>
 #include <ADuCM360.h>
 #include "FlashEraseWrite.h"
 
@@ -40,6 +45,14 @@ to ensure that the resulting application performs as required and is safe.
 #include <..\common\AdcLib.h>
 #include <..\common\DacLib.h>
 #include <..\common\RstLib.h>
+#include <..\common\RingLib.h>
+#include <..\common\LogLib.h>
+
+enum {
+#define LOG_FMT(eId, szFmt)	eId,
+#include "LogFmt.h"
+#undef LOG_FMT
+};
 
 
 #define calibrateADC1	0		// Set to 0 if you don't want to calibrate
@@ -116,7 +129,6 @@ void ADC1INIT(void);									// Init ADC1
 void UARTInit(void);			            // Enables UART
 void IEXCINIT(void);	                // Setup Excitation Current sources
 void delay(long int);								  // Simple delay function
-void SendString(void);								// Transmit string using UART
 void SystemZeroCalibration(void);			// Calibrate using external inputs
 void SystemFullCalibration(void);			// Calibrate using external inputs
 float CalculateRTDTemp(float r);			// returns RTD Temperature reading
@@ -124,13 +136,15 @@ float CalculateThermoCoupleTemp(float v);		// returns Thermocouple Temperature r
 float CalculateColdJVoltage(float t);	// converts cold junction temperature to an equvalent thermocouple voltage
 void ADC1RTDCfg(void);                // RTD ADC1 settings
 void ADC1ThermocoupleCfg(void);       // Tc ADC1 settings
-void SendString(void);					// Transmit string using UART
-void SendResultToUART(void);			// Send measurement results to UART - in ASCII String format
+void SendResultToUART(void);			// Log measurement results, sent to the UART by LogPoll()
+void RxByte(int iByte);					// Called by UrtBufInt() for each byte received
+int LogOut(const unsigned char *pucData, int iLen);	// Output for LogPoll()
 
 volatile unsigned char bSendResultToUART = 0;	// Flag used to indicate ADC1 result ready to send to UART
 volatile unsigned char ucComRx = 0;		// variable that ComRx is read into in UART IRQ
-unsigned char szTemp[64] = "";				// Used to store string before printing to UART
-unsigned char ucTxBufferEmpty  = 0;		// Used to indicate that the UART Tx buffer is empty
+unsigned char ucTxRingBuf[256];				// Storage for the UART transmit ring
+RingBuf UartTxRing;							// Drained by the THRE interrupt
+unsigned long ulLogBuf[64];					// Log records waiting for LogPoll()
 volatile  long ulADC1DATThermocouple[SAMPLENO];	// Variable that ADC1DAT is read into when sampling TC
 volatile  long ulADC1DATRtd[SAMPLENO];// Variable that ADC1DAT is read into when sampling RTD
 unsigned long ulADC1CONThermocouple;	// used to set ADC1CON which sets channel to thermocouple
@@ -159,8 +173,6 @@ float fFinalVoltage = 0.0;						// fFinalVoltage = thermocouple voltage + cold j
 float fTThermocouple = 0.0;					  // thermoucouple temperature
 float fTRTD = 0.0;										// RTD temperature
 float fFinalTemp = 0.0;								// Final temperature including cold j compensation
-unsigned char nLen = 0;								// Used for sending strings to UART
-unsigned char i = 0;									// counter used in SendString()
 unsigned char ucCounter = 0;
 
 int main (void)
@@ -182,15 +194,13 @@ int main (void)
 	ADC1INIT();								                                      // Init ADC1
 	IEXCINIT();																										  // Init IEXC0 for 200uA on AIN5
 	NVIC_EnableIRQ(ADC1_IRQn);					                            // Flash/UART/ADC1 IRQ
-	sprintf ( (char*)szTemp, "Program Started. Please wait for the first temperature result\r\n");
-	nLen = strlen((char*)szTemp);
-	if (nLen <64)
- 		SendString();
+	LogWr0(LOG_START);
 
 	fVolts	= (1.2 / 268435456);			// Internal reference	
 	while(1)
 	{
 		delay(0x1FFFFF);
+		LogPoll();														// Send logged records while the ring has room
 		if(bSendResultToUART == 1)
 		{
 			fVThermocouple = 0;
@@ -214,14 +224,9 @@ int main (void)
 		if (ucADCERR != 0)
 		{
 		   if (ucADCERR == 1)
-		   		sprintf ( (char*)szTemp, "ADC error on ADC0  \r\n");// Send error message to UART  
+		   		LogWr0(LOG_ADC0_ERR);									// Send error message to UART
 			if (ucADCERR == 2)
-		   		sprintf ( (char*)szTemp, "ADC error on ADC1  \r\n");// Send error message to UART
-		   if ((ucADCERR == 1) | (ucADCERR == 2))                          
-			{	nLen = strlen((char*)szTemp);
-			  	if (nLen <64)
-		 			SendString();
-	      }
+		   		LogWr0(LOG_ADC1_ERR);									// Send error message to UART
 			ucADCERR = 0;
 	   }
 	}
@@ -292,7 +297,7 @@ float CalculateColdJVoltage(float t)
 	}
 	else if (t < 0)
 	{
-		j=(j - COLDJ_T_MIN_N) / COLDJ_T_SEG_N;				// determine which coefficient to use
+		j=(t - COLDJ_T_MIN_N) / COLDJ_T_SEG_N;				// determine which coefficient to use
 		if (j>COLDJ_N_SEG_N-1)    							// if input is over-range..
     		j=COLDJ_N_SEG_N-1;         						// ..then use highest coefficients
 
@@ -305,12 +310,11 @@ float CalculateColdJVoltage(float t)
 void SystemZeroCalibration(void)
 {
 	ucWaitForUart = 1;
-	sprintf ( (char*)szTemp, "Set Zero Scale Voltage - Press return when ready \r\n");                         
-	nLen = strlen((char*)szTemp);
- 	if (nLen <64)
-		 	SendString();
+	LogWr0(LOG_ZERO_CAL);
 	while (ucWaitForUart == 1)
-	{}
+	{
+		LogPoll();
+	}
 	AdcGo(pADI_ADC1,ADCMDE_ADCMD_SYSOCAL);	// ADC1 System Zero scale calibration
 	while ((AdcSta(pADI_ADC1) &0x20) != 0x20)			// bit 5 set by adc when calibration is complete
 	{}
@@ -318,12 +322,11 @@ void SystemZeroCalibration(void)
 void SystemFullCalibration(void)
 {
 	ucWaitForUart = 1;
-	sprintf ( (char*)szTemp, "Set Full Scale Voltage - Press return when ready \r\n");                         
-	nLen = strlen((char*)szTemp);
- 	if (nLen <64)
-		 	SendString();
+	LogWr0(LOG_FULL_CAL);
 	while (ucWaitForUart == 1)
-	{}
+	{
+		LogPoll();
+	}
 	AdcGo(pADI_ADC0,ADCMDE_ADCMD_SYSGCAL);							// ADC1 System Full scale calibration
 	while ((AdcSta(pADI_ADC1) &0x20) != 0x20)			// bit 5 set by adc when calibration is complete
 	{}
@@ -367,7 +370,10 @@ void UARTInit(void)
 {
    UrtCfg(pADI_UART,B9600,COMLCR_WLS_8BITS,0);   // setup baud rate for 9600, 8-bits
    UrtMod(pADI_UART,COMMCR_DTR,0);  			  // Setup modem bits
-   UrtIntCfg(pADI_UART,COMIEN_ERBFI|COMIEN_ETBEI|COMIEN_ELSI|COMIEN_EDSSI|COMIEN_EDMAT|COMIEN_EDMAR);  // Setup UART IRQ sources
+   RingInit(&UartTxRing, ucTxRingBuf, sizeof(ucTxRingBuf));
+   UrtBufCfg(pADI_UART,&UartTxRing,0);			  // Setup UART IRQ sources and Tx ring
+   UrtBufRxFn(pADI_UART,RxByte);				  // Pass received bytes to RxByte()
+   LogCfg(ulLogBuf,64,LogOut);					  // Log records leave through the Tx ring
    DioPul(pADI_GP0,0xFF);								              // Enable pullup on P0.7/0.6
    DioCfg(pADI_GP0,0x3C);								              // Configure P0.2/P0.1 for UART
 }
@@ -385,48 +391,23 @@ void delay (long int length)
 
     	length--;
 }
-void SendString (void)
+int LogOut(const unsigned char *pucData, int iLen)
 {
-   for ( i = 0 ; i < nLen ; i++ )	// loop to send ADC0 result
-	{
-  		 ucTxBufferEmpty = 0;
-		 UrtTx(pADI_UART,szTemp[i]);
-  		 while (ucTxBufferEmpty == 0)
-  		 {
-  		 }
-	}
-} 
+   return UrtBufWr(pADI_UART,pucData,iLen);	// Takes what fits, LogPoll() sends the rest later
+}
+void RxByte(int iByte)
+{
+   ucComRx = iByte;
+   ucWaitForUart = 0;
+}
 void SendResultToUART(void)
 {
-    sprintf ( (char*)szTemp, "RTD Resistance: %fOhms \r\n",fRrtd );                          
-    nLen = strlen((char*)szTemp);
-    if (nLen <64)
-            SendString();
-    
-    sprintf ( (char*)szTemp, "RTD Temperature: %fC \r\n",fTRTD );// Send the Result to the UART                          
-    nLen = strlen((char*)szTemp);
-    if (nLen <64)
-            SendString();
-    
-    sprintf ( (char*)szTemp, "Cold Junction Voltage: %fmV \r\n",(fColdJVolt*1000) );// Send the Result to the UART                          
-    nLen = strlen((char*)szTemp);
-    if (nLen <64)
-            SendString();
-    
-    sprintf ( (char*)szTemp, "Thermoucouple Voltage: %fmV \r\n",(fVThermocouple*1000) );// Send the Result to the UART                          
-    nLen = strlen((char*)szTemp);
-    if (nLen <64)
-            SendString();
-
-    /*sprintf ( (char*)szTemp, "TC Temperature: %fC \r\n",fTThermocouple );// Used for evaluating TC                          
-    nLen = strlen((char*)szTemp);
-    if (nLen <64)
-            SendString();*/ 
-    
-    sprintf ( (char*)szTemp, "Final Temperature: %fC \r\n\n\n\n",fFinalTemp );// Send the Result to the UART                          
-    nLen = strlen((char*)szTemp);
-    if (nLen <64)
-            SendString();
+    LogWr1(LOG_RTD_R,LogFlt(fRrtd));
+    LogWr1(LOG_RTD_T,LogFlt(fTRTD));
+    LogWr1(LOG_CJ_V,LogFlt(fColdJVolt*1000));
+    LogWr1(LOG_TC_V,LogFlt(fVThermocouple*1000));
+    //LogWr1(LOG_TC_T,LogFlt(fTThermocouple));	// Used for evaluating TC, add LOG_TC_T to LogFmt.h
+    LogWr1(LOG_FINAL_T,LogFlt(fFinalTemp));
 }
 void ExtIntEnable(void) 
 {
@@ -584,20 +565,7 @@ void Flsh_Int_Handler ()
 }   
 void UART_Int_Handler ()
 {
-   volatile unsigned char ucCOMSTA0 = 0;
-	volatile unsigned char ucCOMIID0 = 0;
-	
-	ucCOMSTA0 = UrtLinSta(pADI_UART);			// Read Line Status register
-	ucCOMIID0 = UrtIntSta(pADI_UART);			// Read UART Interrupt ID register
-	if ((ucCOMIID0 & 0x2) == 0x2)	  			// Transmit buffer empty
-	{
-	  ucTxBufferEmpty = 1;
-	}
-	if ((ucCOMIID0 & 0x4) == 0x4)	  			// Receive byte
-	{
-		ucComRx	= UrtRx(pADI_UART);
-		ucWaitForUart = 0;
-	}
+   UrtBufInt(pADI_UART);						// Feed COMTX and pass received bytes to RxByte()
 } 
 void SPI0_Int_Handler ()
 {
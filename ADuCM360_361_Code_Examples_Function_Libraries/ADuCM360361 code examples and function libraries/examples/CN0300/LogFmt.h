@@ -0,0 +1,45 @@
+/**
+ *****************************************************************************
+   @file     LogFmt.h
+   @brief    Format table of the records Thermocouple_to_DAC.c logs.
+   - Included by Thermocouple_to_DAC.c to number the formats and by the
+     host decoder LogDec.c to print them. Add new formats at the end so
+     decoders built for older firmware still print the existing ones.
+
+   @version V0.1
+   @author  ADI
+   @date    October 2026
+
+   @par     Revision History:
+   - V0.1, October 2026: initial version.
+
+All files for ADuCM360/361 provided by ADI, including this file, are
+provided  as is without warranty of any kind, either expressed or implied.
+The user assumes any and all risk from the use of this code.
+It is the responsibility of the person integrating this code into an application
+to ensure that the resulting application performs as required and is safe.
+
+**/
+
+LOG_FMT(LOG_START,      "Program Started. Please wait for the first temperature result\r\n")
+LOG_FMT(LOG_ADC0_ERR,   "ADC error on ADC0  \r\n")
+LOG_FMT(LOG_ADC1_ERR,   "ADC error on ADC1  \r\n")
+LOG_FMT(LOG_ZERO_CAL,   "Set Zero Scale Voltage - Press return when ready \r\n")
+LOG_FMT(LOG_FULL_CAL,   "Set Full Scale Voltage - Press return when ready \r\n")
+LOG_FMT(LOG_DAC_4MA,    "DAC Calibration Routine - calibrate to 4mA \r\n")
+LOG_FMT(LOG_DAC_20MA,   "DAC Calibration Routine - calibrate to 20mA \r\n")
+LOG_FMT(LOG_DAC_UP,     "Press 1 to increase Output current - Press return when ready \r\n")
+LOG_FMT(LOG_DAC_DOWN,   "Press 0 to Decrease Output current - Press return when ready \r\n")
+LOG_FMT(LOG_DAC_DONE,   "Press return when Complete - Press return when ready \r\n")
+LOG_FMT(LOG_DAC_DONE3,  "Press return when Complete - Press return when ready \r\n\n\n")
+LOG_FMT(LOG_AIN9_4MA,   "4mA AIN9 voltage: %d \r\n")
+LOG_FMT(LOG_AIN9_20MA,  "20mA AIN9 voltage: %d \r\n")
+LOG_FMT(LOG_RTD_R,      "RTD Resistance: %fOhms \r\n")
+LOG_FMT(LOG_RTD_T,      "RTD Temperature: %fC \r\n")
+LOG_FMT(LOG_CJ_V,       "Cold Junction Voltage: %fmV \r\n")
+LOG_FMT(LOG_TC_V,       "Thermoucouple Voltage: %fmV \r\n")
+LOG_FMT(LOG_DAC_I,      "Expected DAC Current: %fmA \r\n")
+LOG_FMT(LOG_FINAL_T,    "Final Temperature: %fC \r\n")
+LOG_FMT(LOG_AIN9_EXP,   "Expected AIN9 Voltage: %fV \r\n")
+LOG_FMT(LOG_DAC_ADJ,    "Number of DAC codes changed: %d \r\n")
+LOG_FMT(LOG_AIN9_V,     "AIN9 Voltage: %fV \r\n\n\n\n")
@@ -0,0 +1,623 @@
+// Generated by examples/TempGen from the tables of TempCalc.c, NIST ITS-90
+// and IEC 60751, do not edit. Included by TempCalc.c only.
+#ifndef TEMPTAB_H
+#define TEMPTAB_H
+
+// TEMP_ENG_TAB
+
+// Thermocouple from 0, microvolts to millidegrees
+static const FixSegPt TcPTabSeg[30] = {
+   {  855381814,        0},
+   {  828164062,      482},
+   {  803725764,     1347},
+   {  781767375,     2514},
+   {  762006539,     3913},
+   {  744177868,     5491},
+   {  728066293,     7202},
+   {  713462781,     9012},
+   {  700159591,    10895},
+   {  688013199,    12831},
+   {  676885257,    14800},
+   {  666602502,    16803},
+   {  657112783,    18818},
+   {  648299732,    20847},
+   {  640109043,    22876},
+   {  632369177,    24931},
+   {  625137889,    26980},
+   {  618303120,    29036},
+   {  611862283,    31089},
+   {  605761934,    33140},
+   {  599999488,    35180},
+   {  594518915,    37218},
+   {  589322801,    39241},
+   {  584407697,    41242},
+   {  579718437,    43235},
+   {  575368803,    45160},
+   {  571132953,    47109},
+   {  567176389,    49000},
+   {  563393949,    50875},
+   {  559777012,    52732}
+};
+static const FixSegTab TcPTab = {0, 7230949u, 30, 25, TcPTabSeg};
+
+// Thermocouple below 0, microvolts to millidegrees
+static const FixSegPt TcNTabSeg[20] = {
+   {  990643698,  -199964},
+   {  885182481,  -198202},
+   {  806552147,  -195577},
+   {  746545893,  -192571},
+   {  699595046,  -189435},
+   {  661566504,  -186259},
+   {  629707000,  -183067},
+   {  602350684,  -179870},
+   {  578474103,  -176680},
+   {  557454050,  -173521},
+   {  538919065,  -170426},
+   {  522587928,  -167427},
+   {  508179190,  -164539},
+   {  495321621,  -161748},
+   {  483625715,  -159014},
+   {  472720471,  -156283},
+   {  462324212,  -153505},
+   {  452466750,  -150707},
+   {  443683255,  -148067},
+   {  437253843,  -146027}
+};
+static const FixSegTab TcNTab = {-5603, 15330955u, 20, 24, TcNTabSeg};
+
+// Cold junction from 0, millidegrees to microvolts
+static const FixSegPt CjPTabSeg[20] = {
+   {  669327688,        0},
+   {  677299159,       -2},
+   {  685545554,       -8},
+   {  694616392,      -18},
+   {  703412634,      -31},
+   {  712758395,      -48},
+   {  721829233,      -68},
+   {  730900726,      -91},
+   {  740246159,     -118},
+   {  749316997,     -148},
+   {  758113239,     -180},
+   {  766634230,     -214},
+   {  775431127,     -252},
+   {  783676867,     -291},
+   {  791648010,     -332},
+   {  799895060,     -377},
+   {  807590953,     -422},
+   {  815287501,     -469},
+   {  822985359,     -520},
+   {  830131405,     -569}
+};
+static const FixSegTab CjPTab = {0, 687194u, 20, 34, CjPTabSeg};
+
+// Cold junction below 0, millidegrees to microvolts
+static const FixSegPt CjNTabSeg[10] = {
+   {  603443200,    -1475},
+   {  609885184,    -1476},
+   {  616757248,    -1479},
+   {  624058880,    -1484},
+   {  630501120,    -1490},
+   {  636943616,    -1498},
+   {  643815552,    -1507},
+   {  650258048,    -1518},
+   {  656700544,    -1530},
+   {  662713472,    -1543}
+};
+static const FixSegTab CjNTab = {-40000, 1073741u, 10, 34, CjNTabSeg};
+
+// RTD, milliohms to millidegrees
+static const FixSegPt RtdTabSeg[30] = {
+   {  678888135,   -40002},
+   {  680101871,   -40011},
+   {  681278220,   -40030},
+   {  682441544,   -40058},
+   {  683579662,   -40094},
+   {  684715368,   -40139},
+   {  685828220,   -40191},
+   {  686934710,   -40253},
+   {  688038698,   -40322},
+   {  689150254,   -40402},
+   {  690269558,   -40490},
+   {  691382229,   -40587},
+   {  692520468,   -40695},
+   {  693646164,   -40811},
+   {  694783920,   -40937},
+   {  695934943,   -41073},
+   {  697085483,   -41219},
+   {  698236506,   -41373},
+   {  699387046,   -41537},
+   {  700563153,   -41714},
+   {  701739743,   -41900},
+   {  702915851,   -42095},
+   {  704103537,   -42302},
+   {  705293152,   -42518},
+   {  706481802,   -42744},
+   {  707733165,   -42991},
+   {  708808932,   -43212},
+   {  710199228,   -43509},
+   {  711337708,   -43761},
+   {  712476188,   -44022}
+};
+static const FixSegTab RtdTab = {84270, 2023360u, 30, 28, RtdTabSeg};
+
+// TEMP_ENG_FINE
+
+// Thermocouple from 0, microvolts to millidegrees
+static const FixSegPt TcPFineSeg[128] = {
+   {  863250051,        0},
+   {  857686431,       24},
+   {  851963244,       71},
+   {  846135578,      144},
+   {  840250358,      241},
+   {  834347129,      364},
+   {  828458854,      510},
+   {  822612686,      680},
+   {  816830705,      872},
+   {  811130593,     1085},
+   {  805526249,     1317},
+   {  800028344,     1568},
+   {  794644807,     1836},
+   {  789381259,     2120},
+   {  784241386,     2419},
+   {  779227265,     2731},
+   {  774339646,     3055},
+   {  769578189,     3391},
+   {  764941673,     3737},
+   {  760428170,     4093},
+   {  756035192,     4458},
+   {  751759818,     4830},
+   {  747598800,     5210},
+   {  743548651,     5596},
+   {  739605719,     5989},
+   {  735766247,     6387},
+   {  732026431,     6791},
+   {  728382454,     7199},
+   {  724830524,     7611},
+   {  721366905,     8028},
+   {  717987935,     8449},
+   {  714690046,     8873},
+   {  711469780,     9300},
+   {  708323797,     9731},
+   {  705248883,    10165},
+   {  702241956,    10601},
+   {  699300073,    11041},
+   {  696420425,    11483},
+   {  693600344,    11927},
+   {  690837299,    12375},
+   {  688128895,    12824},
+   {  685472871,    13276},
+   {  682867095,    13730},
+   {  680309564,    14186},
+   {  677798396,    14645},
+   {  675331829,    15105},
+   {  672908212,    15568},
+   {  670526005,    16032},
+   {  668183771,    16499},
+   {  665880171,    16967},
+   {  663613961,    17437},
+   {  661383982,    17909},
+   {  659189161,    18382},
+   {  657028501,    18857},
+   {  654901078,    19334},
+   {  652806037,    19812},
+   {  650742585,    20291},
+   {  648709986,    20772},
+   {  646707560,    21254},
+   {  644734674,    21737},
+   {  642790741,    22221},
+   {  640875215,    22706},
+   {  638987585,    23191},
+   {  637127374,    23677},
+   {  635294135,    24164},
+   {  633487446,    24651},
+   {  631706908,    25139},
+   {  629952140,    25627},
+   {  628222779,    26115},
+   {  626518477,    26602},
+   {  624838894,    27090},
+   {  623183701,    27578},
+   {  621552576,    28065},
+   {  619945200,    28552},
+   {  618361258,    29038},
+   {  616800435,    29524},
+   {  615262415,    30009},
+   {  613746882,    30493},
+   {  612253514,    30976},
+   {  610781987,    31458},
+   {  609331968,    31940},
+   {  607903121,    32420},
+   {  606495101,    32899},
+   {  605107556,    33377},
+   {  603740125,    33853},
+   {  602392439,    34328},
+   {  601064121,    34802},
+   {  599754784,    35275},
+   {  598464033,    35746},
+   {  597191462,    36216},
+   {  595936660,    36685},
+   {  594699205,    37152},
+   {  593478669,    37618},
+   {  592274617,    38082},
+   {  591086605,    38546},
+   {  589914188,    39008},
+   {  588756912,    39469},
+   {  587614321,    39928},
+   {  586485957,    40387},
+   {  585371360,    40845},
+   {  584270069,    41302},
+   {  583181626,    41758},
+   {  582105574,    42213},
+   {  581041463,    42668},
+   {  579988846,    43122},
+   {  578947286,    43576},
+   {  577916355,    44029},
+   {  576895638,    44483},
+   {  575884731,    44935},
+   {  574883249,    45388},
+   {  573890823,    45841},
+   {  572907107,    46294},
+   {  571931775,    46748},
+   {  570964529,    47201},
+   {  570005099,    47655},
+   {  569053243,    48109},
+   {  568108755,    48563},
+   {  567171465,    49018},
+   {  566241242,    49474},
+   {  565317994,    49930},
+   {  564401679,    50386},
+   {  563492300,    50842},
+   {  562589912,    51299},
+   {  561694623,    51756},
+   {  560806600,    52213},
+   {  559926071,    52669},
+   {  559053328,    53126},
+   {  558188730,    53581}
+};
+static const FixSegTab TcPFine = {0, 30852225u, 128, 25, TcPFineSeg};
+
+// Thermocouple below 0, microvolts to millidegrees
+static const FixSegPt TcNFineSeg[128] = {
+   { 1053072878,  -200002},
+   { 1028794598,  -199939},
+   { 1006311405,  -199821},
+   {  985384922,  -199658},
+   {  965826881,  -199453},
+   {  947485480,  -199214},
+   {  930235762,  -198944},
+   {  913972796,  -198647},
+   {  898606852,  -198326},
+   {  884059958,  -197985},
+   {  870263448,  -197625},
+   {  857156203,  -197249},
+   {  844683376,  -196858},
+   {  832795453,  -196455},
+   {  821447564,  -196040},
+   {  810598938,  -195616},
+   {  800212487,  -195182},
+   {  790254464,  -194741},
+   {  780694167,  -194292},
+   {  771503689,  -193836},
+   {  762657687,  -193374},
+   {  754133173,  -192907},
+   {  745909320,  -192435},
+   {  737967274,  -191959},
+   {  730289980,  -191478},
+   {  722862014,  -190993},
+   {  715669427,  -190505},
+   {  708699595,  -190014},
+   {  701941078,  -189521},
+   {  695383489,  -189025},
+   {  689017375,  -188526},
+   {  682834099,  -188026},
+   {  676825745,  -187524},
+   {  670985020,  -187022},
+   {  665305170,  -186518},
+   {  659779911,  -186013},
+   {  654403357,  -185508},
+   {  649169967,  -185003},
+   {  644074494,  -184498},
+   {  639111945,  -183993},
+   {  634277541,  -183488},
+   {  629566693,  -182984},
+   {  624974976,  -182481},
+   {  620498109,  -181979},
+   {  616131944,  -181478},
+   {  611872453,  -180978},
+   {  607715720,  -180479},
+   {  603657940,  -179981},
+   {  599695415,  -179485},
+   {  595824550,  -178990},
+   {  592041862,  -178496},
+   {  588343976,  -178004},
+   {  584727628,  -177514},
+   {  581189674,  -177025},
+   {  577727087,  -176537},
+   {  574336963,  -176050},
+   {  571016527,  -175565},
+   {  567763131,  -175081},
+   {  564574259,  -174599},
+   {  561447529,  -174117},
+   {  558380690,  -173637},
+   {  555371627,  -173158},
+   {  552418354,  -172681},
+   {  549519015,  -172204},
+   {  546671883,  -171729},
+   {  543875350,  -171254},
+   {  541127926,  -170781},
+   {  538428233,  -170309},
+   {  535774997,  -169839},
+   {  533167039,  -169369},
+   {  530603273,  -168901},
+   {  528082690,  -168434},
+   {  525604354,  -167968},
+   {  523167391,  -167504},
+   {  520770980,  -167041},
+   {  518414343,  -166580},
+   {  516096738,  -166121},
+   {  513817446,  -165663},
+   {  511575767,  -165207},
+   {  509371008,  -164752},
+   {  507202478,  -164300},
+   {  505069478,  -163849},
+   {  502971299,  -163400},
+   {  500907213,  -162953},
+   {  498876472,  -162508},
+   {  496878301,  -162065},
+   {  494911899,  -161623},
+   {  492976437,  -161184},
+   {  491071059,  -160747},
+   {  489194880,  -160311},
+   {  487346994,  -159877},
+   {  485526474,  -159445},
+   {  483732380,  -159014},
+   {  481963761,  -158585},
+   {  480219668,  -158157},
+   {  478499156,  -157731},
+   {  476801301,  -157306},
+   {  475125202,  -156881},
+   {  473469999,  -156458},
+   {  471834879,  -156036},
+   {  470219090,  -155614},
+   {  468621950,  -155193},
+   {  467042864,  -154773},
+   {  465481325,  -154353},
+   {  463936934,  -153934},
+   {  462409401,  -153516},
+   {  460898555,  -153098},
+   {  459404348,  -152681},
+   {  457926857,  -152265},
+   {  456466285,  -151849},
+   {  455022955,  -151435},
+   {  453597303,  -151022},
+   {  452189866,  -150611},
+   {  450801262,  -150201},
+   {  449432170,  -149794},
+   {  448083300,  -149389},
+   {  446755352,  -148988},
+   {  445448978,  -148589},
+   {  444164725,  -148193},
+   {  442902972,  -147802},
+   {  441663858,  -147414},
+   {  440447198,  -147030},
+   {  439252380,  -146649},
+   {  438078260,  -146272},
+   {  436923029,  -145899},
+   {  435784073,  -145527},
+   {  434657810,  -145157},
+   {  433539511,  -144786}
+};
+static const FixSegTab TcNFine = {-5603, 98118117u, 128, 24, TcNFineSeg};
+
+// Cold junction from 0, millidegrees to microvolts
+static const FixSegPt CjPFineSeg[64] = {
+   {  666817735,        0},
+   {  669129173,        0},
+   {  671512007,        0},
+   {  673960150,       -1},
+   {  676467820,       -2},
+   {  679029530,       -4},
+   {  681640074,       -6},
+   {  684294520,       -8},
+   {  686988200,      -10},
+   {  689716702,      -13},
+   {  692475859,      -16},
+   {  695261739,      -19},
+   {  698070640,      -23},
+   {  700899079,      -28},
+   {  703743782,      -32},
+   {  706601679,      -37},
+   {  709469896,      -42},
+   {  712345745,      -48},
+   {  715226716,      -54},
+   {  718110473,      -60},
+   {  720994844,      -66},
+   {  723877814,      -73},
+   {  726757521,      -80},
+   {  729632245,      -88},
+   {  732500403,      -96},
+   {  735360547,     -104},
+   {  738211349,     -112},
+   {  741051604,     -121},
+   {  743880218,     -130},
+   {  746696207,     -139},
+   {  749498685,     -149},
+   {  752286866,     -159},
+   {  755060054,     -169},
+   {  757817640,     -179},
+   {  760559097,     -190},
+   {  763283972,     -201},
+   {  765991887,     -212},
+   {  768682530,     -223},
+   {  771355655,     -235},
+   {  774011071,     -246},
+   {  776648645,     -258},
+   {  779268295,     -271},
+   {  781869987,     -283},
+   {  784453729,     -296},
+   {  787019572,     -308},
+   {  789567603,     -321},
+   {  792097941,     -335},
+   {  794610740,     -348},
+   {  797106178,     -362},
+   {  799584460,     -376},
+   {  802045813,     -390},
+   {  804490483,     -404},
+   {  806918735,     -418},
+   {  809330847,     -433},
+   {  811727111,     -447},
+   {  814107827,     -462},
+   {  816473306,     -477},
+   {  818823865,     -492},
+   {  821159824,     -508},
+   {  823481508,     -523},
+   {  825789242,     -539},
+   {  828083350,     -555},
+   {  830364157,     -571},
+   {  832631983,     -587}
+};
+static const FixSegTab CjPFine = {0, 2199023u, 64, 34, CjPFineSeg};
+
+// Cold junction below 0, millidegrees to microvolts
+static const FixSegPt CjNFineSeg[32] = {
+   {  600861315,    -1474},
+   {  603016513,    -1475},
+   {  605166401,    -1475},
+   {  607311528,    -1475},
+   {  609452440,    -1476},
+   {  611589652,    -1477},
+   {  613723638,    -1478},
+   {  615854799,    -1479},
+   {  617983449,    -1480},
+   {  620109785,    -1481},
+   {  622233866,    -1483},
+   {  624355587,    -1485},
+   {  626474662,    -1487},
+   {  628590601,    -1489},
+   {  630702694,    -1491},
+   {  632810004,    -1493},
+   {  634911359,    -1495},
+   {  637005365,    -1498},
+   {  639090415,    -1501},
+   {  641164725,    -1504},
+   {  643226382,    -1507},
+   {  645273406,    -1510},
+   {  647303846,    -1513},
+   {  649315898,    -1516},
+   {  651308054,    -1520},
+   {  653279292,    -1523},
+   {  655229307,    -1527},
+   {  657158792,    -1531},
+   {  659069772,    -1535},
+   {  660966008,    -1539},
+   {  662853467,    -1543},
+   {  664740874,    -1547}
+};
+static const FixSegTab CjNFine = {-40000, 3435973u, 32, 34, CjNFineSeg};
+
+// RTD, milliohms to millidegrees
+static const FixSegPt RtdFineSeg[64] = {
+   {  678568529,   -40001},
+   {  679138627,   -40003},
+   {  679703456,   -40007},
+   {  680263240,   -40014},
+   {  680818212,   -40022},
+   {  681368605,   -40032},
+   {  681914657,   -40044},
+   {  682456609,   -40058},
+   {  682994707,   -40074},
+   {  683529197,   -40092},
+   {  684060332,   -40112},
+   {  684588367,   -40133},
+   {  685113559,   -40157},
+   {  685636170,   -40182},
+   {  686156465,   -40209},
+   {  686674716,   -40238},
+   {  687191964,   -40268},
+   {  687710124,   -40301},
+   {  688229459,   -40336},
+   {  688749971,   -40372},
+   {  689271667,   -40411},
+   {  689794549,   -40452},
+   {  690318624,   -40494},
+   {  690843894,   -40539},
+   {  691370366,   -40586},
+   {  691898043,   -40635},
+   {  692426930,   -40686},
+   {  692957032,   -40739},
+   {  693488354,   -40794},
+   {  694020899,   -40851},
+   {  694554673,   -40911},
+   {  695089681,   -40972},
+   {  695625926,   -41036},
+   {  696163415,   -41102},
+   {  696702152,   -41169},
+   {  697242141,   -41240},
+   {  697783388,   -41312},
+   {  698325897,   -41386},
+   {  698869674,   -41463},
+   {  699414722,   -41542},
+   {  699961049,   -41623},
+   {  700508657,   -41706},
+   {  701057553,   -41791},
+   {  701607740,   -41879},
+   {  702159226,   -41969},
+   {  702712014,   -42061},
+   {  703266109,   -42156},
+   {  703821517,   -42252},
+   {  704378243,   -42351},
+   {  704936293,   -42453},
+   {  705495671,   -42556},
+   {  706056383,   -42662},
+   {  706618433,   -42771},
+   {  707181828,   -42881},
+   {  707746573,   -42994},
+   {  708312673,   -43110},
+   {  708880134,   -43228},
+   {  709448960,   -43348},
+   {  710019159,   -43470},
+   {  710590734,   -43595},
+   {  711163692,   -43723},
+   {  711738038,   -43853},
+   {  712313777,   -43985},
+   {  712890917,   -44120}
+};
+static const FixSegTab RtdFine = {84270, 4316414u, 64, 28, RtdFineSeg};
+
+// TEMP_ENG_POLY
+
+// Thermocouple from 0, ITS-90 inverse, microvolts to millidegrees
+static const long TcPPolyC[7] = {
+   0, 217499828, -208988601, 417735076, -639111503, 584940595,
+   -231137769
+};
+static const FixPolyTab TcPPoly = {0, 0, 20872, 16, 6, 8, TcPPolyC};
+
+// Thermocouple below 0, ITS-90 inverse, microvolts to millidegrees
+static const long TcNPolyC[8] = {
+   0, 27209700, -1831114, 55604461, 245155943, 628285974,
+   783053014, 401470364
+};
+static const FixPolyTab TcNPoly = {0, -5603, 0, 18, 7, 7, TcNPolyC};
+
+// Cold junction from 0, ITS-90, millidegrees to microvolts
+static const long CjPPolyC[9] = {
+   0, 665687398, 74967433, 60854313, -84652881, 55760811,
+   -20480585, 3961791, -314142
+};
+static const FixPolyTab CjPPoly = {0, 0, 125000, 14, 8, 17, CjPPolyC};
+
+// Cold junction below 0, ITS-90, millidegrees to microvolts
+static const long CjNPolyC[15] = {
+   0, 665687398, 49758510, 8739568, 96873516, 285658786,
+   470446117, 490975109, 343377418, 164936434, 54601264, 12245034,
+   1776411, 150383, 5639
+};
+static const FixPolyTab CjNPoly = {0, -40000, 0, 15, 14, 18, CjNPolyC};
+
+// RTD, least squares fit of IEC 60751, milliohms to millidegrees
+static const long RtdPolyC[5] = {
+   339778706, 695371183, 8801156, 177976, 75348
+};
+static const FixPolyTab RtdPoly = {116111, 84270, 147952, 16, 4, 13, RtdPolyC};
+
+#endif
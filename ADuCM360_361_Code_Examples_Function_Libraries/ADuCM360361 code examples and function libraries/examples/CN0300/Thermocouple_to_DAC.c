@@ -4,8 +4,15 @@
    @brief    This file expects a Thermocouple to be connected differentially to AIN2/AIN3 (J3 on the CN0300-EB1Z Demo board).
    - The RTD connected to AIN0/AIN1 will be used for Cold Junction compensation.
    - This file will measure the thermocouple/RTD inputs, convert this to an overall temperature.
+   - ADC1 measures the thermocouple and ADC0 the RTD at the same instants. AdcDualStart() starts
+     both from one trigger and streams them over DMA in frames of SAMPLENO pairs, and each pair is
+     compensated with its own cold junction reading.
+   - Each pair is converted in fixed point with FixMulBlk() and the block functions of
+     TempCalc.c, and each thermocouple temperature is linearised before averaging.
+   - TEMPENGINE below selects their engine, see examples/TempGen/TempBench.c for the speed
+     and error of each.
    - This temperature is sent to the 4-20mA interface which is controlled by the VDAC in NPN mode.
-   - ADC0 is used to measure a feedback voltage on AIN9 on the 4-20mA output circuit.
+   - Between frames ADC0 measures a feedback voltage on AIN9 on the 4-20mA output circuit.
    - The voltage on this pin is linearlily related to the 4-20mA current. By measuring this voltage, the function
      void FineTuneDAC(void) adjusts the DAC output remove any linearity errors on the VDAC and the external voltage to current
      convertor circuit.
@@ -16,10 +23,12 @@
    - Calibration options are included to calibrate the DAC output. Modify the define calibrateDAC below to review the different options
    
    Baud rate of UART interface is 19200
+   - Messages are logged as binary records with LogLib, read them on a PC with
+     examples/LogDec built with LOG_FMT_FILE set to CN0300/LogFmt.h.
 
-   @version  V0.3
+   @version  V0.7
    @author   ADI
-   @date     February 2013 
+   @date     October 2026
    @par Revision History:
    - V0.1, September 2010: initial version. 
    - V0.2, October 2012: Changed comments - 19200 baud for UART used.
@@ -27,6 +36,22 @@
    - V0.3, February 2013: Corrected SystemFullCalibration() function.
                          Changed comments: ADC1 is used for temperature measurements.
                          Fixed a bug in SendString().
+   - V0.4, October 2026: Log messages with LogWr0()/LogWr1() instead of
+                         sprintf() and SendString(), records are sent from
+                         the main loop by LogPoll() through the UART
+                         transmit ring. AIN9 calibration codes are printed
+                         with %d, "%ul" printed a stray 'l'.
+   - V0.5, October 2026: Thermocouple on ADC1 and RTD on ADC0 sampled in pairs
+                         with AdcDualStart() instead of alternating on ADC1,
+                         so the cold junction compensation uses readings of
+                         the same instant. AIN9 is read on ADC0 between frames.
+                         ADC0 errors are reported as ADC0 errors.
+   - V0.6, October 2026: Each pair converted in fixed point with FixLib and the
+                         table based block functions of TempCalc.c. The final
+                         temperature is the average of the temperatures of the
+                         pairs, not the temperature of the average voltage.
+   - V0.7, October 2026: Temperature engine selected with TEMPENGINE, the
+                         finer ITS-90 tables by default.
 
 All files for ADuCM360/361 provided by ADI, including this file, are
 provided  as is without warranty of any kind, either expressed or implied.
@@ -36,8 +61,6 @@ to ensure that the resulting application performs as required and is safe.
 
 **/
 
-#include <stdio.h>
-#include <string.h>
 #include <ADuCM360.h>
 #include "FlashEraseWrite.h"
 #include "TempCalc.h"
@@ -50,8 +73,18 @@ to ensure that the resulting application performs as required and is safe.
 #include <..\common\GptLib.h>
 #include <..\common\DioLib.h>
 #include <..\common\AdcLib.h>
+#include <..\common\DmaLib.h>
 #include <..\common\DacLib.h>
 #include <..\common\RstLib.h>
+#include <..\common\RingLib.h>
+#include <..\common\LogLib.h>
+#include <..\common\FixLib.h>
+
+enum {
+#define LOG_FMT(eId, szFmt)	eId,
+#include "LogFmt.h"
+#undef LOG_FMT
+};
 
 
 #define calibrateADC1	0		// Set to 0 if you don't want to calibrate
@@ -63,9 +96,11 @@ to ensure that the resulting application performs as required and is safe.
 										// set to 2 if you want to load previously saved values from
 										// flash										
 
-#define THERMOCOUPLE 	0		// Used for switching ADC1 to Thermocouple channel
-#define RTD 				1		// Used for switching ADC1 to RTD channel
-#define SAMPLENO			0x5	// Number of samples to be taken between channel switching
+#define SAMPLENO			0x5	// Number of thermocouple/RTD pairs in each frame
+
+#define TEMPENGINE	TEMP_ENG_FINE	// TEMP_ENG_TAB for the 30 segment tables, about 0.3C error
+										// TEMP_ENG_FINE for the finer tables, as fast and about 0.01C from ITS-90
+										// TEMP_ENG_POLY for the ITS-90 polynomials, slower and within 0.04C
 
 // DAC Default Output Values
 #define DEFAULT4mA 0xD800000          // DAC value that nominally gives 4mA
@@ -77,27 +112,28 @@ void UARTInit(void);			            // Enables UART
 void IEXCINIT(void);	                // Setup Excitation Current sources
 void DACINIT(void);                   // Init DAC for NPN mode
 void delay(long int);								  // Simple delay function
-void SendString(void);								// Transmit string using UART
 void SystemZeroCalibration(void);			// Calibrate using external inputs
 void SystemFullCalibration(void);			// Calibrate using external inputs
 
-void ADC1RTDCfg(void);                // RTD ADC1 settings
-void ADC1ThermocoupleCfg(void);       // Tc ADC1 settings
-void SendResultToUART(void);			    // Send measurement results to UART - in ASCII String format
+void ADC0RTDCfg(void);                // RTD ADC0 settings
+void ADC0AIN9Cfg(void);               // AIN9 feedback ADC0 settings
+void PairDone(int *piRtd, int *piTc, int iNum); // Called by AdcDualStart() with each frame
+void SendResultToUART(void);			    // Log measurement results, sent to the UART by LogPoll()
+void RxByte(int iByte);               // Called by UrtBufInt() for each byte received
+int LogOut(const unsigned char *pucData, int iLen);	// Output for LogPoll()
 void UpdateDAC(void);                 // Convert Final temperature value to 4-20mA output current
 void FineTuneDAC(void);               // Used to correct DAC output based on Feedback voltage on AIN9
 void CalibrateDAC(void);              // Routine for calibrating DAC output - 4-20mA loop current must be monitored by precision Current meter.
 
 volatile unsigned char bSendResultToUART = 0;	// Flag used to indicate ADC1 result ready to send to UART
 volatile unsigned char ucComRx = 0;		// variable that ComRx is read into in UART IRQ
-unsigned char szTemp[64] = "";				// Used to store string before printing to UART
-unsigned char ucTxBufferEmpty  = 0;		// Used to indicate that the UART Tx buffer is empty
-volatile  long ulADC1DATThermocouple[SAMPLENO];	// Variable that ADC1DAT is read into when sampling TC
-volatile  long ulADC1DATRtd[SAMPLENO];// Variable that ADC1DAT is read into when sampling RTD
-unsigned long ulADC1CONThermocouple;	// used to set ADC1CON which sets channel to thermocouple
-unsigned long ulADC1CONRtd;			 			// used to set ADC1CON which sets channel to RTD
-unsigned char ucADCInput;							// Used to indicate what channel the ADC1 is sampling
-unsigned char ucSampleNo = 0;					// Used to keep track of when to switch channels
+unsigned char ucTxRingBuf[256];				// Storage for the UART transmit ring
+RingBuf UartTxRing;							// Drained by the THRE interrupt
+unsigned long ulLogBuf[64];					// Log records waiting for LogPoll()
+int iRtdBuf[2*SAMPLENO];							// ADC0 RTD results, filled by the DMA
+int iTcBuf[2*SAMPLENO];								// ADC1 thermocouple results, filled by the DMA
+int *piRtdFrame;										// RTD results of the last frame
+int *piTcFrame;										// Thermocouple results taken with them
 unsigned char ucIEXCCON = 0;					// Used to setup IEXCON
 unsigned char ucIEXDAT = 0;						// Used to setup IEXDAT
 unsigned char ucWaitForUart = 0;			// Used by calibration routines to wait for user input
@@ -124,8 +160,9 @@ unsigned int uiArraySize = 0;					// size of array to be written to flash
 long ulADC0DAT = 0;                   // Variable used to store ADC0 result. used to calculate compensation value for DAC output
  
 float fVolts = 0.0;										// ADC to voltage constant
+FixScale TcUv;													// ADC1 codes to thermocouple microvolts, same LSB as fVolts
+FixScale RtdMohm;												// ADC0 codes to RTD milliohms
 float fVThermocouple = 0.0;						// thermoucouple voltage
-float fVRTD = 0.0 ;										// RTD voltage, 
 float fRrtd = 0.0;										// resistance of the RTD
 float fColdJVolt = 0.0;								// cold junction equivalent thermocouple voltage
 float fFinalVoltage = 0.0;						// fFinalVoltage = thermocouple voltage + cold j voltage
@@ -136,8 +173,6 @@ float fAIN9Voltage = 0.0;             // Used for determining AIN9 feedback volt
 float fCurrentOut = 0.0;              // Used for debug purposes to print expected output current
 float fTempScale = 0.0;               // Variable used to determine fraction of full scale latest temperature is
 float fCalVoltage = 0.0;              // Stores Expected AIN9 voltage for present Temperature reading
-unsigned char nLen = 0;								// Used for sending strings to UART
-unsigned char i = 0;									// counter used in SendString()
 unsigned char ucCounter = 0;
 unsigned long ulDefaultDAC4mA = 0xE300000; 
 unsigned long ulDefaultDAC20mA = 0x5280000; 
@@ -153,89 +188,123 @@ int uiNumCodesAdjust = 0;
 
 int main (void)
 {
+	long lTcUv[SAMPLENO];										// Thermocouple voltages of a frame
+	long lRtdMohm[SAMPLENO];									// RTD resistances
+	long lRtdMdeg[SAMPLENO];									// RTD temperatures
+	long lCjUv[SAMPLENO];										// Cold junction equivalent voltages
+	long lFinalUv[SAMPLENO];									// Compensated thermocouple voltages
+	long lFinalMdeg[SAMPLENO];									// Final temperatures
+	long lSumTc, lSumR, lSumT, lSumCj, lSumFinal, lSumTemp;
+
 	WdtCfg(T3CON_PRE_DIV1,T3CON_IRQ_EN,T3CON_PD_DIS);								// Turn off Watchdog timer
 	ClkCfg(CLK_CD3,CLK_HF,CLKSYSDIV_DIV2EN,CLK_UCLKCG);					    // Set CPU clock to 1MHz
 	ClkDis(0|CLKDIS_DISSPI0CLK|CLKDIS_DISSPI1CLK|
 	CLKDIS_DISI2CCLK|CLKDIS_DISPWMCLK);                             // Disable clock to unused peripherals
   ClkSel(CLK_CD7,CLK_CD7,CLK_CD0,CLK_CD7);				                // Enable UART clock - disable SPI/I2C/PWM clocks
 	ucADCERR = 0;
-	ulADC1CONRtd = 0x81001;				                                  // AIN0 = +ve input; AIN1 = -ve input, EXTREF
-	//AdcPin(pADI_ADC1,ADCCON_ADCCN_AIN1,ADCCON_ADCCP_AIN0);
-	ulADC1CONThermocouple = 0x80043;	                              // AIN2 = +ve input; AIN3 = -ve input, IntRef-AGND range
-	//AdcPin(pADI_ADC1,ADCCON_ADCCN_AIN3,ADCCON_ADCCP_AIN2);
 	DioOen(pADI_GP1,0x8);							                              // used for debug (pin 1.3)
 	UARTInit();						                                          // Init UART to 9600	
   NVIC_EnableIRQ(FLASH_IRQn);					                            // Enable Flash and UART interrupt sources
 	NVIC_EnableIRQ(UART_IRQn);
-	ucADCInput = THERMOCOUPLE;			                                //	Indicate that ADC1 is sampling thermocouple
 	ADC0INIT();								                                      // Init ADC0
-	NVIC_EnableIRQ(ADC0_IRQn);					                            
+	NVIC_EnableIRQ(ADC0_IRQn);					                            // ADC0 IRQ, used for AIN9
 	ADC1INIT();								                                      // Init ADC1	
 	IEXCINIT();																										  // Init IEXC0 for 200uA on AIN5
-	NVIC_EnableIRQ(ADC1_IRQn);					                            // ADC0/UART/ADC1 IRQ
+	DmaBase();                                                      // Setup DMA controller for the ADC streams
 	
 	AdcGo(pADI_ADC0,ADCMDE_ADCMD_CONT);                             // Enable ADC0 in continuous mode
 	DACINIT();
-	sprintf ( (char*)szTemp, "Program Started. Please wait for the first temperature result\r\n");
-	nLen = strlen((char*)szTemp);
-	if (nLen <64)
- 		SendString();
+	LogWr0(LOG_START);
+	NVIC_DisableIRQ(ADC0_IRQn);                                     // ADC0 results go to the DMA
+	ADC0RTDCfg();
+	AdcDualStart(iRtdBuf,iTcBuf,SAMPLENO,PairDone);                 // Thermocouple and RTD from one trigger
 
 	fVolts	= (1.2 / 268435456);			                                      // Internal reference - calcualte LSB voltage value	
+	FixScaleSet(&TcUv,FIX_REF_INT_UV,1,FIX_ADC_BITS);               // Same LSB in microvolts
+	FixScaleSet(&RtdMohm,5600000,1,FIX_ADC_BITS);                   // RTD in terms of the 5.6k reference resistor
+	TempEngSel(TEMPENGINE);
 	ucFirstLoop = 1;
 	while(1)
 	{
+   LogPoll();                                                        // Send logged records while the ring has room
    if(bSendResultToUART == 1)
 		{
-			fVThermocouple = 0;
-			fVRTD =0;
+			AdcDualStop();                                                  // Frame is safe from the DMA now
+			ADC0AIN9Cfg();                                                  // Read the 4-20mA feedback on AIN9
+			ucADC0Rdy = 0;
+			NVIC_EnableIRQ(ADC0_IRQn);
+			AdcGo(pADI_ADC0,ADCMDE_ADCMD_CONT);
+			FixMulBlk(&TcUv,piTcFrame,lTcUv,SAMPLENO);                      // Thermocouple voltages
+			FixMulBlk(&RtdMohm,piRtdFrame,lRtdMohm,SAMPLENO);               // RTD resistances, from RTD voltage in terms of reference voltage
+			CalculateRTDTempBlk(lRtdMohm,lRtdMdeg,SAMPLENO);                // RTD temperatures
+			CalculateColdJVoltageBlk(lRtdMdeg,lCjUv,SAMPLENO);              // get equvalent thermocouple voltages
+			for (ucCounter = 0; ucCounter < SAMPLENO; ucCounter++)           // Compensate each pair with its own cold junction
+				lFinalUv[ucCounter] = lTcUv[ucCounter] + lCjUv[ucCounter];
+			CalculateThermoCoupleTempBlk(lFinalUv,lFinalMdeg,SAMPLENO);     // Thermocouple temperature of each pair
+			lSumTc = lSumR = lSumT = lSumCj = lSumFinal = lSumTemp = 0;
 			for (ucCounter = 0; ucCounter < SAMPLENO; ucCounter++)
 			{
-				fVThermocouple += (ulADC1DATThermocouple[ucCounter] * fVolts);  	// Thermocouple voltage
-				fVRTD += ((float)ulADC1DATRtd[ucCounter]  / 268435456);	  		    // RTD voltage	in terms of reference voltage
+				lSumTc += lTcUv[ucCounter];
+				lSumR += lRtdMohm[ucCounter];
+				lSumT += lRtdMdeg[ucCounter];
+				lSumCj += lCjUv[ucCounter];
+				lSumFinal += lFinalUv[ucCounter];
+				lSumTemp += lFinalMdeg[ucCounter];
 			}
-			fVThermocouple = fVThermocouple/SAMPLENO;					                  // Get the average of the results
-			fVRTD = fVRTD/SAMPLENO;
-			fRrtd = fVRTD * 5600;											                          // RTD resistance
-			fTRTD =	CalculateRTDTemp(fRrtd);							                      // RTD temperature
-			fColdJVolt = CalculateColdJVoltage(fTRTD);				                  // get an equvalent thermocouple voltage
-			fFinalVoltage = fVThermocouple + fColdJVolt;
-			//fTThermocouple = CalculateThermoCoupleTemp(fVThermocouple);
-			fFinalTemp = CalculateThermoCoupleTemp(fFinalVoltage);	            // Thermocouple temperature
+			fVThermocouple = (float)lSumTc/(SAMPLENO*1000000.0f);	                // Get the average of the results
+			fRrtd = (float)lSumR/(SAMPLENO*1000.0f);
+			fTRTD = (float)lSumT/(SAMPLENO*1000.0f);
+			fColdJVolt = (float)lSumCj/(SAMPLENO*1000000.0f);
+			fFinalVoltage = (float)lSumFinal/(SAMPLENO*1000000.0f);
+			fFinalTemp = (float)lSumTemp/(SAMPLENO*1000.0f);
+			while (ucADC0Rdy == 0)                                           // AIN9 result
+			{
+				LogPoll();
+			}
+			NVIC_DisableIRQ(ADC0_IRQn);
+			ADC0RTDCfg();
 			if (ucFirstLoop == 1)
 				UpdateDAC();
 			else
 			   FineTuneDAC();
 			ucFirstLoop = 0;
+			bSendResultToUART = 0;
+			AdcDualStart(iRtdBuf,iTcBuf,SAMPLENO,PairDone);              // Next frame
 			SendResultToUART();
-      bSendResultToUART = 0;
 		}
 		if (ucADCERR != 0)
 		{
 		   if (ucADCERR == 1)
-		   		sprintf ( (char*)szTemp, "ADC error on ADC0  \r\n");// Send error message to UART  
+		   		LogWr0(LOG_ADC0_ERR);									// Send error message to UART
 			if (ucADCERR == 2)
-		   		sprintf ( (char*)szTemp, "ADC error on ADC1  \r\n");// Send error message to UART
-		   if ((ucADCERR == 1) | (ucADCERR == 2))                          
-			{	nLen = strlen((char*)szTemp);
-			  	if (nLen <64)
-		 			SendString();
-	      }
+		   		LogWr0(LOG_ADC1_ERR);									// Send error message to UART
 			ucADCERR = 0;
 	   }
 	}
 }
-// Setup ADC1 to measure the RTD input
-void ADC1RTDCfg(void)
+// Setup ADC0 to measure the RTD input
+void ADC0RTDCfg(void)
 {
-	AdcPin(pADI_ADC1,ADCCON_ADCCN_AIN1,ADCCON_ADCCP_AIN0);                    // AIN0/AIN1 input channels
-	AdcRng(pADI_ADC1,ADCCON_ADCREF_EXTREF,ADCMDE_PGA_G32,ADCCON_ADCCODE_INT); // External reference, G32 used
+	AdcGo(pADI_ADC0,ADCMDE_ADCMD_IDLE);
+	AdcPin(pADI_ADC0,ADCCON_ADCCN_AIN1,ADCCON_ADCCP_AIN0);                    // AIN0/AIN1 input channels
+	AdcRng(pADI_ADC0,ADCCON_ADCREF_EXTREF,ADCMDE_PGA_G32,ADCCON_ADCCODE_INT); // External reference, G32 used
 }
-// Setup ADC1 to measure the Thermocouple input
-void ADC1ThermocoupleCfg(void)
+// Setup ADC0 to measure the AIN9 feedback voltage
+void ADC0AIN9Cfg(void)
 {
-	AdcPin(pADI_ADC1,ADCCON_ADCCN_AIN3,ADCCON_ADCCP_AIN2);                    // Select AIn2/AIN3 as ADC inputs
-	AdcRng(pADI_ADC1,ADCCON_ADCREF_INTREF,ADCMDE_PGA_G32,ADCCON_ADCCODE_INT); // Internal reference, Gain=32
+	AdcGo(pADI_ADC0,ADCMDE_ADCMD_IDLE);
+	AdcPin(pADI_ADC0,ADCCON_ADCCN_AGND,ADCCON_ADCCP_AIN9);                   // Select AIN9 as the positive input; AGND as negative input
+	AdcRng(pADI_ADC0,ADCCON_ADCREF_INTREF,ADCMDE_PGA_G2,ADCCON_ADCCODE_INT); // Internal Reference selected, PGA gain of 2
+}
+// Runs in the second DMA interrupt of each frame
+void PairDone(int *piRtd, int *piTc, int iNum)
+{
+	if (bSendResultToUART == 0)
+	{
+		piRtdFrame = piRtd;
+		piTcFrame = piTc;
+		bSendResultToUART = 1;
+	}
 }
 
 // This function is called only on the first pass through the main while loop - used to set first current output value
@@ -298,12 +367,11 @@ void FineTuneDAC(void)
 void SystemZeroCalibration(void)
 {
 	ucWaitForUart = 1;
-	sprintf ( (char*)szTemp, "Set Zero Scale Voltage - Press return when ready \r\n");                         
-	nLen = strlen((char*)szTemp);
- 	if (nLen <64)
-		 	SendString();
+	LogWr0(LOG_ZERO_CAL);
 	while (ucWaitForUart == 1)
-	{}
+	{
+		LogPoll();
+	}
 	AdcGo(pADI_ADC1,ADCMDE_ADCMD_SYSOCAL);	// ADC1 System Zero scale calibration
 	while ((AdcSta(pADI_ADC1) &0x20) != 0x20)			// bit 5 set by adc when calibration is complete
 	{}
@@ -312,17 +380,16 @@ void SystemZeroCalibration(void)
 void SystemFullCalibration(void)
 {
 	ucWaitForUart = 1;
-	sprintf ( (char*)szTemp, "Set Full Scale Voltage - Press return when ready \r\n");                         
-	nLen = strlen((char*)szTemp);
- 	if (nLen <64)
-		 	SendString();
+	LogWr0(LOG_FULL_CAL);
 	while (ucWaitForUart == 1)
-	{}
+	{
+		LogPoll();
+	}
 	AdcGo(pADI_ADC1,ADCMDE_ADCMD_SYSGCAL);							// ADC1 System Full scale calibration
 	while ((AdcSta(pADI_ADC1) &0x20) != 0x20)			// bit 5 set by adc when calibration is complete
 	{}
 }
-//ADC1 will measure Thermocouple on AIN2/3 and RTD on AIN0/1
+//ADC1 will measure Thermocouple on AIN2/3, ADC0 the RTD on AIN0/1 at the same time
 void ADC1INIT(void)
 {
 	unsigned long *pWrite;
@@ -333,7 +400,6 @@ void ADC1INIT(void)
 	// Thermocouple settings
 	AdcPin(pADI_ADC1,ADCCON_ADCCN_AIN3,ADCCON_ADCCP_AIN2);          // Select AIn2/AIN3 as ADC inputs
 	AdcRng(pADI_ADC1,ADCCON_ADCREF_INTREF,ADCMDE_PGA_G32,ADCCON_ADCCODE_INT); // Internal reference, Gain=32
-//	ADC1CON = ulADC1CONThermocouple;
 	AdcFlt(pADI_ADC1,124,0xD00,FLT_NORMAL);							              // Chop On, 3.75Hz sampling rate, chop on
 	AdcGo(pADI_ADC1,ADCMDE_ADCMD_IDLE);                             // Set ADC1 for Idle mode
 	delay(0xFFF);
@@ -354,8 +420,7 @@ void ADC1INIT(void)
 		pADI_ADC1->INTGN = *( unsigned long      *)0x0001FC00;
 		pADI_ADC1->OF = *( unsigned long      *)0x0001FC04;
 	}
-	delay(0xFFF);
-	AdcGo(pADI_ADC1,ADCMDE_ADCMD_CONT);							// PGA = 32	 continuous receive mode
+	delay(0xFFF);                                                   // ADC1 is left idle, AdcDualStart() starts it with ADC0
 }
 //ADC0 will measure AIN9 input - used to improve DAC output linearity performance
 void ADC0INIT(void)
@@ -372,7 +437,10 @@ void UARTInit(void)
 {
    UrtCfg(pADI_UART,B9600*2,COMLCR_WLS_8BITS,0);   // setup baud rate for 19200, 8-bits
    UrtMod(pADI_UART,COMMCR_DTR,0);  			  // Setup modem bits
-   UrtIntCfg(pADI_UART,COMIEN_ERBFI|COMIEN_ETBEI|COMIEN_ELSI|COMIEN_EDSSI|COMIEN_EDMAT|COMIEN_EDMAR);  // Setup UART IRQ sources
+   RingInit(&UartTxRing, ucTxRingBuf, sizeof(ucTxRingBuf));
+   UrtBufCfg(pADI_UART,&UartTxRing,0);			  // Setup UART IRQ sources and Tx ring
+   UrtBufRxFn(pADI_UART,RxByte);				  // Pass received bytes to RxByte()
+   LogCfg(ulLogBuf,64,LogOut);					  // Log records leave through the Tx ring
    DioPul(pADI_GP0,0xFF);								              // Enable pullup on P0.7/0.6
    DioCfg(pADI_GP0,0x3C);								              // Configure P0.2/P0.1 for UART
 }
@@ -419,24 +487,13 @@ void CalibrateDAC(void)
 	ul4mAVal = DEFAULT4mA;
 	DacWr(0,ul4mAVal);
 	ucCalComplete = 0;
-	sprintf ( (char*)szTemp, "DAC Calibration Routine - calibrate to 4mA \r\n");                         
-	nLen = strlen((char*)szTemp);
- 	if (nLen <64)
-		 	SendString();
-	sprintf ( (char*)szTemp, "Press 1 to increase Output current - Press return when ready \r\n");                         
-	nLen = strlen((char*)szTemp);
- 	if (nLen <64)
-		 	SendString();
-	sprintf ( (char*)szTemp, "Press 0 to Decrease Output current - Press return when ready \r\n");                         
-	nLen = strlen((char*)szTemp);
- 	if (nLen <64)
-		 	SendString();
-	sprintf ( (char*)szTemp, "Press return when Complete - Press return when ready \r\n\n\n");                         
-	nLen = strlen((char*)szTemp);
- 	if (nLen <64)
-		 	SendString();
+	LogWr0(LOG_DAC_4MA);
+	LogWr0(LOG_DAC_UP);
+	LogWr0(LOG_DAC_DOWN);
+	LogWr0(LOG_DAC_DONE3);
 	while (ucCalComplete == 0)
 	{
+		LogPoll();
 		if (ucComRx == 0x31)                                    // Character "1" received, so increase output current
 		{
 
@@ -456,35 +513,24 @@ void CalibrateDAC(void)
 	delay (0xFF); // delay for AIN9 measurement to update
 	ucADC0Rdy = 0;
 	AdcGo(pADI_ADC0,ADCMDE_ADCMD_CONT);                             // Enable ADC0 in continuous mode
-	while (ucADC0Rdy == 0){}
+	while (ucADC0Rdy == 0)
+	{
+		LogPoll();
+	}
 	lDAC4mAAIN9 = ulADC0DAT;
-	sprintf ( (char*)szTemp, "4mA AIN9 voltage: %ul \r\n",(lDAC4mAAIN9) );// Send the Result to the UART                          
-	nLen = strlen((char*)szTemp);
- 	if (nLen <64)
-		 	SendString();	
+	LogWr1(LOG_AIN9_4MA,lDAC4mAAIN9);
 		
 			// Calibrate 20mA Input
 	ul20mAVal = DEFAULT20mA;
 	DacWr(0,ul20mAVal);
 	ucCalComplete = 0;
-	sprintf ( (char*)szTemp, "DAC Calibration Routine - calibrate to 20mA \r\n");                         
-	nLen = strlen((char*)szTemp);
- 	if (nLen <64)
-		 	SendString();
-	sprintf ( (char*)szTemp, "Press 1 to increase Output current - Press return when ready \r\n");                         
-	nLen = strlen((char*)szTemp);
- 	if (nLen <64)
-		 	SendString();
-	sprintf ( (char*)szTemp, "Press 0 to Decrease Output current - Press return when ready \r\n");                         
-	nLen = strlen((char*)szTemp);
- 	if (nLen <64)
-		 	SendString();
-	sprintf ( (char*)szTemp, "Press return when Complete - Press return when ready \r\n");                         
-	nLen = strlen((char*)szTemp);
- 	if (nLen <64)
-		 	SendString();
+	LogWr0(LOG_DAC_20MA);
+	LogWr0(LOG_DAC_UP);
+	LogWr0(LOG_DAC_DOWN);
+	LogWr0(LOG_DAC_DONE);
 	while (ucCalComplete == 0)
 	{
+		LogPoll();
 		if (ucComRx == 0x31)                                    // Character "1" received, so increase output current
 		{
 
@@ -504,12 +550,12 @@ void CalibrateDAC(void)
 	delay (0xFF);                                             // delay for AIN9 measurement to update
 	ucADC0Rdy = 0;
 	AdcGo(pADI_ADC0,ADCMDE_ADCMD_CONT);                       // Enable ADC0 in continuous mode
-	while (ucADC0Rdy == 0){}
+	while (ucADC0Rdy == 0)
+	{
+		LogPoll();
+	}
 	lDAC20mAAIN9 = ulADC0DAT;
-	sprintf ( (char*)szTemp, "20mA AIN9 voltage: %ul \r\n",(lDAC20mAAIN9) );// Send the Result to the UART                          
-	nLen = strlen((char*)szTemp);
- 	if (nLen <64)
-		 	SendString();
+	LogWr1(LOG_AIN9_20MA,lDAC20mAAIN9);
 
 // Write the calibration values for the DAC to Flash page 0x1F000	
 	ulSelectPage = 0x1F000;
@@ -529,62 +575,28 @@ void delay (long int length)
 
     	length--;
 }
-void SendString (void)
+int LogOut(const unsigned char *pucData, int iLen)
 {
-   for ( i = 0 ; i < nLen ; i++ )	// loop to send ADC0 result
-	{
-  		 ucTxBufferEmpty = 0;
-		 UrtTx(pADI_UART,szTemp[i]);
-  		 while (ucTxBufferEmpty == 0)
-  		 {
-  		 }
-	}
-} 
+   return UrtBufWr(pADI_UART,pucData,iLen);	// Takes what fits, LogPoll() sends the rest later
+}
+void RxByte(int iByte)
+{
+   ucComRx = iByte;
+   ucWaitForUart = 0;
+   if (ucComRx == 0xD)                 // "Carriage return" detected
+      ucCalComplete = 1;
+}
 void SendResultToUART(void)
 {
-    sprintf ( (char*)szTemp, "RTD Resistance: %fOhms \r\n",fRrtd );                          
-    nLen = strlen((char*)szTemp);
-    if (nLen <64)
-            SendString();
-    
-    sprintf ( (char*)szTemp, "RTD Temperature: %fC \r\n",fTRTD );// Send the Result to the UART                          
-    nLen = strlen((char*)szTemp);
-    if (nLen <64)
-            SendString();
-    
-    sprintf ( (char*)szTemp, "Cold Junction Voltage: %fmV \r\n",(fColdJVolt*1000) );// Send the Result to the UART                          
-    nLen = strlen((char*)szTemp);
-    if (nLen <64)
-            SendString();
-    
-    sprintf ( (char*)szTemp, "Thermoucouple Voltage: %fmV \r\n",(fVThermocouple*1000) );// Send the Result to the UART                          
-    nLen = strlen((char*)szTemp);
-    if (nLen <64)
-            SendString();
-
-    sprintf ( (char*)szTemp, "Expected DAC Current: %fmA \r\n",fCurrentOut );// Used for debugging DAC output                          
-    nLen = strlen((char*)szTemp);
-    if (nLen <64)
-            SendString(); 
-    
-    sprintf ( (char*)szTemp, "Final Temperature: %fC \r\n",fFinalTemp );// Send the Result to the UART                          
-    nLen = strlen((char*)szTemp);
-    if (nLen <64)
-            SendString();
-		sprintf ( (char*)szTemp, "Expected AIN9 Voltage: %fV \r\n",fCalVoltage );// Send the Result to the UART                          
-    nLen = strlen((char*)szTemp);
-    if (nLen <64)
-            SendString();
-    
-    sprintf ( (char*)szTemp, "Number of DAC codes changed: %d \r\n",uiNumCodesAdjust );// Send the Result to the UART                          
-    nLen = strlen((char*)szTemp);
-    if (nLen <64)
-            SendString();
-
-		sprintf ( (char*)szTemp, "AIN9 Voltage: %fV \r\n\n\n\n",fAIN9Voltage );// Send the Result to the UART                          
-    nLen = strlen((char*)szTemp);
-    if (nLen <64)
-            SendString();
+    LogWr1(LOG_RTD_R,LogFlt(fRrtd));
+    LogWr1(LOG_RTD_T,LogFlt(fTRTD));
+    LogWr1(LOG_CJ_V,LogFlt(fColdJVolt*1000));
+    LogWr1(LOG_TC_V,LogFlt(fVThermocouple*1000));
+    LogWr1(LOG_DAC_I,LogFlt(fCurrentOut));      // Used for debugging DAC output
+    LogWr1(LOG_FINAL_T,LogFlt(fFinalTemp));
+    LogWr1(LOG_AIN9_EXP,LogFlt(fCalVoltage));
+    LogWr1(LOG_DAC_ADJ,uiNumCodesAdjust);
+    LogWr1(LOG_AIN9_V,LogFlt(fAIN9Voltage));
 }
 void ExtIntEnable(void) 
 {
@@ -674,43 +686,12 @@ void ADC0_Int_Handler()
 
    uiADCSTA = AdcSta(pADI_ADC0);
    if ((uiADCSTA & 0x10) == 0x10)			// Check for an error condition
-   		ucADCERR = 2;
+   		ucADCERR = 1;
 	 ulADC0DAT = AdcRd(pADI_ADC0);
 	 ucADC0Rdy = 1;
 }
 void ADC1_Int_Handler ()
 {
-   volatile unsigned int uiADCSTA = 0;
-   volatile long ulADC1DAT = 0;
-
-   uiADCSTA = AdcSta(pADI_ADC1);
-   if ((uiADCSTA & 0x10) == 0x10)			// Check for an error condition
-   		ucADCERR = 2;
-	ulADC1DAT = AdcRd(pADI_ADC1);
-	if( bSendResultToUART == 0 )
-	{
-		if(ucSampleNo < SAMPLENO){
-			if (ucADCInput == THERMOCOUPLE){
-				ulADC1DATThermocouple[ucSampleNo] = ulADC1DAT;}
-			else{   
-				ulADC1DATRtd[ucSampleNo] = ulADC1DAT;}
-			ucSampleNo++;	
-	  	}
-	  	else{
-	   	ucSampleNo = 0;
-			if (ucADCInput == THERMOCOUPLE)
-			{
-				ADC1RTDCfg();
-				ucADCInput = RTD;
-			}
-			else
-			{
-				ADC1ThermocoupleCfg();
-				ucADCInput = THERMOCOUPLE;
-				bSendResultToUART = 1;
-      }
-		}
-	}
 }
 void SINC2_Int_Handler ()
 {
@@ -751,22 +732,7 @@ void Flsh_Int_Handler ()
 }   
 void UART_Int_Handler ()
 {
-   volatile unsigned char ucCOMSTA0 = 0;
-	volatile unsigned char ucCOMIID0 = 0;
-	
-	ucCOMSTA0 = UrtLinSta(pADI_UART);			// Read Line Status register
-	ucCOMIID0 = UrtIntSta(pADI_UART);			// Read UART Interrupt ID register
-	if ((ucCOMIID0 & 0x2) == 0x2)	  			// Transmit buffer empty
-	{
-	  ucTxBufferEmpty = 1;
-	}
-	if ((ucCOMIID0 & 0x4) == 0x4)	  			// Receive byte
-	{
-		ucComRx	= UrtRx(pADI_UART);
-		ucWaitForUart = 0;
-		if (ucComRx == 0xD)                 // "Carriage return" detected
-			ucCalComplete = 1;
-	}
+   UrtBufInt(pADI_UART);						// Feed COMTX and pass received bytes to RxByte()
 } 
 void SPI0_Int_Handler ()
 {
@@ -782,6 +748,7 @@ void I2C0_Master_Int_Handler ()
 }
 void DMA_Err_Int_Handler ()
 {
+   DmaErrInt();                        // Clear the error, re-arm the ADC channels
 }
 void DMA_SPI1_TX_Int_Handler ()
 {
@@ -811,9 +778,11 @@ void DMA_I2C0_MRX_Int_Handler ()
 }
 void DMA_ADC0_Int_Handler ()
 {
+   AdcStreamInt(pADI_ADC0);            // RTD half of the frame
 }
 void DMA_ADC1_Int_Handler ()
 {
+   AdcStreamInt(pADI_ADC1);            // Thermocouple half, PairDone() once both are in
 }
 void DMA_DAC_Out_Int_Handler ()
 {
@@ -14,10 +14,24 @@ TO ENSURE THAT THE RESULTING APPLICATION PERFORMS AS REQUIRED AND IS SAFE.
 Description:
 This file contains the functions to convert ADC results to temperature 
 based on measurements of the RTD and thermocouple.
+The block functions convert whole buffers of integers with the tables of 
+TempTab.h, generated by examples/TempGen. TempEngSel() selects their engine:
+TEMP_ENG_TAB uses the tables below, TEMP_ENG_FINE finer tables and
+TEMP_ENG_POLY polynomials. examples/TempGen/TempBench.c reports
+the speed and error of each.
 
 */
 #include "TempCalc.h"
 
+#ifndef TEMP_GEN								// Defined when built into TempGen on a PC
+#ifdef TEMP_BENCH								// Defined when built into TempBench on a PC
+#include "FixLib.h"
+#else
+#include <..\common\FixLib.h>
+#endif
+#include "TempTab.h"
+#endif
+
 // Thermocouple lookup tables....
 const float C_themocoupleP[THER_N_SEG_P+1] = {0.0, 	15.1417, 	29.8016, 	44.0289, 	57.8675, 	71.3563, 
 									84.5295, 	97.4175, 	110.047, 	122.441, 	134.62,		146.602, 
@@ -102,7 +116,7 @@ float CalculateColdJVoltage(float t)
 	}
 	else if (t < 0)
 	{
-		j=(j - COLDJ_T_MIN_N) / COLDJ_T_SEG_N;				// determine which coefficient to use
+		j=(t - COLDJ_T_MIN_N) / COLDJ_T_SEG_N;				// determine which coefficient to use
 		if (j>COLDJ_N_SEG_N-1)    							// if input is over-range..
     		j=COLDJ_N_SEG_N-1;         						// ..then use highest coefficients
 
@@ -112,3 +126,60 @@ float CalculateColdJVoltage(float t)
 	return fresult/1000.0;
 }
 
+#ifndef TEMP_GEN
+static int iTempEng = TEMP_ENG_TAB;					// Engine of the block functions
+
+// Segment tables of TEMP_ENG_TAB and TEMP_ENG_FINE
+static const FixSegTab *const pTcPSeg[2] = {&TcPTab, &TcPFine};
+static const FixSegTab *const pTcNSeg[2] = {&TcNTab, &TcNFine};
+static const FixSegTab *const pCjPSeg[2] = {&CjPTab, &CjPFine};
+static const FixSegTab *const pCjNSeg[2] = {&CjNTab, &CjNFine};
+static const FixSegTab *const pRtdSeg[2] = {&RtdTab, &RtdFine};
+
+// Select the engine of the block functions, returns 0 if iEng is not valid
+int TempEngSel(int iEng)
+{
+	if ((iEng != TEMP_ENG_TAB) && (iEng != TEMP_ENG_FINE) && (iEng != TEMP_ENG_POLY))
+		return 0;
+	iTempEng = iEng;
+	return 1;
+}
+
+// Convert RTD resistances in milliohms to temperatures in millidegrees
+int CalculateRTDTempBlk(const long *plMohm, long *plMdeg, int iNum)
+{
+	if (iTempEng == TEMP_ENG_POLY)
+		return FixPolyBlk(&RtdPoly, plMohm, plMdeg, iNum);
+	return FixSegBlk(pRtdSeg[iTempEng], plMohm, plMdeg, iNum);
+}
+
+// Convert thermocouple voltages in microvolts to temperatures in millidegrees
+int CalculateThermoCoupleTempBlk(const long *plUv, long *plMdeg, int iNum)
+{
+	int i1;
+	if (iTempEng == TEMP_ENG_POLY)
+	{
+		for (i1 = 0; i1 < iNum; i1++)
+			plMdeg[i1] = FixPoly((plUv[i1] < 0) ? &TcNPoly : &TcPPoly, plUv[i1]);
+		return iNum;
+	}
+	for (i1 = 0; i1 < iNum; i1++)
+		plMdeg[i1] = FixSeg((plUv[i1] < 0) ? pTcNSeg[iTempEng] : pTcPSeg[iTempEng], plUv[i1]);
+	return iNum;
+}
+
+// Convert cold junction temperatures in millidegrees to thermocouple voltages in microvolts
+int CalculateColdJVoltageBlk(const long *plMdeg, long *plUv, int iNum)
+{
+	int i1;
+	if (iTempEng == TEMP_ENG_POLY)
+	{
+		for (i1 = 0; i1 < iNum; i1++)
+			plUv[i1] = FixPoly((plMdeg[i1] < 0) ? &CjNPoly : &CjPPoly, plMdeg[i1]);
+		return iNum;
+	}
+	for (i1 = 0; i1 < iNum; i1++)
+		plUv[i1] = FixSeg((plMdeg[i1] < 0) ? pCjNSeg[iTempEng] : pCjPSeg[iTempEng], plMdeg[i1]);
+	return iNum;
+}
+#endif
@@ -39,3 +39,14 @@ float CalculateRTDTemp(float r);			// returns RTD Temperature reading
 float CalculateThermoCoupleTemp(float v);		// returns Thermocouple Temperature reading
 float CalculateColdJVoltage(float t);	// converts cold junction temperature to an equvalent thermocouple voltage
 
+// Engines of the block functions, for TempEngSel()
+#define TEMP_ENG_TAB	0		// Tables above, fastest
+#define TEMP_ENG_FINE	1		// Tables of 32 to 128 segments from ITS-90
+#define TEMP_ENG_POLY	2		// Polynomials, ITS-90 for the thermocouple, inputs clamped
+
+int TempEngSel(int iEng);		// selects the engine, TEMP_ENG_TAB by default
+
+// Block versions in fixed point, plY may be plX to convert in place
+int CalculateRTDTempBlk(const long *plMohm, long *plMdeg, int iNum);	// milliohms to millidegrees
+int CalculateThermoCoupleTempBlk(const long *plUv, long *plMdeg, int iNum);	// microvolts to millidegrees
+int CalculateColdJVoltageBlk(const long *plMdeg, long *plUv, int iNum);	// millidegrees to microvolts
@@ -132,7 +132,7 @@ void DMA_DAC_Out_Int_Handler ()
 void DMA_Err_Int_Handler ()
 {
 	ulDmaStatus = DmaSta();
-	DmaErr(DMA_ERR_CLR);
+	DmaErrInt();						// Clear the error, re-arm the DAC channel
 }
 
 void UART_Int_Handler ()
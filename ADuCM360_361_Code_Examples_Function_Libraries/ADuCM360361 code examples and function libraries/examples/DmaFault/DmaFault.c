@@ -0,0 +1,295 @@
+/**
+ *****************************************************************************
+   @example  DmaFault.c
+   @brief    Host side test of DmaErrInt() re-arming the UART DMA channels.
+   - Runs on a PC, not on the ADuCM360.
+   - Builds DmaLib.c and UrtLib.c against the register model in Host/ and
+     plays the DMA controller: bytes are moved through the descriptors the
+     libraries set up, one at a time, and the completion interrupts are
+     raised as the hardware would.
+   - Injects a bus error part way through UrtRxDmaCfg() reception and a
+     UrtTxDma() block: the channel is disabled with its structure
+     unfinished and DMA_Err_Int_Handler() runs DmaErrInt(). Checks that the
+     channel is re-armed and that every byte then arrives once and in order.
+   - Checks that a channel faulting DMA_REARM_MAX+1 times in a row without
+     progress is left stopped, and that a channel enabled by writing
+     DMAENSET directly, not with DmaSet(), is ignored.
+   - Build with -no-pie so the static buffers lie below 4 GB, where the
+     32-bit pointers of the DMA structures reach them:
+        gcc -O2 -no-pie -Wno-pointer-to-int-cast -Wno-int-to-pointer-cast
+            -DDMA_SRAM_BASE=0 -DDMA_SRAM_END=0xFFFFFFFF -IHost -I../../common
+            -o DmaFault DmaFault.c ../../common/DmaLib.c ../../common/UrtLib.c
+            ../../common/GptLib.c ../../common/RingLib.c
+        ./DmaFault
+
+   @version V0.1
+   @author  ADI
+   @date    October 2026
+
+   @par     Revision History:
+   - V0.1, October 2026: initial version.
+
+All files for ADuCM360/361 provided by ADI, including this file, are
+provided  as is without warranty of any kind, either expressed or implied.
+The user assumes any and all risk from the use of this code.
+It is the responsibility of the person integrating this code into an application
+to ensure that the resulting application performs as required and is safe.
+
+**/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "DmaLib.h"
+#include "UrtLib.h"
+
+#define RX_SIZE		64                     // UrtRxDmaCfg() buffer, two halves of 32
+#define TX_LEN		40
+
+// Registers of the model in Host/ADuCM360.h
+ADI_UART_TypeDef HostUart;
+ADI_TIMER_TypeDef HostTm0, HostTm1;
+ADI_DMA_TypeDef HostDma;
+ADI_CLKCTL_TypeDef HostClkCtl;
+ADI_ADC_TypeDef HostAdc0, HostAdc1;
+ADI_ADCSTEP_TypeDef HostAdcStep;
+ADI_DAC_TypeDef HostDac;
+ADI_SPI_TypeDef HostSpi1;
+ADI_I2C_TypeDef HostI2c;
+uint32_t HostTmBusy[2];
+uint32_t HostPrimask;
+
+extern DmaDesc dmaChanDesc[];
+
+// State of the controller behind the set and clear registers
+static unsigned int uiEn;                  // Channels enabled
+static unsigned int uiAlt;                 // Channels on their alternate structure
+
+static unsigned char aucRx[RX_SIZE];
+static unsigned char aucTx[TX_LEN];
+static unsigned char aucTxOut[TX_LEN];
+static int iTxOut, iTxDone;
+static int iErr;
+
+static void Before(void);
+static void After(void);
+static void Start(void);
+static int DmaRxByte(int iByte);
+static int DmaTxByte(void);
+static int BusError(void);
+static void TxDone(void);
+static void Check(int iOk, const char *szWhat);
+static void RxFault(void);
+static void RxStuck(void);
+static void TxFault(void);
+static void Direct(void);
+
+int main(void)
+{
+   RxFault();
+   RxStuck();
+   TxFault();
+   Direct();
+   printf(iErr ? "FAIL\n" : "PASS\n");
+   return iErr;
+}
+
+// Shows the controller state in the registers before a library call
+static void Before(void)
+{
+   HostDma.DMAENSET = uiEn;
+   HostDma.DMAENCLR = 0;
+   HostDma.DMAALTSET = uiAlt;
+   HostDma.DMAALTCLR = 0;
+}
+
+// Applies the set and clear registers written by the call, a write of 0 to
+// a set register changes nothing
+static void After(void)
+{
+   uiEn = (uiEn | HostDma.DMAENSET) & ~HostDma.DMAENCLR;
+   uiAlt = (uiAlt | HostDma.DMAALTSET) & ~HostDma.DMAALTCLR;
+}
+
+static void Start(void)
+{
+   memset(&HostDma, 0, sizeof(HostDma));
+   memset(&HostUart, 0, sizeof(HostUart));
+   uiEn = uiAlt = 0;
+   DmaBase();
+   HostDma.DMAADBPTR = HostDma.DMAPDBPTR + ALTERNATE*sizeof(DmaDesc);
+}
+
+// The UART receives one byte, returns 1 if the DMA stored it
+static int DmaRxByte(int iByte)
+{
+   DmaDesc *pDesc;
+   unsigned int uiCfg;
+
+   if((uiEn & UARTRX_B) == 0)
+      return 0;                            // Channel stopped, the byte overruns
+   pDesc = &dmaChanDesc[UARTRX_C-1 + ((uiAlt & UARTRX_B) ? ALTERNATE : 0)];
+   uiCfg = pDesc->ctrlCfg.ctrlCfgVal;
+   if((uiCfg & 0x7) == DMA_STOP)
+   {
+      uiEn &= ~UARTRX_B;                   // Both halves full
+      return 0;
+   }
+   *(unsigned char *)(uintptr_t)(pDesc->destEndPtr - ((uiCfg>>4) & 0x3FF)) = iByte;
+   if(((uiCfg>>4) & 0x3FF) == 0)
+   {
+      pDesc->ctrlCfg.ctrlCfgVal = uiCfg & ~0x7u;   // Done, on to the other half
+      uiAlt ^= UARTRX_B;
+      Before();
+      UrtRxDmaInt(pADI_UART);              // DMA_UART_RX_Int_Handler()
+      After();
+   }
+   else
+      pDesc->ctrlCfg.ctrlCfgVal = uiCfg - (1<<4);
+   return 1;
+}
+
+// The UART takes one byte from the DMA, returns it or -1 if none came
+static int DmaTxByte(void)
+{
+   DmaDesc *pDesc = &dmaChanDesc[UARTTX_C-1];
+   unsigned int uiCfg = pDesc->ctrlCfg.ctrlCfgVal;
+   int iByte;
+
+   if(((uiEn & UARTTX_B) == 0) || ((HostUart.COMIEN & COMIEN_EDMAT) == 0) || ((uiCfg & 0x7) == DMA_STOP))
+      return -1;
+   iByte = *(unsigned char *)(uintptr_t)(pDesc->srcEndPtr - ((uiCfg>>4) & 0x3FF));
+   if(((uiCfg>>4) & 0x3FF) == 0)
+   {
+      pDesc->ctrlCfg.ctrlCfgVal = uiCfg & ~0x7u;
+      uiEn &= ~UARTTX_B;                   // Basic cycle done, channel disabled
+      Before();
+      UrtTxDmaInt(pADI_UART);              // DMA_UART_TX_Int_Handler()
+      After();
+   }
+   else
+      pDesc->ctrlCfg.ctrlCfgVal = uiCfg - (1<<4);
+   return iByte;
+}
+
+// A bus error disables the running channels, DMA_Err_Int_Handler() follows
+static int BusError(void)
+{
+   int iStop;
+
+   uiEn = 0;
+   HostDma.DMAERRCLR = 1;
+   Before();
+   iStop = DmaErrInt();
+   After();
+   HostDma.DMAERRCLR = 0;
+   return iStop;
+}
+
+static void TxDone(void)
+{
+   iTxDone++;
+}
+
+static void Check(int iOk, const char *szWhat)
+{
+   printf("%s %s\n", iOk ? "ok  " : "FAIL", szWhat);
+   if(!iOk)
+      iErr = 1;
+}
+
+// Fault part way through the first half, reception carries on in order
+static void RxFault(void)
+{
+   unsigned char aucRd[RX_SIZE];
+   int iNext = 0;
+   int iOrder = 1;
+   int iCnt, i1;
+
+   Start();
+   Before();
+   UrtRxDmaCfg(pADI_UART, aucRx, RX_SIZE);
+   After();
+   Check(uiEn & UARTRX_B, "UrtRxDmaCfg() enables UARTRX");
+   for(i1=0; i1<10; i1++)
+      DmaRxByte(i1);
+   Check(BusError() == 0, "RX bus error: DmaErrInt() leaves no channel stopped");
+   Check(uiEn & UARTRX_B, "RX bus error: UARTRX re-armed");
+   Check(DmaDiagRd()->usRearms[UARTRX_C-1] == 1, "RX bus error: one re-arm counted");
+   for(i1=10; i1<200; i1++)
+   {
+      if(!DmaRxByte(i1))
+         break;
+      if((i1 % 16) == 15)
+      {
+         iCnt = UrtRxDmaRd(pADI_UART, aucRd, sizeof(aucRd));
+         for(iCnt--; iCnt>=0; iCnt--)
+            if(aucRd[iCnt] != ((iNext+iCnt) & 0xFF))
+               iOrder = 0;
+         iNext = i1+1;
+      }
+   }
+   Check((i1 == 200) && iOrder, "RX bus error: 200 bytes received in order across the fault");
+}
+
+// Faults without progress: re-armed DMA_REARM_MAX times, then left stopped
+static void RxStuck(void)
+{
+   int iStop = 0;
+   int i1;
+
+   Start();
+   Before();
+   UrtRxDmaCfg(pADI_UART, aucRx, RX_SIZE);
+   After();
+   DmaRxByte(0);
+   for(i1=0; i1<DMA_REARM_MAX; i1++)
+      iStop |= BusError();
+   Check((iStop == 0) && (uiEn & UARTRX_B), "RX stuck: re-armed DMA_REARM_MAX times");
+   Check(BusError() == UARTRX_B, "RX stuck: left stopped after one more fault");
+   Check(DmaDiagRd()->usStops == UARTRX_B, "RX stuck: stop recorded by DmaDiagRd()");
+}
+
+// Fault part way through a UrtTxDma() block
+static void TxFault(void)
+{
+   int iByte;
+   int i1;
+
+   Start();
+   for(i1=0; i1<TX_LEN; i1++)
+      aucTx[i1] = 0xA0 + i1;
+   iTxOut = iTxDone = 0;
+   Before();
+   UrtTxDma(pADI_UART, aucTx, TX_LEN, TxDone);
+   After();
+   Check(uiEn & UARTTX_B, "UrtTxDma() enables UARTTX");
+   for(i1=0; i1<15; i1++)
+      aucTxOut[iTxOut++] = DmaTxByte();
+   Check(BusError() == 0, "TX bus error: DmaErrInt() leaves no channel stopped");
+   Check(uiEn & UARTTX_B, "TX bus error: UARTTX re-armed");
+   while((iTxOut < TX_LEN) && ((iByte = DmaTxByte()) >= 0))
+      aucTxOut[iTxOut++] = iByte;
+   Check((iTxOut == TX_LEN) && (memcmp(aucTx, aucTxOut, TX_LEN) == 0) && (iTxDone == 1),
+         "TX bus error: block sent whole and the callback raised once");
+}
+
+// A channel enabled by writing DMAENSET directly is not known to DmaErrInt()
+static void Direct(void)
+{
+   Start();
+   Before();
+   UrtRxDmaCfg(pADI_UART, aucRx, RX_SIZE);
+   After();
+   Start();                                // Forgets the channel, structures kept below
+   Before();
+   UrtRxDmaCfg(pADI_UART, aucRx, RX_SIZE);
+   After();
+   DmaClr(0, UARTRX_B, 0, 0);              // Takes it out of the DmaSet() channels
+   HostDma.DMAENCLR = 0;
+   uiEn |= UARTRX_B;                       // As a write of DMAENSET would
+   DmaRxByte(0);
+   BusError();
+   Check((uiEn & UARTRX_B) == 0, "direct DMAENSET write: channel ignored by DmaErrInt()");
+}
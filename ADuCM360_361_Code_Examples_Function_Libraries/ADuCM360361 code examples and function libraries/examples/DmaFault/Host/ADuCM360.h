@@ -0,0 +1,224 @@
+/**
+ *****************************************************************************
+   @file     ADuCM360.h
+   @brief    Register model of the ADuCM360 for host side tests.
+   - Stands in for the device header of the toolchain when library files
+     are built on a PC. Only the registers and bits used by DmaLib.c,
+     UrtLib.c, GptLib.c and RingLib.c are modelled.
+   - Registers are plain variables, defined by the test, with no side
+     effects: write-one-to-set and write-one-to-clear registers simply hold
+     the last value written. The test plays the DMA controller and sets
+     them as the hardware would.
+   - Not for use on the ADuCM360.
+
+   @version V0.1
+   @author  ADI
+   @date    October 2026
+
+   @par     Revision History:
+   - V0.1, October 2026: initial version.
+
+All files for ADuCM360/361 provided by ADI, including this file, are
+provided  as is without warranty of any kind, either expressed or implied.
+The user assumes any and all risk from the use of this code.
+It is the responsibility of the person integrating this code into an application
+to ensure that the resulting application performs as required and is safe.
+
+**/
+
+#ifndef ADUCM360_H
+#define ADUCM360_H
+
+#include <stdint.h>
+
+#define __IO	volatile
+#define __I		volatile
+
+typedef enum
+{
+   DMA_ERR_IRQn = 21,
+   DMA_SPI1_TX_IRQn, DMA_SPI1_RX_IRQn, DMA_UART_TX_IRQn, DMA_UART_RX_IRQn,
+   DMA_I2CS_TX_IRQn, DMA_I2CS_RX_IRQn, DMA_I2CM_TX_IRQn, DMA_I2CM_RX_IRQn,
+   DMA_DAC_IRQn, DMA_ADC0_IRQn, DMA_ADC1_IRQn, DMA_SINC2_IRQn
+} IRQn_Type;
+
+#define INT_NUM_DMA_FIRST	DMA_SPI1_TX_IRQn
+#define INT_NUM_DMA_LAST	DMA_SINC2_IRQn
+
+// Interrupt mask, a plain flag on the host
+extern uint32_t HostPrimask;
+#define __get_PRIMASK()		(HostPrimask)
+#define __set_PRIMASK(x)	(HostPrimask = (x))
+#define __disable_irq()		(HostPrimask = 1)
+#define __enable_irq()		(HostPrimask = 0)
+
+typedef struct
+{
+   __IO uint16_t COMTX;                    // COMRX shares the address
+   __IO uint16_t COMIEN;
+   __IO uint16_t COMIIR;
+   __IO uint16_t COMLCR;
+   __IO uint16_t COMMCR;
+   __IO uint16_t COMLSR;
+   __IO uint16_t COMMSR;
+   __IO uint16_t COMFBR;
+   __IO uint16_t COMDIV;
+} ADI_UART_TypeDef;
+#define COMRX	COMTX
+
+typedef struct
+{
+   __IO uint16_t LD;
+   __IO uint16_t VAL;
+   __IO uint16_t CON;
+   __IO uint16_t CLRI;
+   __IO uint16_t CAP;
+   __IO uint16_t STA;
+} ADI_TIMER_TypeDef;
+
+typedef struct
+{
+   __IO uint32_t DMASTA;
+   __IO uint32_t DMACFG;
+   __IO uint32_t DMAPDBPTR;
+   __IO uint32_t DMAADBPTR;
+   __IO uint32_t DMASWREQ;
+   __IO uint32_t DMARMSKSET;
+   __IO uint32_t DMARMSKCLR;
+   __IO uint32_t DMAENSET;
+   __IO uint32_t DMAENCLR;
+   __IO uint32_t DMAALTSET;
+   __IO uint32_t DMAALTCLR;
+   __IO uint32_t DMAPRISET;
+   __IO uint32_t DMAPRICLR;
+   __IO uint32_t DMAERRCLR;
+} ADI_DMA_TypeDef;
+
+typedef struct
+{
+   __IO uint32_t CLKCON0;
+   __IO uint32_t CLKCON1;
+   __IO uint32_t CLKDIS;
+   __IO uint32_t CLKSYSDIV;
+} ADI_CLKCTL_TypeDef;
+
+typedef struct {__IO uint32_t MSKI; __IO uint32_t DAT;} ADI_ADC_TypeDef;
+typedef struct {__IO uint32_t STEPDAT;} ADI_ADCSTEP_TypeDef;
+typedef struct {__IO uint32_t DACDAT;} ADI_DAC_TypeDef;
+typedef struct {__IO uint32_t SPITX; __IO uint32_t SPIRX;} ADI_SPI_TypeDef;
+typedef struct {__IO uint32_t I2CSTX; __IO uint32_t I2CSRX; __IO uint32_t I2CMTX; __IO uint32_t I2CMRX;} ADI_I2C_TypeDef;
+
+extern ADI_UART_TypeDef HostUart;
+extern ADI_TIMER_TypeDef HostTm0, HostTm1;
+extern ADI_DMA_TypeDef HostDma;
+extern ADI_CLKCTL_TypeDef HostClkCtl;
+extern ADI_ADC_TypeDef HostAdc0, HostAdc1;
+extern ADI_ADCSTEP_TypeDef HostAdcStep;
+extern ADI_DAC_TypeDef HostDac;
+extern ADI_SPI_TypeDef HostSpi1;
+extern ADI_I2C_TypeDef HostI2c;
+extern uint32_t HostTmBusy[2];
+
+#define pADI_UART		(&HostUart)
+#define pADI_TM0		(&HostTm0)
+#define pADI_TM1		(&HostTm1)
+#define pADI_DMA		(&HostDma)
+#define pADI_CLKCTL		(&HostClkCtl)
+#define pADI_ADC0		(&HostAdc0)
+#define pADI_ADC1		(&HostAdc1)
+#define pADI_ADCSTEP	(&HostAdcStep)
+#define pADI_DAC		(&HostDac)
+#define pADI_SPI1		(&HostSpi1)
+#define pADI_I2C		(&HostI2c)
+#define T0STA_CON_BBA	(HostTmBusy[0])
+#define T1STA_CON_BBA	(HostTmBusy[1])
+
+// UART
+#define COMIEN_ERBFI	0x01
+#define COMIEN_ETBEI	0x02
+#define COMIEN_ELSI		0x04
+#define COMIEN_EDSSI	0x08
+#define COMIEN_EDMAT	0x10
+#define COMIEN_EDMAR	0x20
+#define COMLCR_WLS_5BITS	0x00
+#define COMLCR_WLS_6BITS	0x01
+#define COMLCR_WLS_7BITS	0x02
+#define COMLCR_WLS_8BITS	0x03
+#define COMLCR_STOP_EN	0x04
+#define COMLCR_PEN_EN	0x08
+#define COMLCR_EPS_EN	0x10
+#define COMLCR_SP_EN	0x20
+#define COMLCR_BRK_DIS	0x00
+#define COMLCR_BRK_EN	0x40
+#define COMMCR_DTR		0x01
+#define COMMCR_RTS		0x02
+#define COMMCR_LOOPBACK	0x10
+#define COMLSR_DR		0x01
+#define COMLSR_OE		0x02
+#define COMLSR_PE		0x04
+#define COMLSR_FE		0x08
+#define COMLSR_BI		0x10
+#define COMLSR_THRE		0x20
+#define COMLSR_TEMT		0x40
+#define COMMSR_DCTS		0x01
+#define COMMSR_DDSR		0x02
+#define COMMSR_TERI		0x04
+#define COMMSR_DDCD		0x08
+#define COMMSR_CTS		0x10
+#define COMMSR_DSR		0x20
+#define COMMSR_RI		0x40
+#define COMMSR_DCD		0x80
+#define COMFBR_ENABLE_EN	0x8000
+
+// Timers
+#define TCON_PRE_DIV1		0x0000
+#define TCON_PRE_DIV16		0x0001
+#define TCON_PRE_DIV256		0x0002
+#define TCON_PRE_DIV32768	0x0003
+#define TCON_UP				0x0004
+#define TCON_MOD_FREERUN	0x0000
+#define TCON_MOD_PERIODIC	0x0008
+#define TCON_CLK_UCLK		0x0000
+#define TCON_CLK_PCLK		0x0020
+#define TCON_CLK_LFOSC		0x0040
+#define TCON_CLK_LFXTAL		0x0060
+#define TCON_ENABLE			0x0080
+#define TCON_ENABLE_DIS		0x0000
+#define TCON_ENABLE_EN		0x0080
+#define TCON_EVENT_MSK		0x0F00
+#define TCON_EVENTEN		0x1000
+#define TCON_RLD			0x2000
+#define TCON_RLD_DIS		0x0000
+#define TCON_RLD_EN			0x2000
+#define TSTA_TMOUT			0x0001
+#define TSTA_CAP			0x0002
+#define TSTA_CON			0x0080
+
+// DMA, one bit per channel in every set and clear register
+#define DMA_B(n)	(1u << (n))
+#define DMAENSET_SPI1TX		DMA_B(0)
+#define DMAENSET_SPI1RX		DMA_B(1)
+#define DMAENSET_UARTTX		DMA_B(2)
+#define DMAENSET_UARTRX		DMA_B(3)
+#define DMAENSET_I2CSTX		DMA_B(4)
+#define DMAENSET_I2CSRX		DMA_B(5)
+#define DMAENSET_I2CMTX		DMA_B(6)
+#define DMAENSET_I2CMRX		DMA_B(7)
+#define DMAENSET_DAC		DMA_B(8)
+#define DMAENSET_ADC0		DMA_B(9)
+#define DMAENSET_ADC1		DMA_B(10)
+#define DMAENSET_SINC2		DMA_B(11)
+#define DMAENCLR_UARTTX		DMAENSET_UARTTX
+#define DMAENCLR_UARTRX		DMAENSET_UARTRX
+#define DMAALTSET_UARTTX	DMAENSET_UARTTX
+#define DMAALTSET_UARTRX	DMAENSET_UARTRX
+#define DMAALTCLR_UARTTX	DMAENSET_UARTTX
+#define DMAALTCLR_UARTRX	DMAENSET_UARTRX
+#define DMARMSKSET_UARTTX	DMAENSET_UARTTX
+#define DMARMSKSET_UARTRX	DMAENSET_UARTRX
+#define DMARMSKCLR_UARTTX	DMAENSET_UARTTX
+#define DMARMSKCLR_UARTRX	DMAENSET_UARTRX
+#define DMAPRISET_UARTTX	DMAENSET_UARTTX
+#define DMAPRISET_UARTRX	DMAENSET_UARTRX
+
+#endif
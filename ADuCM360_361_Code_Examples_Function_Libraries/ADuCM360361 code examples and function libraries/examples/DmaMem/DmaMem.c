@@ -0,0 +1,141 @@
+/**
+ *****************************************************************************
+   @example    DmaMem.c
+   @brief      Benchmark of DmaMemcpy() against a word aligned CPU copy.
+   - Copies blocks of 16 to 4096 bytes with a CPU word loop, with DmaMemcpy()
+     waiting for the end and with DmaMemcpy() returning at once, and counts
+     core clock cycles with SysTick.
+   - Prints one line per length on the UART at 9600 baud, then the shortest
+     length the DMA copies faster, which is a good DMAMGR_MEM_MIN.
+   - The asynchronous column is the time the CPU spends starting the copy,
+     the rest of the copy runs while the CPU does other work.
+
+   @version  V0.1
+   @author   ADI
+   @date     October 2026
+   @par Revision History:
+   - V0.1, October 2026: initial version.
+
+
+All files for ADuCM360/361 provided by ADI, including this file, are
+provided  as is without warranty of any kind, either expressed or implied.
+The user assumes any and all risk from the use of this code.
+It is the responsibility of the person integrating this code into an application
+to ensure that the resulting application performs as required and is safe.
+
+**/
+
+#include <stdio.h>
+#include <string.h>
+#include <aducm360.h>
+
+#include <..\common\ClkLib.h>
+#include <..\common\WdtLib.h>
+#include <..\common\DioLib.h>
+#include <..\common\UrtLib.h>
+#include <..\common\DmaMgrLib.h>
+
+#define BENCH_MAX	4096
+
+unsigned long ulSrc[BENCH_MAX/4];
+unsigned long ulDst[BENCH_MAX/4];
+volatile int iAsyncDone = 0;
+char szTxt[80];
+
+void UARTINIT(void);
+void SendString(char *szStr);
+void CpuCopy(unsigned long *pulDst, const unsigned long *pulSrc, int iWords);
+void AsyncDone(int iChan, int iSta);
+unsigned long Cycles(unsigned long ulStart);
+
+int main (void)
+{
+   static const int iLen[] = {16, 32, 64, 128, 256, 512, 1024, 4096};
+   unsigned long ulCpu, ulDma, ulAsync, ulStart, ulZero;
+   int iCross = 0;
+   int i1;
+
+   pADI_WDT ->T3CON = 0;                             // Disable the watchdog timer
+   WdtCfg(T3CON_PRE_DIV1,T3CON_IRQ_EN,T3CON_PD_DIS); // Disable Watchdog timer resets
+   ClkCfg(CLK_CD0,CLK_HF,CLKSYSDIV_DIV2EN_DIS,CLK_UCLKCG); // Select CD0 for CPU clock - 16MHz
+   ClkSel(CLK_CD7,CLK_CD7,CLK_CD0,CLK_CD7);          // Select CD0 for UART clock
+   UARTINIT();
+   DmaMgrInit();                                     // Setup DMA controller, DMA interrupts
+   DmaMemCfg(0);                                     // Send every length to the DMA
+   SysTick->LOAD = 0xFFFFFF;                         // Free running, core clock
+   SysTick->VAL = 0;
+   SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk|SysTick_CTRL_ENABLE_Msk;
+   for(i1=0; i1<BENCH_MAX/4; i1++)
+      ulSrc[i1] = i1 * 0x01010101;
+
+   ulStart = SysTick->VAL;
+   ulZero = Cycles(ulStart);                         // Cost of reading SysTick
+
+   SendString("\r\nBytes   CPU   DMA wait   DMA async (cycles)\r\n");
+   for(i1=0; i1<(int)(sizeof(iLen)/sizeof(iLen[0])); i1++)
+   {
+      ulStart = SysTick->VAL;
+      CpuCopy(ulDst, ulSrc, iLen[i1]/4);
+      ulCpu = Cycles(ulStart) - ulZero;
+
+      ulStart = SysTick->VAL;
+      DmaMemcpy(ulDst, ulSrc, iLen[i1], 0);
+      ulDma = Cycles(ulStart) - ulZero;
+
+      iAsyncDone = 0;
+      ulStart = SysTick->VAL;
+      DmaMemcpy(ulDst, ulSrc, iLen[i1], AsyncDone);
+      ulAsync = Cycles(ulStart) - ulZero;
+      while(iAsyncDone == 0);
+
+      if(memcmp(ulDst, ulSrc, iLen[i1]) != 0)
+         SendString("Copy error\r\n");
+      if((iCross == 0) && (ulDma <= ulCpu))
+         iCross = iLen[i1];
+      sprintf(szTxt, "%5d %5lu %10lu %11lu\r\n", iLen[i1], ulCpu, ulDma, ulAsync);
+      SendString(szTxt);
+   }
+   if(iCross)
+      sprintf(szTxt, "DMA waits less from %d bytes\r\n", iCross);
+   else
+      sprintf(szTxt, "CPU copy always faster, use the DMA only asynchronously\r\n");
+   SendString(szTxt);
+   DmaMemCfg(iCross ? iCross : DMAMGR_MEM_MIN);
+   while (1)
+   {
+   }
+}
+
+// Word loop, the copy the DMA is compared with
+void CpuCopy(unsigned long *pulDst, const unsigned long *pulSrc, int iWords)
+{
+   while(iWords--)
+      *pulDst++ = *pulSrc++;
+}
+
+// Cycles since ulStart, SysTick counts down
+unsigned long Cycles(unsigned long ulStart)
+{
+   return (ulStart - SysTick->VAL) & 0xFFFFFF;
+}
+
+void AsyncDone(int iChan, int iSta)
+{
+   iAsyncDone = 1;
+}
+
+void UARTINIT(void)
+{
+   DioCfg(pADI_GP0,0x3C);                            // Configure P0.2/P0.1 for UART
+   UrtCfg(pADI_UART,B9600,COMLCR_WLS_8BITS,0);       // setup baud rate for 9600, 8-bits
+   UrtMod(pADI_UART,COMMCR_DTR,0);                   // Setup modem bits
+}
+
+void SendString(char *szStr)
+{
+   while(*szStr)
+   {
+      while((UrtLinSta(pADI_UART) & COMLSR_THRE) == 0);
+      UrtTx(pADI_UART, *szStr++);
+   }
+}
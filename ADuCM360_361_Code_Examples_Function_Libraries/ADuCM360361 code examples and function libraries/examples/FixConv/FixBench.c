@@ -0,0 +1,243 @@
+/**
+ *****************************************************************************
+   @example  FixBench.c
+   @brief    Host side error and timing sweep of the FixLib scales.
+   - Runs on a PC, not on the ADuCM360.
+   - Sets up the precomputed scales the examples use, for every PGA gain
+     with and without the modulator gain of 2:
+     - microvolts with FixAdcCfg(), for the internal 1.2V, AVDD 1.8V and an
+       external 2.5V reference,
+     - milliohms with FixScaleSet() for a resistor driven by each IEXC
+       current from 10uA to 1mA, at the internal reference,
+     - millidegrees with FixScaleSet() for a thermocouple taken as linear at
+       38.7uV/degC, the type T slope at 0degC, for each reference.
+   - Sweeps the signed 28-bit code range of each scale with FixMulBlk(),
+     ends included, and checks FixMul() gives the same results. The
+     largest error against the exact ratio, worked out in double, must stay
+     within half an output unit plus the rounding of the scale over the full
+     range. Also prints the largest error of the same conversion done with
+     float, as the examples did before FixLib.
+   - Prints the time per conversion of FixMulBlk(), FixMul() and float. The
+     time is in cycles of the time stamp counter on x86 hosts, in ns
+     elsewhere.
+   - Build and run:
+        gcc -O2 -I../../common -o FixBench FixBench.c ../../common/FixLib.c -lm
+        ./FixBench [code step]
+     The code step is 997 by default, 1 sweeps every code (slow).
+
+   @version V0.1
+   @author  ADI
+   @date    October 2026
+
+   @par     Revision History:
+   - V0.1, October 2026: initial version.
+
+All files for ADuCM360/361 provided by ADI, including this file, are
+provided  as is without warranty of any kind, either expressed or implied.
+The user assumes any and all risk from the use of this code.
+It is the responsibility of the person integrating this code into an application
+to ensure that the resulting application performs as required and is safe.
+
+**/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+
+#include "FixLib.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define TICK_UNIT	"cycles"
+static unsigned long long Ticks(void)
+{
+   return __rdtsc();
+}
+#else
+#define TICK_UNIT	"ns"
+static unsigned long long Ticks(void)
+{
+   struct timespec Ts;
+
+   clock_gettime(CLOCK_MONOTONIC, &Ts);
+   return Ts.tv_sec*1000000000ULL + Ts.tv_nsec;
+}
+#endif
+
+#define BLOCK		4096                   // Codes per FixMulBlk() call
+#define CODE_MAX	(1L << FIX_ADC_BITS)   // Full scale, +-Vref/gain
+#define ADCMOD2		0x8                    // ADCMDE_ADCMOD2, modulator gain of 2
+
+// ADCMDE_PGA_G1 to ADCMDE_PGA_G128
+static const int iPga[8] = {0x00, 0x10, 0x20, 0x30, 0x40, 0x50, 0x60, 0x70};
+
+static const unsigned long ulRef[3] = {FIX_REF_INT_UV, 1800000, 2500000};
+static const char *szRef[3] = {"int 1.2V", "AVDD 1.8V", "ext 2.5V"};
+static const unsigned long ulIexc[6] = {10, 50, 100, 200, 500, 1000};   // uA
+
+// One scale and its exact ratio num/(den*2^shift)
+typedef struct
+{
+   FixScale Scale;
+   double dRatio;
+} BenchScale;
+
+// Results of a group of scales
+typedef struct
+{
+   double dErr;                            // Largest FixLib error
+   double dBound;                          // Its allowed value for that scale
+   double dFloat;                          // Largest float error
+   unsigned long long ullBlk, ullOne, ullFloat;   // Ticks
+   long lConv;                             // Conversions timed
+   int iFail;
+} BenchSum;
+
+static int aiCode[BLOCK];
+static long alOut[BLOCK];
+static long lStep = 997;
+
+static int Gain(int iGain);
+static int ScaleSet(BenchScale *pB, unsigned long ulNum, unsigned long ulDen, int iDenShift);
+static void Sweep(const BenchScale *pB, BenchSum *pSum);
+static void Print(const char *szUnit, const char *szGroup, const BenchSum *pSum);
+
+int main(int argc, char *argv[])
+{
+   BenchScale B;
+   BenchSum Sum;
+   char szGroup[32];
+   int iFail = 0;
+   int i1, i2, i3;
+
+   if(argc > 1)
+      lStep = atol(argv[1]);
+   if(lStep < 1)
+   {
+      printf("usage: FixBench [code step]\n");
+      return 1;
+   }
+   printf("%-6s %-12s %10s %10s %10s %9s %9s %9s\n", "Unit", "Scales", "Max error",
+          "Allowed", "Float err", "Blk " TICK_UNIT, "FixMul", "float");
+   for(i1=0; i1<3; i1++)                   // Microvolts
+   {
+      Sum = (BenchSum){0};
+      for(i2=0; i2<16; i2++)
+      {
+         i3 = iPga[i2 & 7] | ((i2 & 8) ? ADCMOD2 : 0);
+         FixAdcCfg(&B.Scale, i3, ulRef[i1]);
+         B.dRatio = ulRef[i1] / ((double)Gain(i3) * CODE_MAX);
+         Sweep(&B, &Sum);
+      }
+      Print("uV", szRef[i1], &Sum);
+      iFail |= Sum.iFail;
+   }
+   for(i1=0; i1<6; i1++)                   // Milliohms, mohm = uV*1000/uA
+   {
+      Sum = (BenchSum){0};
+      for(i2=0; i2<16; i2++)
+      {
+         i3 = iPga[i2 & 7] | ((i2 & 8) ? ADCMOD2 : 0);
+         if(ScaleSet(&B, FIX_REF_INT_UV*1000UL, Gain(i3)*ulIexc[i1], FIX_ADC_BITS))
+            Sweep(&B, &Sum);
+         else
+            Sum.iFail = 1;
+      }
+      sprintf(szGroup, "IEXC %luuA", ulIexc[i1]);
+      Print("mohm", szGroup, &Sum);
+      iFail |= Sum.iFail;
+   }
+   for(i1=0; i1<3; i1++)                   // Millidegrees, mdeg = uV*10000/387 = uV*625*16/387
+   {
+      Sum = (BenchSum){0};
+      for(i2=0; i2<16; i2++)
+      {
+         i3 = iPga[i2 & 7] | ((i2 & 8) ? ADCMOD2 : 0);
+         if(ScaleSet(&B, ulRef[i1]*625, Gain(i3)*387UL, FIX_ADC_BITS-4))
+            Sweep(&B, &Sum);
+         else
+            Sum.iFail = 1;
+      }
+      Print("mdeg", szRef[i1], &Sum);
+      iFail |= Sum.iFail;
+   }
+   printf(iFail ? "FAIL\n" : "PASS\n");
+   return iFail;
+}
+
+// Gain of a FixAdcCfg() gain setting
+static int Gain(int iGain)
+{
+   return (1 << ((iGain >> 4) & 7)) << ((iGain & ADCMOD2) ? 1 : 0);
+}
+
+static int ScaleSet(BenchScale *pB, unsigned long ulNum, unsigned long ulDen, int iDenShift)
+{
+   pB->dRatio = ulNum / ((double)ulDen * ldexp(1, iDenShift));
+   return FixScaleSet(&pB->Scale, ulNum, ulDen, iDenShift);
+}
+
+// Converts every lStep-th code from -2^28 to 2^28 and adds to pSum
+static void Sweep(const BenchScale *pB, BenchSum *pSum)
+{
+   const FixScale *pS = &pB->Scale;
+   float fRatio = (float)pB->dRatio;
+   double dBound, dErr, dExact;
+   unsigned long long ullT;
+   volatile long lSink;
+   long lCode = -CODE_MAX;
+   int iNum, i1;
+
+   // Half an output unit, plus the scale rounding over the full range
+   dBound = 0.5 + fabs(pS->lMul/ldexp(1, pS->iShift) - pB->dRatio)*CODE_MAX + 1e-9;
+   while(lCode <= CODE_MAX)
+   {
+      for(iNum=0; (iNum < BLOCK) && (lCode <= CODE_MAX); iNum++)
+      {
+         aiCode[iNum] = lCode;
+         if((lCode < CODE_MAX) && (lCode + lStep > CODE_MAX))
+            lCode = CODE_MAX;              // Always end on full scale
+         else
+            lCode += lStep;
+      }
+      ullT = Ticks();
+      FixMulBlk(pS, aiCode, alOut, iNum);
+      pSum->ullBlk += Ticks() - ullT;
+      ullT = Ticks();
+      for(i1=0; i1<iNum; i1++)
+         lSink = FixMul(pS, aiCode[i1]);
+      pSum->ullOne += Ticks() - ullT;
+      ullT = Ticks();
+      for(i1=0; i1<iNum; i1++)
+         lSink = lrintf(aiCode[i1] * fRatio);
+      pSum->ullFloat += Ticks() - ullT;
+      pSum->lConv += iNum;
+      for(i1=0; i1<iNum; i1++)
+      {
+         dExact = aiCode[i1] * pB->dRatio;
+         dErr = fabs(alOut[i1] - dExact);
+         if(dErr > dBound)
+            pSum->iFail = 1;
+         if(FixMul(pS, aiCode[i1]) != alOut[i1])
+            pSum->iFail = 1;
+         if(dErr > pSum->dErr)
+         {
+            pSum->dErr = dErr;
+            pSum->dBound = dBound;
+         }
+         dErr = fabs(lrintf(aiCode[i1] * fRatio) - dExact);
+         if(dErr > pSum->dFloat)
+            pSum->dFloat = dErr;
+      }
+   }
+   (void)lSink;
+}
+
+static void Print(const char *szUnit, const char *szGroup, const BenchSum *pSum)
+{
+   printf("%-6s %-12s %10.3f %10.3f %10.1f %9.2f %9.2f %9.2f%s\n", szUnit, szGroup,
+          pSum->dErr, pSum->dBound, pSum->dFloat, (double)pSum->ullBlk/pSum->lConv,
+          (double)pSum->ullOne/pSum->lConv, (double)pSum->ullFloat/pSum->lConv,
+          pSum->iFail ? "  FAIL" : "");
+}
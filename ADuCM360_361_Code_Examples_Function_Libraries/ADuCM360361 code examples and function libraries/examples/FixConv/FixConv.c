@@ -0,0 +1,168 @@
+/**
+ *****************************************************************************
+   @example    FixConv.c
+   @brief      Benchmark of FixLib against the floating point conversions of
+               the RTD examples.
+   - Converts a block of 64 ADC codes at gain 32 to volts with floats as in
+     ADC0_DMA.c and to microvolts with FixMulBlk(), and counts core clock
+     cycles with SysTick.
+   - Works out an RTD temperature from the two voltages with floats as in
+     ADC0_DMA.c and with FixRatio() and FixLin(), and counts cycles.
+   - Prints the cycles and the largest difference to the float results on
+     the UART at 9600 baud.
+
+   @version V0.1
+   @author  ADI
+   @date    October 2026
+
+   @par     Revision History:
+   - V0.1, October 2026: initial version.
+
+
+All files for ADuCM360/361 provided by ADI, including this file, are
+provided  as is without warranty of any kind, either expressed or implied.
+The user assumes any and all risk from the use of this code.
+It is the responsibility of the person integrating this code into an application
+to ensure that the resulting application performs as required and is safe.
+
+**/
+
+#include <stdio.h>
+#include <aducm360.h>
+
+#include <..\common\ClkLib.h>
+#include <..\common\WdtLib.h>
+#include <..\common\DioLib.h>
+#include <..\common\UrtLib.h>
+#include <..\common\FixLib.h>
+
+#define BLOCK	64                            // Codes per block
+#define RREF	5600000                       // Reference resistor in milliohms
+
+//RTD constants and table of ADC0_DMA.c
+#define RMIN (84.2707)                        // = input resistance in ohms at -40 degC
+#define NSEG 30                               // = number of sections in table
+#define RSEG 2.12269                          // = (RMAX-RMIN)/NSEG = resistance  in ohms of each segment
+const float C_rtd[] = {-40.0006,-34.6322,-29.2542,-23.8669,-18.4704,-13.0649,-7.65042,-2.22714,3.20489,8.64565,14.0952,
+   19.5536,25.0208,30.497,35.9821,41.4762,46.9794,52.4917,58.0131,63.5436,69.0834,74.6325,80.1909,
+   85.7587,91.3359,96.9225,102.519,108.124,113.74,119.365,124.999};
+// Same table in millidegrees from 84.271ohm in 2.123ohm steps for FixLin()
+const long lRtdTab[] = {-39999,-34630,-29251,-23863,-18466,-13060,-7644,-2220,3213,8654,14105,
+   19564,25032,30509,35995,41490,46994,52507,58029,63560,69101,74651,80210,
+   85779,91357,96944,102541,108148,113764,119390,125025};
+const FixLinTab RtdTab = {84271, 2123, 30, lRtdTab};
+
+int iCode[BLOCK];                             // Codes as the DMA leaves them
+volatile int iAin1Code = 250536755;           // 1.12V, 200uA through 5.6kohm
+volatile int iRtdCode = 164048744;            // 22.9mV at gain 32, about 114.6ohm
+float fVolt[BLOCK];
+long lMicroVolt[BLOCK];
+char szTxt[100];
+
+void UARTINIT(void);
+void SendString(char *szStr);
+float CalculateRTDTemp(float r);
+unsigned long Cycles(unsigned long ulStart);
+long Abs(long lVal);
+
+int main (void)
+{
+   FixScale G1Uv, G32Uv;
+   unsigned long ulStart, ulZero, ulFloat, ulFix;
+   long lErr, lMaxErr = 0;
+   long lVAIN1, lVRTD, lRrtd, lTemp;
+   float fVAIN1, fVRTD, fTemp;
+   int i1;
+
+   pADI_WDT ->T3CON = 0;                             // Disable the watchdog timer
+   WdtCfg(T3CON_PRE_DIV1,T3CON_IRQ_EN,T3CON_PD_DIS); // Disable Watchdog timer resets
+   ClkCfg(CLK_CD0,CLK_HF,CLKSYSDIV_DIV2EN_DIS,CLK_UCLKCG); // Select CD0 for CPU clock - 16MHz
+   ClkSel(CLK_CD7,CLK_CD7,CLK_CD0,CLK_CD7);          // Select CD0 for UART clock
+   UARTINIT();
+   SysTick->LOAD = 0xFFFFFF;                         // Free running, core clock
+   SysTick->VAL = 0;
+   SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk|SysTick_CTRL_ENABLE_Msk;
+   FixAdcCfg(&G1Uv,ADCMDE_PGA_G1,FIX_REF_INT_UV);
+   FixAdcCfg(&G32Uv,ADCMDE_PGA_G32,FIX_REF_INT_UV);
+   for (i1 = 0; i1 < BLOCK; i1++)                    // Spread over the full scale
+      iCode[i1] = (i1 - BLOCK/2) * (0x10000000/(BLOCK/2)) + i1 * 4099;
+
+   ulStart = SysTick->VAL;
+   ulZero = Cycles(ulStart);                         // Cost of reading SysTick
+
+   /* Block of codes to volts */
+   ulStart = SysTick->VAL;
+   for (i1 = 0; i1 < BLOCK; i1++)
+      fVolt[i1] = (((float)iCode[i1]*1.2)/268435456)/32;
+   ulFloat = Cycles(ulStart) - ulZero;
+   ulStart = SysTick->VAL;
+   FixMulBlk(&G32Uv, iCode, lMicroVolt, BLOCK);
+   ulFix = Cycles(ulStart) - ulZero;
+   for (i1 = 0; i1 < BLOCK; i1++)
+   {
+      lErr = Abs(lMicroVolt[i1] - (long)(fVolt[i1]*1e6));
+      if (lErr > lMaxErr) lMaxErr = lErr;
+   }
+   sprintf(szTxt, "\r\n%d codes: float %lu, fixed %lu cycles, max diff %lduV\r\n",
+      BLOCK, ulFloat, ulFix, lMaxErr);
+   SendString(szTxt);
+
+   /* RTD temperature from the two voltages */
+   ulStart = SysTick->VAL;
+   fVAIN1 = ((float)iAin1Code*1.2)/268435456;
+   fVRTD = (((float)iRtdCode*1.2)/268435456)/32;
+   fTemp = CalculateRTDTemp(fVRTD/(fVAIN1/5600));
+   ulFloat = Cycles(ulStart) - ulZero;
+   ulStart = SysTick->VAL;
+   lVAIN1 = FixMul(&G1Uv, iAin1Code);
+   lVRTD = FixMul(&G32Uv, iRtdCode);
+   lRrtd = FixRatio(lVRTD, lVAIN1, RREF);
+   lTemp = FixLin(&RtdTab, lRrtd);
+   ulFix = Cycles(ulStart) - ulZero;
+   sprintf(szTxt, "RTD: float %lu, fixed %lu cycles, %ldmC, diff %ldmC\r\n",
+      ulFloat, ulFix, lTemp, lTemp - (long)(fTemp*1000));
+   SendString(szTxt);
+   while (1)
+   {
+   }
+}
+
+float CalculateRTDTemp(float r)
+{
+   float t;
+   int j;
+   j=(int)((r-RMIN)/RSEG);       // determine which coefficients to use
+   if (j<0)                      // if input is under-range..
+      j=0;                        // ..then use lowest coefficients
+   else if (j>NSEG-1)            // if input is over-range..
+      j=NSEG-1;                   // ..then use highest coefficients
+   t = C_rtd[j]+(r-(RMIN+RSEG*j))*(C_rtd[j+1]-C_rtd[j])/RSEG;
+   return t;
+}
+
+// Cycles since ulStart, SysTick counts down
+unsigned long Cycles(unsigned long ulStart)
+{
+   return (ulStart - SysTick->VAL) & 0xFFFFFF;
+}
+
+long Abs(long lVal)
+{
+   return (lVal < 0) ? -lVal : lVal;
+}
+
+void UARTINIT(void)
+{
+   DioCfg(pADI_GP0,0x3C);                            // Configure P0.2/P0.1 for UART
+   UrtCfg(pADI_UART,B9600,COMLCR_WLS_8BITS,0);       // setup baud rate for 9600, 8-bits
+   UrtMod(pADI_UART,COMMCR_DTR,0);                   // Setup modem bits
+}
+
+void SendString(char *szStr)
+{
+   while(*szStr)
+   {
+      while((UrtLinSta(pADI_UART) & COMLSR_THRE) == 0);
+      UrtTx(pADI_UART, *szStr++);
+   }
+}
@@ -0,0 +1,207 @@
+/**
+ *****************************************************************************
+   @example  LogDec.c
+   @brief    Host side decoder for records sent by LogLib.
+   - Runs on a Linux PC, not on the ADuCM360.
+   - Reads COBS frames from a serial port or stdin, checks their CRC and
+     prints the text each record stands for, using the format table of the
+     firmware that sent it.
+   - Build with the format table of the example used, for example CN0221:
+        gcc -O2 -DLOG_FMT_FILE='"../CN0221/LogFmt.h"' -I../../common
+            -o LogDec LogDec.c ../../common/CobsLib.c
+   - Run:
+        ./LogDec /dev/ttyUSB0 9600
+        ./LogDec < capture.bin
+
+   @version V0.1
+   @author  ADI
+   @date    October 2026
+
+   @par     Revision History:
+   - V0.1, October 2026: initial version.
+
+All files for ADuCM360/361 provided by ADI, including this file, are
+provided  as is without warranty of any kind, either expressed or implied.
+The user assumes any and all risk from the use of this code.
+It is the responsibility of the person integrating this code into an application
+to ensure that the resulting application performs as required and is safe.
+
+**/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <termios.h>
+
+#include "CobsLib.h"
+#include "LogLib.h"
+
+#ifndef LOG_FMT_FILE
+#error Define LOG_FMT_FILE as the format table of the firmware, see the build line above
+#endif
+
+// Format table, same order as the enum built on the target
+static const char *szFmtTbl[] = {
+#define LOG_FMT(eId, szFmt)	szFmt,
+#include LOG_FMT_FILE
+#undef LOG_FMT
+};
+#define FMT_CNT	((int)(sizeof(szFmtTbl)/sizeof(szFmtTbl[0])))
+
+static speed_t BaudCode(int iBaud);
+static int OpenPort(const char *szPath, int iBaud);
+static void PrintRec(const unsigned char *pucRec, int iLen);
+
+int main(int argc, char *argv[])
+{
+   unsigned char ucBuf[256];
+   unsigned char ucFrame[LOG_REC_MAX+2];
+   CobsDec Dec;
+   int iFd = 0;
+   int iSeq = -1;
+   int iCnt;
+   int iLen;
+   int i1;
+
+   if(argc > 1)
+   {
+      iFd = OpenPort(argv[1], (argc > 2) ? atoi(argv[2]) : 9600);
+      if(iFd < 0)
+         return 1;
+   }
+   CobsDecInit(&Dec, ucFrame, sizeof(ucFrame));
+   while((iCnt = read(iFd, ucBuf, sizeof(ucBuf))) > 0)
+   {
+      for(i1=0; i1<iCnt; i1++)
+      {
+         iLen = CobsDecPut(&Dec, ucBuf[i1]);
+         if(iLen == COBS_ERR)
+         {
+            printf("<bad frame>\n");
+            continue;
+         }
+         if(iLen < 2)
+            continue;
+         if((iSeq >= 0) && (ucFrame[0] != ((iSeq+1)&0xFF)))
+            printf("<%d records lost>\n", (ucFrame[0]-iSeq-1)&0xFF);
+         iSeq = ucFrame[0];
+         PrintRec(ucFrame, iLen);
+      }
+      fflush(stdout);
+   }
+   return 0;
+}
+
+static speed_t BaudCode(int iBaud)
+{
+   switch(iBaud)
+   {
+      case 1200: return B1200;
+      case 2400: return B2400;
+      case 4800: return B4800;
+      case 9600: return B9600;
+      case 19200: return B19200;
+      case 38400: return B38400;
+      case 57600: return B57600;
+      case 115200: return B115200;
+      case 230400: return B230400;
+      case 460800: return B460800;
+      default: return B0;
+   }
+}
+
+static int OpenPort(const char *szPath, int iBaud)
+{
+   struct termios Tio;
+   speed_t Speed = BaudCode(iBaud);
+   int iFd;
+
+   if(Speed == B0)
+   {
+      fprintf(stderr, "Unsupported baud rate %d\n", iBaud);
+      return -1;
+   }
+   iFd = open(szPath, O_RDONLY | O_NOCTTY);
+   if(iFd < 0)
+   {
+      perror(szPath);
+      return -1;
+   }
+   if(tcgetattr(iFd, &Tio) == 0)          // Serial port, a capture file is read as is
+   {
+      cfmakeraw(&Tio);
+      cfsetispeed(&Tio, Speed);
+      cfsetospeed(&Tio, Speed);
+      Tio.c_cflag |= CLOCAL | CREAD;
+      Tio.c_cc[VMIN] = 1;
+      Tio.c_cc[VTIME] = 0;
+      tcsetattr(iFd, TCSANOW, &Tio);
+   }
+   return iFd;
+}
+
+// Prints a record, taking one 32-bit argument for each conversion in its format
+static void PrintRec(const unsigned char *pucRec, int iLen)
+{
+   const char *pcFmt;
+   const unsigned char *pucArg = pucRec+2;
+   int iArgs = (iLen-2)/4;
+   char szSpec[32];
+   unsigned int uiArg;
+   float fArg;
+   int iSpec;
+
+   if(pucRec[1] >= FMT_CNT)
+   {
+      printf("<unknown format %d>\n", pucRec[1]);
+      return;
+   }
+   for(pcFmt = szFmtTbl[pucRec[1]]; *pcFmt; pcFmt++)
+   {
+      if(*pcFmt != '%')
+      {
+         putchar(*pcFmt);
+         continue;
+      }
+      if(pcFmt[1] == '%')
+      {
+         putchar('%');
+         pcFmt++;
+         continue;
+      }
+      // Copy the conversion, dropping length modifiers as every argument is 32 bits
+      iSpec = 0;
+      szSpec[iSpec++] = *pcFmt++;
+      while(*pcFmt && strchr("-+ #0123456789.hlLqjzt", *pcFmt) && (iSpec < (int)sizeof(szSpec)-3))
+      {
+         if(!strchr("hlLqjzt", *pcFmt))
+            szSpec[iSpec++] = *pcFmt;
+         pcFmt++;
+      }
+      if(*pcFmt == 0)
+         break;
+      szSpec[iSpec++] = *pcFmt;
+      szSpec[iSpec] = 0;
+      if(iArgs == 0)
+      {
+         printf("<?>");
+         continue;
+      }
+      uiArg = pucArg[0] | (pucArg[1]<<8) | (pucArg[2]<<16) | ((unsigned int)pucArg[3]<<24);
+      pucArg += 4;
+      iArgs--;
+      if(strchr("fFeEgGaA", *pcFmt))
+      {
+         memcpy(&fArg, &uiArg, 4);
+         printf(szSpec, (double)fArg);
+      }
+      else if(strchr("di", *pcFmt))
+         printf(szSpec, (int)uiArg);
+      else if(strchr("ouxXc", *pcFmt))
+         printf(szSpec, uiArg);
+      else
+         printf("<?>");
+   }
+}
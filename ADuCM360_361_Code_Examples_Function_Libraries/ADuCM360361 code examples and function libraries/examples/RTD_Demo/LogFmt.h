@@ -0,0 +1,31 @@
+/**
+ *****************************************************************************
+   @file     LogFmt.h
+   @brief    Format table of the records RTD_Demo.c logs.
+   - Included by RTD_Demo.c to number the formats and by the
+     host decoder LogDec.c to print them. Add new formats at the end so
+     decoders built for older firmware still print the existing ones.
+
+   @version V0.2
+   @author  ADI
+   @date    October 2026
+
+   @par     Revision History:
+   - V0.1, October 2026: initial version.
+   - V0.2, October 2026: Added LOG_RTD_GAIN.
+
+All files for ADuCM360/361 provided by ADI, including this file, are
+provided  as is without warranty of any kind, either expressed or implied.
+The user assumes any and all risk from the use of this code.
+It is the responsibility of the person integrating this code into an application
+to ensure that the resulting application performs as required and is safe.
+
+**/
+
+LOG_FMT(LOG_RREF_V,     "Voltage across Rref: %fV \r\n")
+LOG_FMT(LOG_RTD_V,      "Voltage across RTD : %fV \r\n")
+LOG_FMT(LOG_RTD_R,      "RTD Resistance: %fOhms \r\n")
+LOG_FMT(LOG_IEXC,       "Excitation current: %fA \r\n")
+LOG_FMT(LOG_RTD_T,      "RTD Temperature: %fC \r\n\n\n")
+LOG_FMT(LOG_ADC1_OVR,   "ADC Overvoltage error on ADC1 PGA  \r\n")
+LOG_FMT(LOG_RTD_GAIN,   "RTD gain: %u after %u gain changes \r\n")
@@ -10,20 +10,29 @@
    - 1) Measure AIN1/AGND v Internal 1.2V reference to derive exact Excitation current value
    - 2) Measure AIN0/AGND as a diagnostic - should equal sum of steps 1 and 2.
    - 3) Measure AIN0/AIN1 v Internal Vref to determine voltage across RTD (vRTD)
+        AdcAutoRes() picks the gain for this step, up to 32, from the results.
    - 4) RRTD is determined and final RTD temeprature calculated.
 
-   - The RTD reading is linearized and sent to the UART in a string format.
+   - The RTD reading is linearized and logged to the UART as binary records
+     with LogLib, read them on a PC with examples/LogDec built with
+     LOG_FMT_FILE set to RTD_Demo/LogFmt.h.
    - Default Baud rate is 9600
    - EVAL-ADuCM360MKZ or similar hardware is assumed
    - Results will be more accurate if System calibration is added 
 
-   @version V0.2
+   @version V0.4
    @author  ADI
-   @date    February 2013
+   @date    October 2026
 
    @par     Revision History:
    - V0.1, September 2012: initial version. 
    - V0.2, February 2013: Fixed a bug in SendString().
+   - V0.3, October 2026: Log results with LogWr1() instead of sprintf() and
+                         SendString(), records are sent by LogPoll() through
+                         the UART transmit ring while the ADC samples.
+   - V0.4, October 2026: Gain of step 3 chosen by AdcAutoCfg()/AdcAutoRes()
+                         instead of fixed at 32, each sample scaled by its
+                         own gain.
               
 All files for ADuCM360/361 provided by ADI, including this file, are
 provided  as is without warranty of any kind, either expressed or implied.
@@ -35,8 +44,6 @@ to ensure that the resulting application performs as required and is safe.
 
 
 
-#include <stdio.h>
-#include <string.h>
 #include <ADuCM360.h>
 
 #include <..\common\AdcLib.h>
@@ -51,13 +58,22 @@ to ensure that the resulting application performs as required and is safe.
 #include <..\common\IntLib.h>
 #include <..\common\PwmLib.h>
 #include <..\common\DioLib.h>
+#include <..\common\RingLib.h>
+#include <..\common\LogLib.h>
+
+enum {
+#define LOG_FMT(eId, szFmt)	eId,
+#include "LogFmt.h"
+#undef LOG_FMT
+};
 
 void ADC1INIT(void);                // Init ADC1
 void UARTINIT (void);
-void SendString(void);              // Transmit string using UART
 void IEXCINIT(void);                // Setup Excitation Current sources
-void SendResultToUART(void);        // Send measurement results to UART - in ASCII String format
-void SendErrorToUART(void);         // Send Error String to UART to indicate PGA overrange occured
+void SendResultToUART(void);        // Log measurement results, sent to the UART by LogPoll()
+void SendErrorToUART(void);         // Log an error to indicate PGA overrange occured
+void RxByte(int iByte);             // Called by UrtBufInt() for each byte received
+int LogOut(const unsigned char *pucData, int iLen);  // Output for LogPoll()
 float CalculateRTDTemp(float r);    // returns RTD Temperature reading
 
 #define SAMPLENO        0x8         // Number of samples to be taken between channel switching
@@ -87,13 +103,15 @@ volatile unsigned char ucADCERR = 0;      // Used to indicate an ADC error
 unsigned char ucSampleNo = 0;             // Used to keep track of when to switch channels
 unsigned char ucADCInput;                 // Used to indicate what channel the ADC1 is sampling
 volatile long ulADC1DATRtd[SAMPLENO];     // Variable that ADC1DAT is read into when sampling RTD
+volatile int iADC1GainRtd[SAMPLENO];      // Gain of each result in ulADC1DATRtd
+volatile unsigned char ucAutoRng = 0;     // Gain chosen by AdcAutoRes() while set
+unsigned long ulGainChg, ulGainOvr;       // Gain changes and overranges in step 3
 unsigned long ulADC1CONRtd;               // used to set ADC1CON which sets channel to RTD
 unsigned char ucCounter = 0;
 // UART-based external variables
-unsigned char ucTxBufferEmpty  = 0;       // Used to indicate that the UART Tx buffer is empty
-unsigned char szTemp[64] = "";            // Used to store string before printing to UART
-unsigned char nLen = 0;
-unsigned char i = 0;
+unsigned char ucTxRingBuf[256];           // Storage for the UART transmit ring
+RingBuf UartTxRing;                       // Drained by the THRE interrupt
+unsigned long ulLogBuf[64];               // Log records waiting for LogPoll()
 unsigned char ucWaitForUart = 0;          // Used by calibration routines to wait for user input
 
 int main (void)
@@ -131,7 +149,9 @@ int main (void)
       AdcGo(pADI_ADC1,ADCMDE_ADCMD_CONT);    // Start ADC1 for continuous conversions
       ucCounter = 0;
       while ( bSendResultToUART == 0)        // Wait for 8x samples to accumulate before calculating result
-      {}
+      {
+         LogPoll();                          // Send logged records while waiting
+      }
       AdcGo(pADI_ADC1,ADCMDE_ADCMD_IDLE);   // Put ADC1 into idle mode to allow re-configuration of its control registers
 
       for (ucCounter = 0; ucCounter < SAMPLENO; ucCounter++)
@@ -148,7 +168,9 @@ int main (void)
       AdcGo(pADI_ADC1,ADCMDE_ADCMD_CONT);    // Start ADC1 for continuous conversions
       ucCounter = 0;
       while ( bSendResultToUART == 0)        // Wait for 8x samples to accumulate
-      {}
+      {
+         LogPoll();                          // Send logged records while waiting
+      }
       AdcGo(pADI_ADC1,ADCMDE_ADCMD_IDLE);		// Put ADC1 into idle mode to allow re-configuration of its control registers
       for (ucCounter = 0; ucCounter < SAMPLENO; ucCounter++)
       {
@@ -161,18 +183,22 @@ int main (void)
 
    /* Step 3 - Measure AIN1 v AIN0 for voltage across RTD */
       AdcBuf(pADI_ADC1,ADCCFG_EXTBUF_OFF,ADC_BUF_ON);	// Turn ADC input buffers on for this differential measurement
-      AdcRng(pADI_ADC1,ADCCON_ADCREF_INTREF,ADCMDE_PGA_G32,ADCCON_ADCCODE_INT); // Set G=32 to measure across RTD
+      AdcAutoCfg(pADI_ADC1,ADCMDE_PGA_G1,ADCMDE_PGA_G32,2); // Start at G=1, go up to G=32 as the RTD voltage allows
       AdcPin(pADI_ADC1,ADCCON_ADCCN_AIN1,ADCCON_ADCCP_AIN0);	 // Select AIN0/AIN1 as differential inputs
+      ucAutoRng = 1;
       AdcGo(pADI_ADC1,ADCMDE_ADCMD_CONT);			// Start ADC1 for continuous conversions
       ucCounter = 0;
       while (	bSendResultToUART == 0)					// Wait for 8x samples to accumulate
-      {}
+      {
+         LogPoll();                          // Send logged records while waiting
+      }
       for (ucCounter = 0; ucCounter < SAMPLENO; ucCounter++)
       {
-         fVRTD += (((float)ulADC1DATRtd[ucCounter]*1.2)  / 268435456);
+         fVRTD += (((float)ulADC1DATRtd[ucCounter]*1.2)  / 268435456) / (1 << (iADC1GainRtd[ucCounter] >> 4));
       }
 
       bSendResultToUART = 0;
+      ucAutoRng = 0;
 
       fVRTD = fVRTD/SAMPLENO;                   // Calcualte voltage across RTD
       AdcGo(pADI_ADC1,ADCMDE_ADCMD_IDLE);
@@ -192,52 +218,34 @@ void UARTINIT (void)
 //    pADI_GP0->GPCON |= 0x9000;                   // Configure P0.6/P0.7 for UART
    UrtCfg(pADI_UART,B9600,COMLCR_WLS_8BITS,0);  // setup baud rate for 9600, 8-bits
    UrtMod(pADI_UART,COMMCR_DTR,0);              // Setup modem bits
-   UrtIntCfg(pADI_UART,COMIEN_ERBFI|COMIEN_ETBEI|COMIEN_ELSI|COMIEN_EDSSI|COMIEN_EDMAT|COMIEN_EDMAR);   // Setup UART IRQ sources
+   RingInit(&UartTxRing, ucTxRingBuf, sizeof(ucTxRingBuf));
+   UrtBufCfg(pADI_UART,&UartTxRing,0);          // Setup UART IRQ sources and Tx ring
+   UrtBufRxFn(pADI_UART,RxByte);                // Pass received bytes to RxByte()
+   LogCfg(ulLogBuf,64,LogOut);                  // Log records leave through the Tx ring
 }
-void SendString (void)
+int LogOut(const unsigned char *pucData, int iLen)
 {
-   for ( i = 0 ; i < nLen ; i++ )	// loop to send ADC0 result
-   {
-      ucTxBufferEmpty = 0;
-      UrtTx(pADI_UART,szTemp[i]);
-      while (ucTxBufferEmpty == 0)
-      {
-      }
-   }
-} 
+   return UrtBufWr(pADI_UART,pucData,iLen);     // Takes what fits, LogPoll() sends the rest later
+}
+void RxByte(int iByte)
+{
+   ucComRx = iByte;
+   ucWaitForUart = 0;
+}
 void SendResultToUART(void)
 {
-   sprintf ( (char*)szTemp, "Voltage across Rref: %fV \r\n",fVAIN1_AGND );                          
-   nLen = strlen((char*)szTemp);
-   if (nLen <64)
-      SendString();
-
-   sprintf ( (char*)szTemp, "Voltage across RTD : %fV \r\n",fVRTD );                          
-   nLen = strlen((char*)szTemp);
-   if (nLen <64)
-      SendString();
-
-   sprintf ( (char*)szTemp, "RTD Resistance: %fOhms \r\n",fRrtd );                          
-   nLen = strlen((char*)szTemp);
-   if (nLen <64)
-      SendString();
-
-   sprintf ( (char*)szTemp, "Excitation current: %fA \r\n",fIexc0 );                          
-   nLen = strlen((char*)szTemp);
-   if (nLen <64)
-      SendString();
-
-   sprintf ( (char*)szTemp, "RTD Temperature: %fC \r\n\n\n",fTRTD );                          
-   nLen = strlen((char*)szTemp);
-   if (nLen <64)
-      SendString();
+   LogWr1(LOG_RREF_V,LogFlt(fVAIN1_AGND));
+   LogWr1(LOG_RTD_V,LogFlt(fVRTD));
+   LogWr1(LOG_RTD_R,LogFlt(fRrtd));
+   LogWr1(LOG_IEXC,LogFlt(fIexc0));
+   LogWr1(LOG_RTD_T,LogFlt(fTRTD));
+   LogWr2(LOG_RTD_GAIN,1 << (AdcAutoSta(pADI_ADC1,&ulGainChg,&ulGainOvr) >> 4),ulGainChg);
+   if (ulGainOvr)
+      SendErrorToUART();                        // Overranged before the gain came down
 }
 void SendErrorToUART(void)
 {
-   sprintf ( (char*)szTemp, "ADC Overvoltage error on ADC1 PGA  \r\n");// Send error message to UART
-   nLen = strlen((char*)szTemp);
-   if (nLen <64)
-      SendString();
+   LogWr0(LOG_ADC1_OVR);                        // Log error message
 }
 void ADC1INIT(void)
 {
@@ -302,6 +310,7 @@ void ADC1_Int_Handler ()
 {
    volatile unsigned int uiADCSTA = 0;
    volatile long ulADC1DAT = 0;
+   int iGain = ADCMDE_PGA_G1;
 
    uiADCSTA = pADI_ADC1->STA;          // read ADC status register
    if ((uiADCSTA & 0x4) == 0x4)        // Check for ADC1TH exceeded error condition
@@ -311,8 +320,11 @@ void ADC1_Int_Handler ()
       pADI_ADC1->PRO = 0;              // Disable comparator
    }
    ulADC1DAT = AdcRd(pADI_ADC1);       // read ADC result register;
+   if (ucAutoRng && (AdcAutoRes(pADI_ADC1,uiADCSTA,ulADC1DAT,&iGain) == 0))
+      return;                          // Discarded while the gain settles
+   iADC1GainRtd[ucSampleNo] = iGain;
    ulADC1DATRtd[ucSampleNo++] = ulADC1DAT;
-   if (ucSampleNo > SAMPLENO)
+   if (ucSampleNo >= SAMPLENO)
    {
       ucSampleNo = 0;
       bSendResultToUART = 1;           // Set flag to indicate ready to send result to UART
@@ -324,18 +336,7 @@ void SINC2_Int_Handler()
 }
 void UART_Int_Handler ()
 {
-   volatile unsigned char ucCOMSTA0 = 0;
-   volatile unsigned char ucCOMIID0 = 0;
-
-   ucCOMIID0 = UrtIntSta(pADI_UART);   // Read UART Interrupt ID register
-   if ((ucCOMIID0 & 0x2) == 0x2)       // Transmit buffer empty
-   {
-      ucTxBufferEmpty = 1;
-   }
-   if ((ucCOMIID0 & 0x4) == 0x4)       // Receive byte
-   {
-      ucWaitForUart = 0;
-   }
+   UrtBufInt(pADI_UART);                        // Feed COMTX and pass received bytes to RxByte()
 } 
 void I2C0_Slave_Int_Handler(void)
 {
@@ -0,0 +1,251 @@
+/**
+ *****************************************************************************
+   @example  RingTest.c
+   @brief    Host side test of RingLib under simulated interrupt preemption.
+   - Runs on an x86 Linux PC, not on the ADuCM360.
+   - Each producer or consumer call of RingLib is single stepped with the
+     trap flag. For every instruction boundary of the call in turn, an
+     interrupt handler playing the other side of the ring runs once at
+     that boundary, as the THRE or RX interrupt of UrtLib would.
+   - Covers the transmit direction, main loop producer with RingPut() or
+     RingWr() against an interrupt consumer with RingGet() or RingRd(),
+     and the receive direction the other way round. The ring starts at
+     several fill levels with its free running indices just below 2^32,
+     so the calls wrap them.
+   - Every byte is a sequence number: the test checks that each byte comes
+     out once and in order and that RingCnt() stays within the ring size.
+   - Also checks full and empty at capacity.
+   - Build and run:
+        gcc -O2 -I../../common -o RingTest RingTest.c ../../common/RingLib.c
+        ./RingTest
+
+   @version V0.1
+   @author  ADI
+   @date    October 2026
+
+   @par     Revision History:
+   - V0.1, October 2026: initial version.
+
+All files for ADuCM360/361 provided by ADI, including this file, are
+provided  as is without warranty of any kind, either expressed or implied.
+The user assumes any and all risk from the use of this code.
+It is the responsibility of the person integrating this code into an application
+to ensure that the resulting application performs as required and is safe.
+
+**/
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <string.h>
+#include <signal.h>
+#include <ucontext.h>
+
+#include "RingLib.h"
+
+#if !defined(__x86_64__) && !defined(__i386__)
+#error Single stepping with the trap flag needs an x86 host
+#endif
+
+#define FLAG_TF	0x100                      // Trap flag of EFLAGS
+
+#define RING_SIZE	8
+#define MAIN_LEN	5                      // Bytes of the RingWr()/RingRd() calls of the main loop
+#define ISR_LEN	3                      // Bytes of the RingWr()/RingRd() calls of the handler
+
+enum {OP_PUT, OP_WR, OP_GET, OP_RD};
+static const char *szOp[4] = {"RingPut", "RingWr", "RingGet", "RingRd"};
+
+static unsigned char ucStore[RING_SIZE];
+static RingBuf Ring;
+static unsigned char ucNextPut;            // Sequence number of the next byte produced
+static unsigned char ucNextGet;            // Sequence number expected next
+static unsigned long ulPut, ulGot;         // Bytes produced and consumed
+static int iErr;
+
+static volatile int iStepping;
+static volatile long lStep;                // Instructions stepped in this run
+static volatile long lPreempt;             // Instruction after which the handler runs
+static int iIsrOp;
+
+static void Produce(int iOp, int iLen);
+static void Consume(int iOp, int iLen);
+static void Trap(int iSig, siginfo_t *pInfo, void *pCtx);
+static int Run(int iMainOp, int iIsrOp, int iFill, unsigned int uiStart, long lAt);
+static void Capacity(void);
+
+int main(void)
+{
+   static const int iFill[5] = {0, 1, RING_SIZE/2, RING_SIZE-1, RING_SIZE};
+   static const unsigned int uiStart[2] = {0xFFFFFFF8u, 0xFFFFFFFDu};
+   static const int iPair[8][2] = {
+      {OP_PUT, OP_GET}, {OP_PUT, OP_RD}, {OP_WR, OP_GET}, {OP_WR, OP_RD},  // Transmit
+      {OP_GET, OP_PUT}, {OP_GET, OP_WR}, {OP_RD, OP_PUT}, {OP_RD, OP_WR}}; // Receive
+   struct sigaction Sa;
+   long lAt, lPoints = 0;
+   int i1, i2, i3;
+
+   memset(&Sa, 0, sizeof(Sa));
+   Sa.sa_sigaction = Trap;
+   Sa.sa_flags = SA_SIGINFO;
+   sigaction(SIGTRAP, &Sa, 0);
+
+   for(i1=0; i1<8; i1++)
+   {
+      for(i2=0; i2<5; i2++)
+      {
+         for(i3=0; i3<2; i3++)
+         {
+            // Preempt after instruction 1, 2, ... until the call ends first
+            for(lAt=1; Run(iPair[i1][0], iPair[i1][1], iFill[i2], uiStart[i3], lAt); lAt++)
+               lPoints++;
+            if(iErr)
+            {
+               printf("FAIL main %s, handler %s, fill %d, start 0x%08X, preempted after %ld\n",
+                      szOp[iPair[i1][0]], szOp[iPair[i1][1]], iFill[i2], uiStart[i3], lAt);
+               return 1;
+            }
+         }
+      }
+   }
+   Capacity();
+   if(iErr)
+      return 1;
+   printf("PASS %ld preemption points, capacity checks\n", lPoints);
+   return 0;
+}
+
+// Adds iLen bytes of sequence numbers with iOp, as many as fit
+static void Produce(int iOp, int iLen)
+{
+   unsigned char ucData[8];
+   int iCnt;
+   int i1;
+
+   if(iOp == OP_PUT)
+   {
+      if(RingPut(&Ring, ucNextPut))
+      {
+         ucNextPut++;
+         ulPut++;
+      }
+      return;
+   }
+   for(i1=0; i1<iLen; i1++)
+      ucData[i1] = ucNextPut+i1;
+   iCnt = RingWr(&Ring, ucData, iLen);
+   ucNextPut += iCnt;
+   ulPut += iCnt;
+}
+
+// Removes up to iLen bytes with iOp and checks their sequence
+static void Consume(int iOp, int iLen)
+{
+   unsigned char ucData[8];
+   int iByte, iCnt;
+   int i1;
+
+   if(iOp == OP_GET)
+   {
+      iByte = RingGet(&Ring);
+      if(iByte < 0)
+         return;
+      if(iByte != ucNextGet)
+         iErr = 1;
+      ucNextGet++;
+      ulGot++;
+      return;
+   }
+   iCnt = RingRd(&Ring, ucData, iLen);
+   for(i1=0; i1<iCnt; i1++)
+   {
+      if(ucData[i1] != ucNextGet)
+         iErr = 1;
+      ucNextGet++;
+   }
+   ulGot += iCnt;
+}
+
+// Runs at each instruction boundary while stepping, as the interrupt handler
+static void Trap(int iSig, siginfo_t *pInfo, void *pCtx)
+{
+   ucontext_t *pUc = pCtx;
+
+   if(!iStepping)
+   {
+      pUc->uc_mcontext.gregs[REG_EFL] &= ~FLAG_TF;
+      return;
+   }
+   if(++lStep != lPreempt)
+      return;
+   if((RingCnt(&Ring) < 0) || (RingCnt(&Ring) > RING_SIZE))
+      iErr = 1;
+   if(iIsrOp >= OP_GET)
+      Consume(iIsrOp, ISR_LEN);
+   else
+      Produce(iIsrOp, ISR_LEN);
+}
+
+// One call iMainOp preempted after instruction lAt by iIsrOp, from iFill bytes
+// with the indices at uiStart. Returns 0 once the call ended before lAt.
+static int Run(int iMainOp, int iIsr, int iFill, unsigned int uiStart, long lAt)
+{
+   int i1;
+
+   RingInit(&Ring, ucStore, RING_SIZE);
+   Ring.uiHead = uiStart;
+   Ring.uiTail = uiStart;
+   ucNextPut = ucNextGet = 0;
+   ulPut = ulGot = 0;
+   for(i1=0; i1<iFill; i1++)
+      Produce(OP_PUT, 1);
+   iIsrOp = iIsr;
+   lStep = 0;
+   lPreempt = lAt;
+   iStepping = 1;
+   __asm__ volatile("pushf\n\torl %0,(%%"
+#if defined(__x86_64__)
+                    "rsp"
+#else
+                    "esp"
+#endif
+                    ")\n\tpopf" : : "i"(FLAG_TF) : "memory", "cc");
+   if(iMainOp >= OP_GET)
+      Consume(iMainOp, MAIN_LEN);
+   else
+      Produce(iMainOp, MAIN_LEN);
+   iStepping = 0;
+   __asm__ volatile("nop" ::: "memory");   // Trap clears the flag here
+   if((RingCnt(&Ring) < 0) || (RingCnt(&Ring) > RING_SIZE))
+      iErr = 1;
+   while(RingCnt(&Ring) > 0)               // What is left comes out in order too
+      Consume(OP_GET, 1);
+   if(ulGot != ulPut)
+      iErr = 1;
+   return (lStep >= lAt) && !iErr;
+}
+
+// Full and empty at capacity, across the 2^32 wrap of the indices
+static void Capacity(void)
+{
+   unsigned char ucData[RING_SIZE+2];
+   int i1;
+
+   RingInit(&Ring, ucStore, RING_SIZE);
+   Ring.uiHead = Ring.uiTail = 0xFFFFFFFCu;
+   for(i1=0; i1<RING_SIZE; i1++)
+      if(RingPut(&Ring, i1) != 1)
+         iErr = 1;
+   if((RingPut(&Ring, 0) != 0) || (RingWr(&Ring, ucData, 2) != 0) ||
+      (RingCnt(&Ring) != RING_SIZE) || (RingFree(&Ring) != 0))
+      iErr = 1;
+   if((RingRd(&Ring, ucData, RING_SIZE+2) != RING_SIZE) || (ucData[RING_SIZE-1] != RING_SIZE-1))
+      iErr = 1;
+   if((RingGet(&Ring) != -1) || (RingRd(&Ring, ucData, 1) != 0) ||
+      (RingCnt(&Ring) != 0) || (RingFree(&Ring) != RING_SIZE))
+      iErr = 1;
+   if((RingWr(&Ring, ucData, RING_SIZE+2) != RING_SIZE) || (RingFlush(&Ring) != RING_SIZE) ||
+      (RingCnt(&Ring) != 0) || (Ring.uiTail != 0xFFFFFFFCu + 2*RING_SIZE))
+      iErr = 1;
+   if(iErr)
+      printf("FAIL capacity\n");
+}
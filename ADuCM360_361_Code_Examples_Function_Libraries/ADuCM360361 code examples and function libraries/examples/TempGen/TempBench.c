@@ -0,0 +1,172 @@
+/**
+ *****************************************************************************
+   @example  TempBench.c
+   @brief    Host side benchmark of the temperature engines of TempCalc.c.
+   - Runs on a PC, not on the ADuCM360.
+   - For the thermocouple, cold junction and RTD conversions, converts a
+     sweep of the range of TempCalc.c with the float functions and with
+     each engine of TempEngSel(), and prints the time per conversion and
+     the largest error against the references of TempRef.c, NIST ITS-90
+     and IEC 60751.
+   - The time is in cycles of the time stamp counter on x86 hosts, in ns
+     elsewhere. The ADuCM360 has no FPU, so there the float functions are
+     much slower against the fixed-point engines than on a PC.
+   - Build and run:
+        gcc -O2 -DTEMP_BENCH -I../CN0300 -I../../common -o TempBench TempBench.c TempRef.c
+            ../CN0300/TempCalc.c ../../common/FixLib.c -lm
+        ./TempBench
+
+   @version V0.1
+   @author  ADI
+   @date    October 2026
+
+   @par     Revision History:
+   - V0.1, October 2026: initial version.
+
+All files for ADuCM360/361 provided by ADI, including this file, are
+provided  as is without warranty of any kind, either expressed or implied.
+The user assumes any and all risk from the use of this code.
+It is the responsibility of the person integrating this code into an application
+to ensure that the resulting application performs as required and is safe.
+
+**/
+
+#include <stdio.h>
+#include <math.h>
+#include <time.h>
+
+#include "TempCalc.h"
+#include "TempRef.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define TICK_UNIT	"cycles"
+static unsigned long long Ticks(void)
+{
+   return __rdtsc();
+}
+#else
+#define TICK_UNIT	"ns"
+static unsigned long long Ticks(void)
+{
+   struct timespec Ts;
+
+   clock_gettime(CLOCK_MONOTONIC, &Ts);
+   return Ts.tv_sec*1000000000ULL + Ts.tv_nsec;
+}
+#endif
+
+#define ENG_FLOAT	-1                     // Float functions of TempCalc.c
+#define SWEEP_MAX	40000
+#define REPEAT		20
+
+// One conversion of TempCalc.c
+typedef struct
+{
+   const char *szName;
+   const char *szUnit;                     // Unit of the output
+   long lXMin;                             // Sweep of the input
+   long lXMax;
+   long lXStep;
+   int (*pfnBlk)(const long *plX, long *plY, int iNum);
+   long (*pfnFloat)(long lX);
+   double (*pfnRef)(double dX);
+} TempConv;
+
+static long TcFloat(long lUv);
+static long CjFloat(long lMdeg);
+static long RtdFloat(long lMohm);
+static double TcRef(double dUv);
+static double CjRef(double dMdeg);
+static double RtdRef(double dMohm);
+
+static const TempConv Conv[3] = {
+   {"thermocouple uV to mdeg", "mdeg", -5603, 17819, 1,
+    CalculateThermoCoupleTempBlk, TcFloat, TcRef},
+   {"cold junction mdeg to uV", "uV", -40000, 125000, 5,
+    CalculateColdJVoltageBlk, CjFloat, CjRef},
+   {"RTD mohm to mdeg", "mdeg", 84271, 147951, 2,
+    CalculateRTDTempBlk, RtdFloat, RtdRef}};
+
+static const int iEng[4] = {ENG_FLOAT, TEMP_ENG_TAB, TEMP_ENG_FINE, TEMP_ENG_POLY};
+static const char *szEng[4] = {"float", "TEMP_ENG_TAB", "TEMP_ENG_FINE", "TEMP_ENG_POLY"};
+
+static long lX[SWEEP_MAX];
+static long lY[SWEEP_MAX];
+
+int main(void)
+{
+   const TempConv *pConv;
+   unsigned long long ullT, ullBest;
+   double dErr, dMax;
+   int iNum;
+   int i1, i2, i3, i4;
+
+   printf("%-26s %-14s %10s %12s\n", "Conversion", "Engine", TICK_UNIT, "Max error");
+   for(i1=0; i1<3; i1++)
+   {
+      pConv = &Conv[i1];
+      for(iNum=0; (iNum < SWEEP_MAX) && (pConv->lXMin + iNum*pConv->lXStep <= pConv->lXMax); iNum++)
+         lX[iNum] = pConv->lXMin + iNum*pConv->lXStep;
+      for(i2=0; i2<4; i2++)
+      {
+         if(iEng[i2] != ENG_FLOAT)
+            TempEngSel(iEng[i2]);
+         ullBest = ~0ULL;
+         for(i3=0; i3<REPEAT; i3++)        // Fastest pass, the others were interrupted
+         {
+            ullT = Ticks();
+            if(iEng[i2] == ENG_FLOAT)
+            {
+               for(i4=0; i4<iNum; i4++)
+                  lY[i4] = pConv->pfnFloat(lX[i4]);
+            }
+            else
+               pConv->pfnBlk(lX, lY, iNum);
+            ullT = Ticks() - ullT;
+            if(ullT < ullBest)
+               ullBest = ullT;
+         }
+         dMax = 0;
+         for(i4=0; i4<iNum; i4++)
+         {
+            dErr = fabs(lY[i4] - pConv->pfnRef(lX[i4]));
+            if(dErr > dMax)
+               dMax = dErr;
+         }
+         printf("%-26s %-14s %10.1f %9.1f %s\n", pConv->szName, szEng[i2],
+                (double)ullBest/iNum, dMax, pConv->szUnit);
+      }
+   }
+   return 0;
+}
+
+static long TcFloat(long lUv)
+{
+   return lrint(CalculateThermoCoupleTemp(lUv/1000000.0f)*1000);
+}
+
+static long CjFloat(long lMdeg)
+{
+   return lrint(CalculateColdJVoltage(lMdeg/1000.0f)*1000000);
+}
+
+static long RtdFloat(long lMohm)
+{
+   return lrint(CalculateRTDTemp(lMohm/1000.0f)*1000);
+}
+
+static double TcRef(double dUv)
+{
+   return RefTcT(dUv)*1000;
+}
+
+static double CjRef(double dMdeg)
+{
+   return RefTcUv(dMdeg/1000);
+}
+
+static double RtdRef(double dMohm)
+{
+   return RefRtdT(dMohm/1000)*1000;
+}
@@ -0,0 +1,285 @@
+/**
+ *****************************************************************************
+   @example  TempGen.c
+   @brief    Host side generator of the fixed-point temperature tables.
+   - Runs on a PC, not on the ADuCM360.
+   - Prints TempTab.h with the tables of the three engines of TempCalc.c:
+     - TEMP_ENG_TAB: the 30 segment thermocouple, cold junction and RTD
+       tables of TempCalc.c as FixSegTab tables of one slope and one
+       intercept per segment, for FixSeg() and FixSegBlk() in FixLib.
+     - TEMP_ENG_FINE: FixSegTab tables of 32 to 128 segments computed from
+       the references of TempRef.c, NIST ITS-90 and IEC 60751.
+     - TEMP_ENG_POLY: FixPolyTab polynomials for FixPoly(), the ITS-90
+       type T inverse and reference functions and a least squares fit of
+       the RTD inverse.
+   - Inputs and outputs are integers: microvolts for the thermocouple,
+     milliohms for the RTD and millidegrees for temperatures.
+   - Build and run after changing the tables of TempCalc.c or the segment
+     counts below, then copy the output to each example using TempCalc.c:
+        gcc -O2 -DTEMP_GEN -I../CN0300 -o TempGen TempGen.c TempRef.c ../CN0300/TempCalc.c -lm
+        ./TempGen > ../CN0300/TempTab.h
+        cp ../CN0300/TempTab.h ../CN0319/TempTab.h
+   - Check the engines with TempBench.
+
+   @version V0.2
+   @author  ADI
+   @date    October 2026
+
+   @par     Revision History:
+   - V0.1, October 2026: initial version.
+   - V0.2, October 2026: added the fine tables and the polynomials.
+
+All files for ADuCM360/361 provided by ADI, including this file, are
+provided  as is without warranty of any kind, either expressed or implied.
+The user assumes any and all risk from the use of this code.
+It is the responsibility of the person integrating this code into an application
+to ensure that the resulting application performs as required and is safe.
+
+**/
+
+#include <stdio.h>
+#include <math.h>
+
+#include "TempCalc.h"
+#include "TempRef.h"
+
+// Segments of the fine tables
+#define FINE_TC_P	128
+#define FINE_TC_N	128
+#define FINE_CJ_P	64
+#define FINE_CJ_N	32
+#define FINE_RTD	64
+
+// Order of the RTD inverse fit
+#define POLY_RTD	4
+
+#define SEG_MAX	128
+
+// Tables of TempCalc.c, in degC, mV and ohms
+extern const float C_themocoupleP[THER_N_SEG_P+1];
+extern const float C_themocoupleN[THER_N_SEG_N+1];
+extern const float C_cold_junctionP[COLDJ_N_SEG_P+1];
+extern const float C_cold_junctionN[COLDJ_N_SEG_N+1];
+extern const float C_rtd[];
+
+static void PrintTab(const char *szName, const char *szDesc, double dX0, double dStep,
+                     int iSeg, const float *pfY, double dYScale, int iReverse);
+static void PrintFine(const char *szName, const char *szDesc, long lXMin, long lXMax,
+                      int iSeg, double (*pfnY)(double));
+static void PrintSeg(const char *szName, const char *szDesc, double dX0, double dStep,
+                     int iSeg, const double *pdY);
+static void PrintPoly(const char *szName, const char *szDesc, long lXMin, long lXMax, long lX0,
+                      const double *pdD, int iOrder, double dXScale, double dYScale);
+static void FitPoly(double (*pfnY)(double), long lXMin, long lXMax, long lX0,
+                    int iOrder, double *pdD);
+static double TcMdeg(double dUv);
+static double CjUv(double dMdeg);
+static double RtdMdeg(double dMohm);
+
+int main(void)
+{
+   double dRtdD[POLY_RTD+1];
+   long lRtdMin = (long)floor(RefRtdOhm(TMIN)*1000);
+   long lRtdMax = (long)ceil(RefRtdOhm(TMAX)*1000);
+   long lTcMin = (long)floor(RefTcUv(THER_T_MAX_N));
+   long lTcMax = (long)ceil(RefTcUv(THER_T_MAX_P));
+
+   printf("// Generated by examples/TempGen from the tables of TempCalc.c, NIST ITS-90\n");
+   printf("// and IEC 60751, do not edit. Included by TempCalc.c only.\n");
+   printf("#ifndef TEMPTAB_H\n#define TEMPTAB_H\n");
+
+   printf("\n// TEMP_ENG_TAB\n");
+   PrintTab("TcPTab", "Thermocouple from 0, microvolts to millidegrees",
+            THER_V_MIN_P*1000, THER_V_SEG_P*1000, THER_N_SEG_P, C_themocoupleP, 1000, 0);
+   PrintTab("TcNTab", "Thermocouple below 0, microvolts to millidegrees",
+            THER_V_MAX_N*1000, -THER_V_SEG_N*1000, THER_N_SEG_N, C_themocoupleN, 1000, 1);
+   PrintTab("CjPTab", "Cold junction from 0, millidegrees to microvolts",
+            COLDJ_T_MIN_P*1000, COLDJ_T_SEG_P*1000, COLDJ_N_SEG_P, C_cold_junctionP, 1000, 0);
+   PrintTab("CjNTab", "Cold junction below 0, millidegrees to microvolts",
+            COLDJ_T_MAX_N*1000, -COLDJ_T_SEG_N*1000, COLDJ_N_SEG_N, C_cold_junctionN, 1000, 1);
+   PrintTab("RtdTab", "RTD, milliohms to millidegrees",
+            RMIN*1000, RSEG*1000, NSEG, C_rtd, 1000, 0);
+
+   printf("\n// TEMP_ENG_FINE\n");
+   PrintFine("TcPFine", "Thermocouple from 0, microvolts to millidegrees",
+             0, lTcMax, FINE_TC_P, TcMdeg);
+   PrintFine("TcNFine", "Thermocouple below 0, microvolts to millidegrees",
+             lTcMin, 0, FINE_TC_N, TcMdeg);
+   PrintFine("CjPFine", "Cold junction from 0, millidegrees to microvolts",
+             0, COLDJ_T_MAX_P*1000, FINE_CJ_P, CjUv);
+   PrintFine("CjNFine", "Cold junction below 0, millidegrees to microvolts",
+             COLDJ_T_MAX_N*1000, 0, FINE_CJ_N, CjUv);
+   PrintFine("RtdFine", "RTD, milliohms to millidegrees",
+             lRtdMin, lRtdMax, FINE_RTD, RtdMdeg);
+
+   printf("\n// TEMP_ENG_POLY\n");
+   PrintPoly("TcPPoly", "Thermocouple from 0, ITS-90 inverse, microvolts to millidegrees",
+             0, 20872, 0, dTcInvP, 6, 1, 1000);
+   PrintPoly("TcNPoly", "Thermocouple below 0, ITS-90 inverse, microvolts to millidegrees",
+             -5603, 0, 0, dTcInvN, 7, 1, 1000);
+   PrintPoly("CjPPoly", "Cold junction from 0, ITS-90, millidegrees to microvolts",
+             0, COLDJ_T_MAX_P*1000, 0, dTcFwdP, 8, 0.001, 1);
+   PrintPoly("CjNPoly", "Cold junction below 0, ITS-90, millidegrees to microvolts",
+             COLDJ_T_MAX_N*1000, 0, 0, dTcFwdN, 14, 0.001, 1);
+   FitPoly(RtdMdeg, lRtdMin, lRtdMax, (lRtdMin+lRtdMax)/2, POLY_RTD, dRtdD);
+   PrintPoly("RtdPoly", "RTD, least squares fit of IEC 60751, milliohms to millidegrees",
+             lRtdMin, lRtdMax, (lRtdMin+lRtdMax)/2, dRtdD, POLY_RTD, 1, 1);
+
+   printf("\n#endif\n");
+   return 0;
+}
+
+// Prints one table of iSeg segments from the iSeg+1 points pfY, spaced dStep from dX0.
+// iReverse takes the points from the end, for the tables below 0 stored from 0 down.
+static void PrintTab(const char *szName, const char *szDesc, double dX0, double dStep,
+                     int iSeg, const float *pfY, double dYScale, int iReverse)
+{
+   double dY[SEG_MAX+1];
+   int i1;
+
+   for(i1=0; i1<=iSeg; i1++)
+      dY[i1] = pfY[iReverse ? iSeg-i1 : i1]*dYScale;
+   PrintSeg(szName, szDesc, dX0, dStep, iSeg, dY);
+}
+
+// Prints one table of iSeg segments from lXMin to lXMax of the function pfnY
+static void PrintFine(const char *szName, const char *szDesc, long lXMin, long lXMax,
+                      int iSeg, double (*pfnY)(double))
+{
+   double dY[SEG_MAX+1];
+   double dStep = (double)(lXMax-lXMin)/iSeg;
+   int i1;
+
+   for(i1=0; i1<=iSeg; i1++)
+      dY[i1] = pfnY(lXMin + i1*dStep);
+   PrintSeg(szName, szDesc, lXMin, dStep, iSeg, dY);
+}
+
+// Prints one table of iSeg segments from the iSeg+1 points pdY, spaced dStep from dX0
+static void PrintSeg(const char *szName, const char *szDesc, double dX0, double dStep,
+                     int iSeg, const double *pdY)
+{
+   long long llX0 = (long long)floor(dX0);
+   double dM, dMax = 0;
+   int iFrac = 0;
+   int i1;
+
+   for(i1=0; i1<iSeg; i1++)
+   {
+      dM = fabs((pdY[i1+1]-pdY[i1])/dStep);
+      if(dM > dMax)
+         dMax = dM;
+   }
+   while((iFrac < 62) && (dMax*ldexp(1, iFrac+1) < 1073741824.0))
+      iFrac++;                             // Largest slope below 2^30
+   printf("\n// %s\n", szDesc);
+   printf("static const FixSegPt %sSeg[%d] = {\n", szName, iSeg);
+   for(i1=0; i1<iSeg; i1++)
+   {
+      dM = (pdY[i1+1]-pdY[i1])/dStep;
+      // Intercept of the segment line at the integer start of the table, half
+      // an output unit up as the shift in FixSeg() rounds down
+      printf("   {%11lld, %8lld}%s\n", llrint(dM*ldexp(1, iFrac)),
+             llrint(pdY[i1] + dM*(llX0 - (dX0 + i1*dStep)) + 0.5), (i1 < iSeg-1) ? "," : "");
+   }
+   printf("};\n");
+   printf("static const FixSegTab %s = {%lld, %lluu, %d, %d, %sSeg};\n", szName, llX0,
+          (unsigned long long)floor(4294967296.0/dStep), iSeg, iFrac, szName);
+}
+
+// Prints the polynomial dYScale*pdD(dXScale*(x-lX0)) for x from lXMin to lXMax
+static void PrintPoly(const char *szName, const char *szDesc, long lXMin, long lXMax, long lX0,
+                      const double *pdD, int iOrder, double dXScale, double dYScale)
+{
+   double dA[16];
+   double dU, dSum, dMax = 0;
+   long lSpan = (lXMax-lX0 > lX0-lXMin) ? lXMax-lX0 : lX0-lXMin;
+   int iBits = 0;
+   int iFrac = 0;
+   int i1, i2;
+
+   while((1L << iBits) <= lSpan)
+      iBits++;                             // |x-lX0| below 2^iBits
+   for(i1=0; i1<=iOrder; i1++)             // Coefficients for u = (x-lX0)/2^iBits
+      dA[i1] = dYScale*pdD[i1]*pow(dXScale*ldexp(1, iBits), i1);
+   for(i2=0; i2<=1000; i2++)               // Largest partial sum of the Horner form
+   {
+      dU = ((lXMin-lX0) + (lXMax-lXMin)*i2/1000.0)/ldexp(1, iBits);
+      dSum = 0;
+      for(i1=iOrder; i1>=0; i1--)
+      {
+         dSum = dSum*dU + dA[i1];
+         if(fabs(dSum) > dMax)
+            dMax = fabs(dSum);
+         if(fabs(dA[i1]) > dMax)
+            dMax = fabs(dA[i1]);
+      }
+   }
+   while((iFrac < 30) && (dMax*ldexp(1, iFrac+1) < 1073741824.0))
+      iFrac++;                             // Largest sum below 2^30
+   printf("\n// %s\n", szDesc);
+   printf("static const long %sC[%d] = {", szName, iOrder+1);
+   for(i1=0; i1<=iOrder; i1++)
+      printf("%s%lld%s", (i1%6 == 0) ? "\n   " : " ", llrint(dA[i1]*ldexp(1, iFrac)),
+             (i1 < iOrder) ? "," : "");
+   printf("\n};\n");
+   printf("static const FixPolyTab %s = {%ld, %ld, %ld, %d, %d, %d, %sC};\n", szName,
+          lX0, lXMin, lXMax, 31-iBits, iOrder, iFrac, szName);
+}
+
+// Least squares fit of pfnY from lXMin to lXMax by a polynomial in x-lX0
+static void FitPoly(double (*pfnY)(double), long lXMin, long lXMax, long lX0,
+                    int iOrder, double *pdD)
+{
+   double dM[8][9] = {{0}};
+   double dPow[16];
+   double dH = (lXMax-lX0 > lX0-lXMin) ? lXMax-lX0 : lX0-lXMin;
+   double dX, dV, dF;
+   int i1, i2, i3;
+
+   for(i3=0; i3<=2000; i3++)               // Normal equations in v = (x-lX0)/dH
+   {
+      dX = lXMin + (lXMax-lXMin)*i3/2000.0;
+      dV = (dX-lX0)/dH;
+      dPow[0] = 1;
+      for(i1=1; i1<=2*iOrder; i1++)
+         dPow[i1] = dPow[i1-1]*dV;
+      for(i1=0; i1<=iOrder; i1++)
+      {
+         for(i2=0; i2<=iOrder; i2++)
+            dM[i1][i2] += dPow[i1+i2];
+         dM[i1][iOrder+1] += dPow[i1]*pfnY(dX);
+      }
+   }
+   for(i1=0; i1<=iOrder; i1++)             // Gauss-Jordan, the matrix is well conditioned
+   {
+      for(i2=0; i2<=iOrder; i2++)
+      {
+         if(i2 == i1)
+            continue;
+         dF = dM[i2][i1]/dM[i1][i1];
+         for(i3=i1; i3<=iOrder+1; i3++)
+            dM[i2][i3] -= dF*dM[i1][i3];
+      }
+   }
+   for(i1=0; i1<=iOrder; i1++)
+      pdD[i1] = dM[i1][iOrder+1]/dM[i1][i1]/pow(dH, i1);
+}
+
+// Thermocouple millidegrees at dUv microvolts
+static double TcMdeg(double dUv)
+{
+   return RefTcT(dUv)*1000;
+}
+
+// Cold junction microvolts at dMdeg millidegrees
+static double CjUv(double dMdeg)
+{
+   return RefTcUv(dMdeg/1000);
+}
+
+// RTD millidegrees at dMohm milliohms
+static double RtdMdeg(double dMohm)
+{
+   return RefRtdT(dMohm/1000)*1000;
+}
@@ -0,0 +1,104 @@
+/**
+ *****************************************************************************
+   @file     TempRef.c
+   @brief    Host side reference conversions for TempGen and TempBench.
+   - Type T thermocouple emf from the NIST ITS-90 reference function,
+     inverted by bisection.
+   - Pt100 RTD resistance from the Callendar-Van Dusen equation of
+     IEC 60751, inverted by bisection.
+   - Runs on a PC, in double precision.
+
+   @version  V0.1
+   @author   ADI
+   @date     October 2026
+   @par Revision History:
+   - V0.1, October 2026: initial version.
+
+All files for ADuCM360/361 provided by ADI, including this file, are
+provided  as is without warranty of any kind, either expressed or implied.
+The user assumes any and all risk from the use of this code.
+It is the responsibility of the person integrating this code into an application
+to ensure that the resulting application performs as required and is safe.
+
+**/
+
+#include "TempRef.h"
+
+// NIST ITS-90 type T coefficients, NIST Monograph 175
+const double dTcFwdN[15] = {0.0, 3.8748106364e1, 4.4194434347e-2, 1.1844323105e-4,
+   2.0032973554e-5, 9.0138019559e-7, 2.2651156593e-8, 3.6071154205e-10,
+   3.8493939883e-12, 2.8213521925e-14, 1.4251594779e-16, 4.8768662286e-19,
+   1.0795539270e-21, 1.3945027062e-24, 7.9795153927e-28};
+const double dTcFwdP[9] = {0.0, 3.8748106364e1, 3.3292227880e-2, 2.0618243404e-4,
+   -2.1882256846e-6, 1.0996880928e-8, -3.0815758772e-11, 4.5479135290e-14,
+   -2.7512901673e-17};
+const double dTcInvN[8] = {0.0, 2.5949192e-2, -2.1316967e-7, 7.9018692e-10,
+   4.2527777e-13, 1.3304473e-16, 2.0241446e-20, 1.2668171e-24};
+const double dTcInvP[7] = {0.0, 2.592800e-2, -7.602961e-7, 4.637791e-11,
+   -2.165394e-15, 6.048144e-20, -7.293422e-25};
+
+// Pt100 Callendar-Van Dusen coefficients, IEC 60751
+#define RTD_R0 100.0
+#define RTD_A  3.9083e-3
+#define RTD_B  -5.775e-7
+#define RTD_C  -4.183e-12
+
+// Polynomial of order iOrder with coefficients pdC from order 0
+double RefPoly(const double *pdC, int iOrder, double dX)
+{
+   double dY = pdC[iOrder];
+
+   while(iOrder-- > 0)
+      dY = dY*dX + pdC[iOrder];
+   return dY;
+}
+
+// Thermocouple emf in uV at dT degC
+double RefTcUv(double dT)
+{
+   return (dT < 0) ? RefPoly(dTcFwdN, 14, dT) : RefPoly(dTcFwdP, 8, dT);
+}
+
+// Thermocouple temperature in degC for dUv uV, -270 to 400degC
+double RefTcT(double dUv)
+{
+   double dLo = -270, dHi = 400, dMid;
+   int i1;
+
+   for(i1=0; i1<60; i1++)                 // emf rises with temperature
+   {
+      dMid = (dLo+dHi)/2;
+      if(RefTcUv(dMid) < dUv)
+         dLo = dMid;
+      else
+         dHi = dMid;
+   }
+   return (dLo+dHi)/2;
+}
+
+// RTD resistance in ohms at dT degC
+double RefRtdOhm(double dT)
+{
+   double dR = RTD_R0*(1 + RTD_A*dT + RTD_B*dT*dT);
+
+   if(dT < 0)
+      dR += RTD_R0*RTD_C*(dT-100)*dT*dT*dT;
+   return dR;
+}
+
+// RTD temperature in degC for dOhm ohms, -200 to 850degC
+double RefRtdT(double dOhm)
+{
+   double dLo = -200, dHi = 850, dMid;
+   int i1;
+
+   for(i1=0; i1<60; i1++)
+   {
+      dMid = (dLo+dHi)/2;
+      if(RefRtdOhm(dMid) < dOhm)
+         dLo = dMid;
+      else
+         dHi = dMid;
+   }
+   return (dLo+dHi)/2;
+}
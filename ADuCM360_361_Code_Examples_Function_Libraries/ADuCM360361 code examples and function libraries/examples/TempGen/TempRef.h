@@ -0,0 +1,41 @@
+/**
+ *****************************************************************************
+   @file     TempRef.h
+   @brief    Host side reference conversions for TempGen and TempBench.
+   - Type T thermocouple emf from the NIST ITS-90 reference function,
+     inverted by bisection.
+   - Pt100 RTD resistance from the Callendar-Van Dusen equation of
+     IEC 60751, inverted by bisection.
+   - Runs on a PC, in double precision.
+
+   @version  V0.1
+   @author   ADI
+   @date     October 2026
+   @par Revision History:
+   - V0.1, October 2026: initial version.
+
+All files for ADuCM360/361 provided by ADI, including this file, are
+provided  as is without warranty of any kind, either expressed or implied.
+The user assumes any and all risk from the use of this code.
+It is the responsibility of the person integrating this code into an application
+to ensure that the resulting application performs as required and is safe.
+
+**/
+#ifndef TEMPREF_H
+#define TEMPREF_H
+
+// ITS-90 type T reference function, emf in uV from t in degC
+extern const double dTcFwdN[15];         // -270 to 0 degC
+extern const double dTcFwdP[9];          // 0 to 400 degC
+
+// ITS-90 type T inverse functions, t in degC from emf in uV, within 0.04degC
+extern const double dTcInvN[8];          // -5603 to 0 uV, -200 to 0 degC
+extern const double dTcInvP[7];          // 0 to 20872 uV, 0 to 400 degC
+
+extern double RefPoly(const double *pdC, int iOrder, double dX);
+extern double RefTcUv(double dT);
+extern double RefTcT(double dUv);
+extern double RefRtdOhm(double dT);
+extern double RefRtdT(double dOhm);
+
+#endif
@@ -0,0 +1,141 @@
+/**
+ *****************************************************************************
+   @example    Timestamp.c
+   @brief      This example shows TsLib timestamps on ADC blocks and external
+               interrupt edges.
+   - Timer 0 runs free at 1MHz as the time base with TsCfg().
+   - ADC0 converts AIN0/AIN1 continuously at about 1kHz into a ping-pong
+     buffer with AdcStreamStart(). Each full half of 128 results is stamped
+     with TsMark() as the DMA hands it over.
+   - Timer 0 latches its count on each rising edge of external interrupt 4
+     with TsCap(), so those stamps carry no interrupt latency.
+   - The main loop sends each event to the UART with its time in seconds and
+     the delay until it was sent, for a host to align with other data.
+   - Default Baud rate is 9600
+   - EVAL-ADuCM360MKZ or similar hardware is assumed
+
+   @version V0.1
+   @author  ADI
+   @date    October 2026
+
+   @par     Revision History:
+   - V0.1, October 2026: initial version.
+
+
+All files for ADuCM360/361 provided by ADI, including this file, are
+provided  as is without warranty of any kind, either expressed or implied.
+The user assumes any and all risk from the use of this code.
+It is the responsibility of the person integrating this code into an application
+to ensure that the resulting application performs as required and is safe.
+
+**/
+
+#include <stdio.h>
+#include <aducm360.h>
+
+#include <..\common\AdcLib.h>
+#include <..\common\ClkLib.h>
+#include <..\common\WdtLib.h>
+#include <..\common\DioLib.h>
+#include <..\common\UrtLib.h>
+#include <..\common\DmaLib.h>
+#include <..\common\IntLib.h>
+#include <..\common\TsLib.h>
+
+#define BLOCK	128                           // Results per half of the buffer
+#define TS_HZ	1000000                       // Timer 0 ticks per second, PCLK/16
+
+void ADC0INIT(void);                          // Init ADC0
+void UARTINIT(void);                          // Init UART
+void SendString(char *szStr);                 // Transmit string using UART
+void BlockDone(int *piData, int iNum);        // Called with each full half
+
+int iAdcBuf[2*BLOCK];                         // Ping-pong buffer filled by the DMA
+TsEvt Log[32];                                // Events not sent yet
+unsigned long ulBlocks = 0;                   // Blocks stamped
+char szTxt[80];
+
+int main (void)
+{
+   TsEvt Evt;
+   unsigned long long ullUs;
+
+   pADI_WDT ->T3CON = 0;                             // Disable the watchdog timer
+   WdtCfg(T3CON_PRE_DIV1,T3CON_IRQ_EN,T3CON_PD_DIS); // Disable Watchdog timer resets
+   ClkCfg(CLK_CD0,CLK_HF,CLKSYSDIV_DIV2EN_DIS,CLK_UCLKCG); // Select CD0 for CPU clock - 16MHz
+   ClkSel(CLK_CD7,CLK_CD7,CLK_CD0,CLK_CD7);          // Select CD0 for UART clock
+   UARTINIT();
+   TsLogCfg(Log,32);
+   TsCfg(pADI_TM0,TCON_CLK_PCLK,TCON_PRE_DIV16,TS_HZ); // Time base of 1us ticks
+   TsCap(T0CON_EVENT_EXT4,TS_SRC_EXT(4));            // Latch the time of each IRQ4 edge
+   NVIC_EnableIRQ(TIMER0_IRQn);
+   EiCfg(EXTINT4,INT_EN,INT_RISE);                   // Enable EINT4 on rising edges
+   NVIC_EnableIRQ(EINT4_IRQn);
+   DmaBase();                                        // Setup DMA controller
+   ADC0INIT();
+   AdcStreamStart(pADI_ADC0,iAdcBuf,BLOCK,BlockDone); // Start ADC0 for continuous conversions
+   while (1)
+   {
+      if (TsRd(&Evt))
+      {
+         ullUs = TsUs(Evt.ullTick);
+         sprintf(szTxt, "%s %lu at %lu.%06lus, sent +%luus, dropped %d\r\n",
+            (Evt.iSrc == TS_SRC_ADC0) ? "adc0" : "ext4", Evt.ulTag,
+            (unsigned long)(ullUs / 1000000), (unsigned long)(ullUs % 1000000),
+            (unsigned long)TsUs(TsNow() - Evt.ullTick), TsDrop());
+         SendString(szTxt);
+      }
+   }
+}
+
+// Runs in the DMA interrupt as each half completes
+void BlockDone(int *piData, int iNum)
+{
+   TsMark(TS_SRC_ADC0, ulBlocks++);                  // Stamp of the last result of the half
+}
+
+void ADC0INIT(void)
+{
+   AdcGo(pADI_ADC0,ADCMDE_ADCMD_IDLE);               // Place ADC0 in Idle mode
+   AdcMski(pADI_ADC0,ADCMSKI_RDY,1);                 // Enable ADC ready interrupt source
+   AdcFlt(pADI_ADC0,7,0,FLT_NORMAL);                 // ADC filter set for about 1kHz update rate
+   AdcRng(pADI_ADC0,ADCCON_ADCREF_INTREF,ADCMDE_PGA_G1,ADCCON_ADCCODE_INT); // Internal reference selected, Gain of 1, Signed integer output
+   AdcBuf(pADI_ADC0,ADCCFG_EXTBUF_OFF,ADC_BUF_ON);   // Turn on input buffers
+   AdcPin(pADI_ADC0,ADCCON_ADCCN_AIN1,ADCCON_ADCCP_AIN0); // Select AIN0 as postive input and AIN1 as negative input
+}
+
+void UARTINIT(void)
+{
+   DioCfg(pADI_GP0,0x3C);                            // Configure P0.2/P0.1 for UART
+   UrtCfg(pADI_UART,B9600,COMLCR_WLS_8BITS,0);       // setup baud rate for 9600, 8-bits
+   UrtMod(pADI_UART,COMMCR_DTR,0);                   // Setup modem bits
+}
+
+void SendString(char *szStr)
+{
+   while(*szStr)
+   {
+      while((UrtLinSta(pADI_UART) & COMLSR_THRE) == 0);
+      UrtTx(pADI_UART, *szStr++);
+   }
+}
+
+void GP_Tmr0_Int_Handler(void)
+{
+   TsInt();                                          // Count the wrap and log the capture
+}
+
+void Ext_Int4_Handler ()
+{
+   EiClr(EXTINT4);                                   // Clear EINT4 interrupt flag, the time is already latched
+}
+
+void DMA_ADC0_Int_Handler ()
+{
+   AdcStreamInt(pADI_ADC0);                          // Re-arm the full half and stamp it
+}
+
+void DMA_Err_Int_Handler ()
+{
+   DmaErrInt();                                      // Clear the error, re-arm the ADC channel
+}
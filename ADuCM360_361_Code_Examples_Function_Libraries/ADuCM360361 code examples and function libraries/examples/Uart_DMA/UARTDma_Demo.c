@@ -5,14 +5,18 @@
 	Trigerring external IRQ4 sends the number of times the IRQ was triggered
    over the uart
 
-   @version V0.2
+   @version V0.4
    @author  ADI
-   @date    February 2013
+   @date    October 2026
 
    @par     Revision History:
    - V0.1, October 2012: initial version. 
    - V0.2, February 2013: Removed unused function SendString() and variable 
    ucTxBufferEmpty.
+   - V0.3, October 2026: Transmit with UrtTxDma(), no dummy byte needed to
+   start the transfer.
+   - V0.4, October 2026: Receive continuously with UrtRxDmaCfg(), packets are
+   read from the ping-pong buffer so no bytes are lost while echoing.
               
 All files for ADuCM360/361 provided by ADI, including this file, are
 provided  as is without warranty of any kind, either expressed or implied.
@@ -43,7 +47,7 @@ void DMAINIT(void);
 // UART-based external variables
 unsigned char szTemp[64] = "";                       // Used to store string before printing to UART
 unsigned char szPacketIn[32];	                       // Used to store received bytes from UART
-unsigned char ucPacketRcvd = 0;                      // Flag to indicate Received packet
+unsigned char ucRxDmaBuf[64];                        // Ping-pong receive buffer, two halves of 32 bytes
 unsigned char nLen = 0;
 unsigned char i = 0;
 unsigned char ucSendString  = 0;                     // Used to trigger sending string to UART
@@ -74,32 +78,14 @@ int main (void)
          if (nLen <64)
 				 {
           
-					 DmaStructPtrOutSetup(UARTTX_C,64,szTemp);  // Setup UARTTX source/destination pointers and number of bytes to send
-					 DmaCycleCntCtrl(UARTTX_C,64,DMA_DSTINC_NO| // Setup CHNL_CFG settings
-				   	  DMA_SRCINC_BYTE|DMA_SIZE_BYTE|DMA_BASIC);
-					 DmaClr(DMARMSKCLR_UARTTX,0,0,0);           // Disable masking of UARTTX DMA channel
-	         DmaSet(0,DMAENSET_UARTTX,0,                // Enable UART TX DMA channel
- 	            DMAPRISET_UARTTX);                      // Enable UART DMA primary structure
-					 UrtTx(pADI_UART,0);                        // Send byte 0 to the UART to start transfer
+					 UrtTxDma(pADI_UART,szTemp,nLen,0);         // Send the string, returns while the DMA transmits
 				 }
 			 }
-			 if (ucPacketRcvd == 1)
+			 if (UrtRxDmaCnt(pADI_UART) >= 32)
 			 {
-				 ucPacketRcvd = 0;
-				 // Send out received packet first
-				 DmaStructPtrOutSetup(UARTTX_C,32,szPacketIn);//Setup UARTRX source/destination pointers and number of bytes to receive
-				 DmaCycleCntCtrl(UARTTX_C,32,DMA_DSTINC_NO|   // Setup CHNL_CFG settings
-				   	  DMA_SRCINC_BYTE|DMA_SIZE_BYTE|DMA_BASIC);
-					 DmaClr(DMARMSKCLR_UARTTX,0,0,0);           // Enable UART RX DMA channel
-	         DmaSet(0,DMAENSET_UARTTX,0,
- 	            DMAPRISET_UARTTX);                      // Enable UART DMA primary structure
-					 UrtTx(pADI_UART,0);                        // Send byte 0 to the UART to start transfer
-				 // re-enable UARTRX DMA
-				 	DmaStructPtrInSetup(UARTRX_C,32,szPacketIn);
-	        DmaCycleCntCtrl(UARTRX_C,32,DMA_DSTINC_BYTE|
-		        DMA_SRCINC_NO|DMA_SIZE_BYTE|DMA_BASIC);
-	        DmaClr(DMARMSKCLR_UARTRX,0,0,0);
-	        DmaSet(0,DMAENSET_UARTRX,0,0);              // Enable UART DMA primary structure
+				 while (UrtTxDmaBusy(pADI_UART)) {}           // Wait until szPacketIn is free
+				 UrtRxDmaRd(pADI_UART,szPacketIn,32);         // Reception carries on into the other half
+				 UrtTxDma(pADI_UART,szPacketIn,32,0);         // Echo the packet
 			 }
       delay(0x60000);		// Delay routine
 			DioTgl(pADI_GP1,0x8);                           // Toggle LED, P1.3
@@ -114,18 +100,8 @@ void UARTINIT (void)
    UrtCfg(pADI_UART,B9600,COMLCR_WLS_8BITS,0);        // setup baud rate for 9600, 8-bits
    UrtMod(pADI_UART,COMMCR_DTR,0);                    // Setup modem bits
    UrtIntCfg(pADI_UART,COMIEN_ERBFI|COMIEN_ETBEI|
-	   COMIEN_ELSI|COMIEN_EDSSI|COMIEN_EDMAT|
-	   COMIEN_EDMAR);                                   // Setup UART IRQ sources
-	UrtDma(pADI_UART,COMIEN_EDMAT|COMIEN_EDMAR);        // Enable UART DMA interrupts	
-	DmaPeripheralStructSetup(UARTTX_C,DMA_DSTINC_NO|    // Enable DMA write channel
-	    DMA_SRCINC_BYTE|DMA_SIZE_BYTE);
-	DmaPeripheralStructSetup(UARTRX_C,DMA_DSTINC_BYTE|  // Enable DMA UART Read channel
-	    DMA_SRCINC_NO|DMA_SIZE_BYTE);
-	DmaStructPtrInSetup(UARTRX_C,32,szPacketIn);
-	DmaCycleCntCtrl(UARTRX_C,32,DMA_DSTINC_BYTE|
-		DMA_SRCINC_NO|DMA_SIZE_BYTE|DMA_BASIC);
-	DmaClr(DMARMSKCLR_UARTRX,0,0,0);
-	DmaSet(0,DMAENSET_UARTRX,0,0);                      // Enable UART RX DMA primary structure
+	   COMIEN_ELSI|COMIEN_EDSSI);                       // Setup UART IRQ sources, EDMAT is set by UrtTxDma()
+	UrtRxDmaCfg(pADI_UART,ucRxDmaBuf,64);               // Continuous Rx DMA, sets EDMAR
 	
 }
 void DMAINIT(void)  
@@ -175,23 +151,11 @@ void UART_Int_Handler ()
 }
 void DMA_UART_TX_Int_Handler()
 {
-	volatile unsigned char ucCOMSTA0 = 0;
-   volatile unsigned char ucCOMIID0 = 0;
-
-   ucCOMIID0 = UrtIntSta(pADI_UART);                // Read UART Interrupt ID register 
-	 DmaSet(DMARMSKSET_UARTTX,DMAENSET_UARTTX,0,0);   // MASK UART DMA channel to prevent further interrupts triggering - unmask when ready to re-transmit
-  
+   UrtTxDmaInt(pADI_UART);                          // Masks the channel when done and raises the callback
 } 
 void DMA_UART_RX_Int_Handler()
 {
-	volatile unsigned char ucCOMSTA0 = 0;
-   volatile unsigned char ucCOMIID0 = 0;
-
-  DmaSet(DMARMSKSET_UARTRX,DMAENSET_UARTRX,0,0);    // MASK UART DMA RX channel to prevent further interrupts triggering - unmask when ready to re-transmit 
-	ucCOMIID0 = UrtIntSta(pADI_UART);                 // Read UART Interrupt ID register 
-	 ucPacketRcvd = 1;                                // Flag to indicate packet received
-	 
-  
+   UrtRxDmaInt(pADI_UART);                          // Re-arm the half just filled
 }
 void I2C0_Slave_Int_Handler(void)
 {
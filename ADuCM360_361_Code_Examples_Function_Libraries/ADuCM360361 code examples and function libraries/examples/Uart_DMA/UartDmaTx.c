@@ -4,14 +4,16 @@
    @brief    Uses Sprintf to scan a string and send to the UART using the DMA
 	 feature
 
-   @version V0.2
+   @version V0.3
    @author  ADI
-   @date    February 2013
+   @date    October 2026
 
    @par     Revision History:
    - V0.1, October 2012: initial version. 
    - V0.2, February 2013: Removed unused function SendString() and variable 
    ucTxBufferEmpty.
+   - V0.3, October 2026: Transmit with UrtTxDma(), no dummy byte needed to
+   start the transfer.
               
 All files for ADuCM360/361 provided by ADI, including this file, are
 provided  as is without warranty of any kind, either expressed or implied.
@@ -70,13 +72,7 @@ int main (void)
          nLen = strlen((char*)szTemp);
          if (nLen <64)
 				 {
-           DmaStructPtrOutSetup(UARTTX_C,64,szTemp);
-					 DmaCycleCntCtrl(UARTTX_C,64,DMA_DSTINC_NO|
-				   	  DMA_SRCINC_BYTE|DMA_SIZE_BYTE|DMA_BASIC);
-					 DmaClr(DMARMSKCLR_UARTTX,0,0,0);
-	         DmaSet(0,DMAENSET_UARTTX,0,
- 	            DMAPRISET_UARTTX);                      // Enable UART DMA primary structure
-					 UrtTx(pADI_UART,0);                        // Send byte 0 to the UART to start transfer
+					 UrtTxDma(pADI_UART,(unsigned char*)szTemp,nLen,0); // Send the string, returns while the DMA transmits
 				 }
 			 }
       delay(0x60000);		// Delay routine
@@ -92,11 +88,8 @@ void UARTINIT (void)
    UrtCfg(pADI_UART,B9600,COMLCR_WLS_8BITS,0);        // setup baud rate for 9600, 8-bits
    UrtMod(pADI_UART,COMMCR_DTR,0);                    // Setup modem bits
    UrtIntCfg(pADI_UART,COMIEN_ERBFI|COMIEN_ETBEI|
-	   COMIEN_ELSI|COMIEN_EDSSI|COMIEN_EDMAT|
-	   COMIEN_EDMAR);                                   // Setup UART IRQ sources
-	UrtDma(pADI_UART,COMIEN_EDMAT|COMIEN_EDMAR);        // Enable UART DMA interrupts	
-	DmaPeripheralStructSetup(UARTTX_C,DMA_DSTINC_NO|    // Enable DMA write channel
-	    DMA_SRCINC_BYTE|DMA_SIZE_BYTE);
+	   COMIEN_ELSI|COMIEN_EDSSI|COMIEN_EDMAR);          // Setup UART IRQ sources, EDMAT is set by UrtTxDma()
+	UrtDma(pADI_UART,COMIEN_EDMAR);                     // Enable UART DMA Rx requests
 	
 }
 void DMAINIT(void)  
@@ -147,12 +140,7 @@ void UART_Int_Handler ()
 }
 void DMA_UART_TX_Int_Handler()
 {
-	volatile unsigned char ucCOMSTA0 = 0;
-   volatile unsigned char ucCOMIID0 = 0;
-
-   ucCOMIID0 = UrtIntSta(pADI_UART);                // Read UART Interrupt ID register 
-	 DmaSet(DMARMSKSET_UARTTX,DMAENSET_UARTTX,0,0);   // MASK UART DMA channel to prevent further interrupts triggering - unmask when ready to re-transmit
-  
+   UrtTxDmaInt(pADI_UART);                          // Masks the channel when done and raises the callback
 } 
 
 void I2C0_Slave_Int_Handler(void)
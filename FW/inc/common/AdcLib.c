@@ -10,11 +10,20 @@
    - Start conversion with AdcGo().
    - Check with AdcSta() that result is available.
    - Read result with AdcRd().
+   - Or stream results without gaps with AdcStreamStart(), calling
+     AdcStreamInt() from the ADC DMA interrupt.
+   - Or measure a list of inputs with AdcScanStart(), calling AdcScanInt()
+     from the ADC DMA interrupt.
+   - Read the SINC2 filter next to the main filter with AdcFastStart() and
+     AdcFastRd(), calling AdcFastInt() from the SINC2 DMA interrupt.
+   - Let AdcAutoCfg() and AdcAutoRes() choose the PGA gain from the results.
+   - Or start ADC0 and ADC1 together with AdcDualStart() for paired results.
+   - Interrupt only on a step of the input with AdcStpCfg().
    - Example:
 
-   @version    V0.5
+   @version    V0.11
    @author     ADI
-   @date       April 2013
+   @date       October 2026
    @par Revision History:
    - V0.1, November 2010: initial version. 
    - V0.2, September 2012: Fixed AdcDiag() - correct bits are modified now.
@@ -25,6 +34,18 @@
    - V0.4, April 2013:   Changed AdcDetCon(). 
                          Removed BOOST15 option.
                          Fixed doxygen comments
+   - V0.6, October 2026: Added AdcStreamStart(), AdcStreamInt(), AdcStreamSta()
+                         and AdcStreamStop() for gapless DMA streaming.
+   - V0.7, October 2026: Added AdcScanStart(), AdcScanInt() and AdcScanSta()
+                         for scan lists run by the DMA.
+   - V0.8, October 2026: Added AdcFastStart(), AdcFastInt(), AdcFastRd(),
+                         AdcFastLast(), AdcFastSta() and AdcFastStop() for a
+                         SINC2 fast channel. Streams share one ping-pong core.
+   - V0.9, October 2026: Added AdcAutoCfg(), AdcAutoRes() and AdcAutoSta() for
+                         automatic PGA gain selection.
+   - V0.10, October 2026: Added AdcDualStart(), AdcDualSta() and AdcDualStop()
+                         for simultaneous ADC0 and ADC1 streams.
+   - V0.11, October 2026: Added AdcStpCfg() to interrupt on steps only.
 
 All files for ADuCM360/361 provided by ADI, including this file, are
 provided  as is without warranty of any kind, either expressed or implied.
@@ -39,6 +60,67 @@ to ensure that the resulting application performs as required and is safe.
 #include <ADuCM360.h>
 #include "DmaLib.h"
 
+// DMA configuration of both halves of a stream
+#define ADCSTRM_CFG	(DMA_DSTINC_WORD|DMA_SRCINC_NO|DMA_SIZE_WORD|DMA_PING)
+
+// State of a ping-pong stream: ADC0, ADC1 from AdcStreamStart(), SINC2 from AdcFastStart()
+typedef struct
+{
+	int *piBuf;									// 0 when stopped
+	int iHalf;									// Results in each half
+	volatile int iNext;							// Half that fills first, 0 primary, 1 alternate
+	volatile int iGaps;							// Times the DMA stopped
+	volatile unsigned long ulDone;				// Results in the halves handed on
+	unsigned long ulRd;							// Results read by AdcFastRd()
+	unsigned long ulLost;						// Results overwritten before AdcFastRd()
+	void (*pfHalf)(int *piData, int iNum);
+} AdcStrm;
+
+#define	ADCSTRM_SINC2	2						// Index of the SINC2 stream
+
+static AdcStrm AdcStrmSt[3];
+static const unsigned char ucStrmChan[3] = {ADC0_C, ADC1_C, SINC2_C};
+static const unsigned char ucStrmType[3] = {ADC0DMAREAD, ADC1DMAREAD, SINC2DMAREAD};
+static const IRQn_Type eStrmIrq[3] = {DMA_ADC0_IRQn, DMA_ADC1_IRQn, DMA_SINC2_IRQn};
+
+// State of the AdcDualStart() pairing of the ADC0 and ADC1 streams
+typedef struct
+{
+	int *piHalf[2];								// Last half handed on by each stream
+	unsigned long ulHalves[2];					// Halves handed on by each stream
+	unsigned long ulPairs;						// Frames passed to pfPair
+	void (*pfPair)(int *piAdc0, int *piAdc1, int iNum);
+} AdcDual;
+
+static AdcDual AdcDualSt;
+
+// State of an AdcScanStart() scan, one per ADC
+typedef struct
+{
+	unsigned long ulConWr;						// ADCDMACON in write mode, read by the DMA
+	unsigned long ulConRd;						// ADCDMACON in read mode, read by the DMA
+	volatile int iBusy;
+	void (*pfDone)(ADI_ADC_TypeDef *pPort);
+} AdcScan;
+
+static AdcScan AdcScanSt[2];
+
+// State of the AdcAutoCfg() gain control, one per ADC
+typedef struct
+{
+	int iGain;									// ADCMDE_PGA_ value in use
+	int iMin;									// Lowest gain allowed
+	int iMax;									// Highest gain allowed
+	int iSettle;								// Results discarded after each change
+	int iSkip;									// Results still to discard
+	int iLow;									// Results in a row below ADCAUTO_UP
+	int iPeak;									// Largest magnitude of those
+	unsigned long ulChg;						// Gain changes
+	unsigned long ulOvr;						// Results out of range
+} AdcAuto;
+
+static AdcAuto AdcAutoSt[2];
+
 /**
 	@brief int AdcRng(ADI_ADC_TypeDef *pPort, int iRef, int iGain, int iCode)
 			==========Sets ADC measurement range.
@@ -408,6 +490,146 @@ int AdcPGAErr(ADI_ADC_TypeDef *pPort, int iAdcSta)
 	return 1;
 	}
 
+// Changes the PGA gain and discards the results still in the filter
+static void AdcAutoSet(ADI_ADC_TypeDef *pPort, AdcAuto *pAu, int iGain)
+{
+	pPort->MDE = (pPort->MDE & ~ADCAUTO_PGA_MSK) | iGain;
+	pAu->iGain = iGain;
+	pAu->iSkip = pAu->iSettle;
+	pAu->iLow = 0;
+	pAu->iPeak = 0;
+	pAu->ulChg++;
+}
+
+/**
+	@brief int AdcAutoCfg(ADI_ADC_TypeDef *pPort, int iMinGain, int iMaxGain, int iSettle)
+			==========Lets AdcAutoRes() choose the PGA gain from the results.
+	@param pPort :{pADI_ADC0, pADI_ADC1}
+		- pADI_ADC0 for ADC0.
+		- pADI_ADC1 for ADC1.
+	@param iMinGain :{ADCMDE_PGA_G1,ADCMDE_PGA_G2,ADCMDE_PGA_G4,ADCMDE_PGA_G8,
+		ADCMDE_PGA_G16,ADCMDE_PGA_G32,ADCMDE_PGA_G64,ADCMDE_PGA_G128}
+		- Lowest gain used, the widest range. The ADC starts at this gain.
+	@param iMaxGain :{ADCMDE_PGA_G1,ADCMDE_PGA_G2,ADCMDE_PGA_G4,ADCMDE_PGA_G8,
+		ADCMDE_PGA_G16,ADCMDE_PGA_G32,ADCMDE_PGA_G64,ADCMDE_PGA_G128}
+		- Highest gain used, iMinGain or more.
+	@param iSettle :{0-255}
+		- Results discarded after each gain change, while the filter still holds
+		samples taken at the old gain. 2 covers the SINC3 filter, add more if
+		the input source needs time to recover.
+	@return 1 if successful or 0 if a parameter is out of range.
+	@note
+		- Call after AdcRng(), which sets the reference and the code format.
+		Results must be signed integers, ADCCON_ADCCODE_INT. ADCMDE_ADCMOD2 is
+		left as AdcRng() set it.
+		- The first iSettle results are discarded too.
+**/
+
+int AdcAutoCfg(ADI_ADC_TypeDef *pPort, int iMinGain, int iMaxGain, int iSettle)
+{
+	AdcAuto *pAu = &AdcAutoSt[pPort == pADI_ADC1];
+
+	if((iMinGain & ~ADCAUTO_PGA_MSK) || (iMaxGain & ~ADCAUTO_PGA_MSK) || (iMinGain > iMaxGain)
+		|| (iSettle < 0) || (iSettle > 255))
+		return 0;
+	pAu->iMin = iMinGain;
+	pAu->iMax = iMaxGain;
+	pAu->iSettle = iSettle;
+	AdcAutoSet(pPort, pAu, iMinGain);
+	pAu->ulChg = 0;
+	pAu->ulOvr = 0;
+	return 1;
+}
+
+/**
+	@brief int AdcAutoRes(ADI_ADC_TypeDef *pPort, int iSta, int iRes, int *piGain)
+			==========Checks a result and changes the PGA gain if needed.
+	@param pPort :{pADI_ADC0, pADI_ADC1}
+		- pADI_ADC0 for ADC0.
+		- pADI_ADC1 for ADC1.
+	@param iSta :{}
+		- ADCxSTA from AdcSta(), read before the result.
+	@param iRes :{}
+		- Result from AdcRd().
+	@param piGain :{}
+		- Set to the ADCMDE_PGA_ gain the result was taken at, with
+		ADCMDE_ADCMOD2 if set. Pass it to FixAdcCfg() to scale the result.
+	@return 1 if the result is valid or 0 if it is discarded.
+	@note
+		- Call from the ADC interrupt for each result, AdcAutoCfg() first.
+		- ADCxSTA_OVR, or ADCxSTA_THEX when AdcPGAErr() enabled the comparator,
+		discards the result and drops to the lowest gain at once.
+		- A result above ADCAUTO_DN is kept and the gain drops one step.
+		- After ADCAUTO_UP_CNT results in a row below ADCAUTO_UP the gain rises
+		to the highest that keeps the largest of them below ADCAUTO_TGT. The gap
+		between ADCAUTO_TGT and ADCAUTO_DN stops the gain from hunting.
+		- The iSettle results after each change are discarded.
+**/
+
+int AdcAutoRes(ADI_ADC_TypeDef *pPort, int iSta, int iRes, int *piGain)
+{
+	AdcAuto *pAu = &AdcAutoSt[pPort == pADI_ADC1];
+	int iMag = (iRes < 0) ? -iRes : iRes;
+	int iGain = pAu->iGain;
+
+	*piGain = pPort->MDE & (ADCAUTO_PGA_MSK|0x8);
+	if(pAu->iSkip)
+		{
+		pAu->iSkip--;
+		return 0;
+		}
+	if(iSta & ADCAUTO_STA_OVR)
+		{
+		pAu->ulOvr++;
+		if(iGain > pAu->iMin)
+			AdcAutoSet(pPort, pAu, pAu->iMin);
+		return 0;
+		}
+	if(iMag > ADCAUTO_DN)
+		{
+		if(iGain > pAu->iMin)
+			AdcAutoSet(pPort, pAu, iGain - 0x10);
+		return 1;
+		}
+	if((iMag >= ADCAUTO_UP) || (iGain == pAu->iMax))
+		{
+		pAu->iLow = 0;
+		pAu->iPeak = 0;
+		return 1;
+		}
+	if(iMag > pAu->iPeak)
+		pAu->iPeak = iMag;
+	if(++pAu->iLow >= ADCAUTO_UP_CNT)
+		{
+		while((iGain < pAu->iMax) && (pAu->iPeak <= (ADCAUTO_TGT >> (((iGain - pAu->iGain) >> 4) + 1))))
+			iGain += 0x10;				// Each step doubles the results
+		AdcAutoSet(pPort, pAu, iGain);
+		}
+	return 1;
+}
+
+/**
+	@brief int AdcAutoSta(ADI_ADC_TypeDef *pPort, unsigned long *pulChg, unsigned long *pulOvr)
+			==========Reads the state of the AdcAutoCfg() gain control.
+	@param pPort :{pADI_ADC0, pADI_ADC1}
+		- pADI_ADC0 for ADC0.
+		- pADI_ADC1 for ADC1.
+	@param pulChg :{}
+		- Set to the number of gain changes since AdcAutoCfg().
+	@param pulOvr :{}
+		- Set to the number of results out of range since AdcAutoCfg().
+	@return The ADCMDE_PGA_ gain in use.
+**/
+
+int AdcAutoSta(ADI_ADC_TypeDef *pPort, unsigned long *pulChg, unsigned long *pulOvr)
+{
+	AdcAuto *pAu = &AdcAutoSt[pPort == pADI_ADC1];
+
+	*pulChg = pAu->ulChg;
+	*pulOvr = pAu->ulOvr;
+	return pAu->iGain;
+}
+
 
    
 /**
@@ -438,6 +660,38 @@ int AdcDetCon(ADI_ADCSTEP_TypeDef *pPort, int iCtrl, int iAdcSel, int iRate )
    pPort->DETCON = i1;  
    return 1;
 }
+
+/**
+	@brief int AdcStpCfg(ADI_ADCSTEP_TypeDef *pPort, int iAdcSel, int iRate, int iTh)
+			==========Arms the step detector to interrupt on a step of the input.
+	@param pPort :{pADI_ADCSTEP,}
+		- pADI_ADCSTEP.
+	@param iAdcSel :{0,DETCON_ADCSEL}
+		- 0. ADC0 is the SINC2 filter source
+		- 0x4 or DETCON_ADCSEL. ADC1 is the SINC2 filter source
+	@param iRate :{DETCON_RATE_2ms, DETCON_RATE_4ms, DETCON_RATE_6ms, DETCON_RATE_8ms}
+		- SINC2 filter update rate, 2ms to 8ms.
+	@param iTh :{0-0xFFFF}
+		- STEPTH. A change of more than iTh between two SINC2 results sets
+		DETSTA_STEPFLAG, in the units of AdcStpRd().
+	@return 1.
+	@note
+		- Enables SINC2_IRQn. Call AdcDetSta() from SINC2_Int_Handler() and
+		read the new value with AdcStpRd().
+		- The ADC must convert continuously, its own ready interrupt can stay
+		off. The core can then sleep with PwrWait() and be woken by steps
+		only. Reference detection is left as AdcDetCon() set it.
+		- Shares the SINC2 filter with AdcFastStart().
+**/
+int AdcStpCfg(ADI_ADCSTEP_TypeDef *pPort, int iAdcSel, int iRate, int iTh)
+{
+	pPort->DETCON &= ~0x80;						// SINC2 off while the threshold changes
+	pPort->STEPTH = iTh;
+	pPort->DETCON = (pPort->DETCON & ~0x87) | 0x80 | (iAdcSel & 0x4) | (iRate & 0x3);
+	NVIC_ClearPendingIRQ(SINC2_IRQn);
+	NVIC_EnableIRQ(SINC2_IRQn);
+	return 1;
+}
 /**
 	@brief int AdcDmaCon(int iChan, int iEnable)	
 	 			==========First part of setting up ADC DMA channel structure	
@@ -518,4 +772,571 @@ return 1;
 }
 
 
+// Arms both halves of stream iIdx and starts its DMA channel
+static int AdcStrmArm(int iIdx, int *piBuf, int iHalf, void (*pfHalf)(int *piData, int iNum))
+{
+	AdcStrm *pSt = &AdcStrmSt[iIdx];
+	int iType = ucStrmType[iIdx];
+	int iChan = ucStrmChan[iIdx];
+	int iBit = 1 << (iChan - 1);
+
+	if((piBuf == 0) || (iHalf < 1) || (iHalf > 1024))
+		return 0;
+	DmaSet(iBit, 0, 0, 0);						// Mask the channel while it is set up
+	DmaClr(0, iBit, 0, 0);
+	pSt->piBuf = 0;								// AdcStrmSrv() ignores the channel meanwhile
+	if((AdcDmaReadSetup(iType, ADCSTRM_CFG, iHalf, piBuf) == 0)
+		|| (AdcDmaReadSetup(iType + iALTERNATE, ADCSTRM_CFG, iHalf, piBuf + iHalf) == 0)
+		|| DmaDescChk(iChan) || DmaDescChk(iChan + ALTERNATE))
+		return 0;
+	pSt->iHalf = iHalf;
+	pSt->iNext = 0;
+	pSt->iGaps = 0;
+	pSt->ulDone = 0;
+	pSt->ulRd = 0;
+	pSt->ulLost = 0;
+	pSt->pfHalf = pfHalf;
+	pSt->piBuf = piBuf;
+	AdcDmaCon(iType, 1);
+	NVIC_ClearPendingIRQ(eStrmIrq[iIdx]);
+	NVIC_EnableIRQ(eStrmIrq[iIdx]);
+	DmaClr(0, 0, iBit, 0);						// Start on the primary structure
+	DmaClr(iBit, 0, 0, 0);
+	DmaSet(0, iBit, 0, 0);
+	return 1;
+}
+
+// Re-arms the filled halves of stream iIdx, restarts the channel if it stopped
+static int AdcStrmSrv(int iIdx)
+{
+	AdcStrm *pSt = &AdcStrmSt[iIdx];
+	int iChan = ucStrmChan[iIdx];
+	int iBit = 1 << (iChan - 1);
+	int iNum = 0;
+
+	if(pSt->piBuf == 0)
+		return 0;
+	while((iNum < 2) && (Dma_GetDescriptor(iChan - 1, pSt->iNext)->ctrlCfg.Bits.cycle_ctrl == DMA_STOP))
+	{
+		DmaCycleCntCtrl(iChan + (pSt->iNext ? ALTERNATE : 0), pSt->iHalf, ADCSTRM_CFG);
+		pSt->ulDone += pSt->iHalf;
+		if(pSt->pfHalf)
+			pSt->pfHalf(pSt->piBuf + pSt->iNext * pSt->iHalf, pSt->iHalf);
+		pSt->iNext ^= 1;
+		iNum++;
+	}
+	if(!(pADI_DMA->DMAENSET & iBit))			// Both halves were full, restart
+	{
+		pSt->iGaps++;
+		if(pSt->iNext)
+			DmaSet(0, 0, iBit, 0);
+		else
+			DmaClr(0, 0, iBit, 0);
+		DmaSet(0, iBit, 0, 0);
+	}
+	return iNum;
+}
+
+// Stops the DMA channel of stream iIdx
+static void AdcStrmEnd(int iIdx)
+{
+	int iBit = 1 << (ucStrmChan[iIdx] - 1);
+
+	NVIC_DisableIRQ(eStrmIrq[iIdx]);
+	DmaSet(iBit, 0, 0, 0);
+	DmaClr(0, iBit, 0, 0);
+	AdcDmaCon(ucStrmType[iIdx], 0);
+	AdcStrmSt[iIdx].piBuf = 0;
+}
+
+/**
+	@brief int AdcStreamStart(ADI_ADC_TypeDef *pPort, int *piBuf, int iHalf, void (*pfHalf)(int *piData, int iNum))
+			==========Starts gapless continuous conversions into a ping-pong buffer.
+	@param pPort :{pADI_ADC0, pADI_ADC1}
+		- pADI_ADC0 for ADC0.
+		- pADI_ADC1 for ADC1.
+	@param piBuf :{}
+		- Buffer of 2*iHalf results. The primary DMA structure fills the
+		first half, the alternate structure the second half.
+	@param iHalf :{1-1024}
+		- Number of results in each half.
+	@param pfHalf :{}
+		- Called from AdcStreamInt() as pfHalf(piData, iHalf) with each half
+		that has been filled, while the DMA fills the other half. It must
+		be done with the data within iHalf conversions.
+	@return 1 if started or 0 if a parameter is out of range or DmaDescChk()
+		finds the buffer outside SRAM.
+	@note
+		- Set up the ADC with AdcRng(), AdcFlt(), AdcPin() and
+		AdcMski(pPort,ADCMSKI_RDY,1) and DmaBase() before.
+		- The ADC is left in ADCMDE_ADCMD_CONT and never stopped by the
+		library. Call AdcStreamInt() from DMA_ADC0_Int_Handler() or
+		DMA_ADC1_Int_Handler().
+**/
+
+int AdcStreamStart(ADI_ADC_TypeDef *pPort, int *piBuf, int iHalf, void (*pfHalf)(int *piData, int iNum))
+{
+	AdcGo(pPort, ADCMDE_ADCMD_IDLE);
+	if(AdcStrmArm(pPort == pADI_ADC1, piBuf, iHalf, pfHalf) == 0)
+		return 0;
+	AdcGo(pPort, ADCMDE_ADCMD_CONT);
+	return 1;
+}
+
+/**
+	@brief int AdcStreamInt(ADI_ADC_TypeDef *pPort)
+			==========Hands the filled halves to the callback and re-arms them.
+	@param pPort :{pADI_ADC0, pADI_ADC1}
+		- pADI_ADC0 from DMA_ADC0_Int_Handler().
+		- pADI_ADC1 from DMA_ADC1_Int_Handler().
+	@return Number of halves handed to the callback, 0 to 2.
+	@note
+		- Each structure is re-armed before its data is passed on, so the
+		DMA can move to it as soon as the other half is full.
+		- If both halves filled before this ran, the DMA has stopped and
+		results were lost. The channel is restarted and the gap counted,
+		see AdcStreamSta().
+		- With DmaMgrLib leave ADC0_B or ADC1_B out of DMAMGR_VECTORS.
+**/
+
+int AdcStreamInt(ADI_ADC_TypeDef *pPort)
+{
+	return AdcStrmSrv(pPort == pADI_ADC1);
+}
+
+/**
+	@brief int AdcStreamSta(ADI_ADC_TypeDef *pPort)
+			==========Returns the number of gaps in the stream.
+	@param pPort :{pADI_ADC0, pADI_ADC1}
+		- pADI_ADC0 for ADC0.
+		- pADI_ADC1 for ADC1.
+	@return Times the DMA stopped because a half was not handed on in time
+		since AdcStreamStart(). 0 means no result was lost.
+**/
+
+int AdcStreamSta(ADI_ADC_TypeDef *pPort)
+{
+	return AdcStrmSt[pPort == pADI_ADC1].iGaps;
+}
+
+/**
+	@brief int AdcStreamStop(ADI_ADC_TypeDef *pPort)
+			==========Stops the conversions and the DMA of a stream.
+	@param pPort :{pADI_ADC0, pADI_ADC1}
+		- pADI_ADC0 for ADC0.
+		- pADI_ADC1 for ADC1.
+	@return 1.
+	@note
+		- The half being filled is dropped.
+**/
+
+int AdcStreamStop(ADI_ADC_TypeDef *pPort)
+{
+	AdcGo(pPort, ADCMDE_ADCMD_IDLE);
+	AdcStrmEnd(pPort == pADI_ADC1);
+	return 1;
+}
+
+// Pairs the halves of the two streams, called by AdcStrmSrv() from either DMA interrupt
+static void AdcDualHalf(int iAdc, int *piData, int iNum)
+{
+	AdcDualSt.piHalf[iAdc] = piData;
+	AdcDualSt.ulHalves[iAdc]++;
+	if((AdcDualSt.ulHalves[0] != AdcDualSt.ulHalves[1])
+		|| AdcStrmSt[0].iGaps || AdcStrmSt[1].iGaps)	// Not both there or no longer aligned
+		return;
+	AdcDualSt.ulPairs++;
+	if(AdcDualSt.pfPair)
+		AdcDualSt.pfPair(AdcDualSt.piHalf[0], AdcDualSt.piHalf[1], iNum);
+}
+
+static void AdcDualHalf0(int *piData, int iNum)
+{
+	AdcDualHalf(0, piData, iNum);
+}
+
+static void AdcDualHalf1(int *piData, int iNum)
+{
+	AdcDualHalf(1, piData, iNum);
+}
+
+/**
+	@brief int AdcDualStart(int *piBuf0, int *piBuf1, int iHalf, void (*pfPair)(int *piAdc0, int *piAdc1, int iNum))
+			==========Starts ADC0 and ADC1 together and streams paired results.
+	@param piBuf0 :{}
+		- Ping-pong buffer of 2*iHalf ADC0 results.
+	@param piBuf1 :{}
+		- Ping-pong buffer of 2*iHalf ADC1 results.
+	@param iHalf :{1-1024}
+		- Results of each ADC in a frame.
+	@param pfPair :{}
+		- Called as pfPair(piAdc0, piAdc1, iHalf) once both halves of a frame
+		are full. piAdc0[n] and piAdc1[n] were converted at the same time. It
+		must be done with the data within iHalf conversions.
+	@return 1 if started or 0 if a parameter is out of range, the two
+		filters differ or DmaDescChk() finds a buffer outside SRAM.
+	@note
+		- Set up both ADCs with AdcRng(), AdcPin() and
+		AdcMski(pPort,ADCMSKI_RDY,1), and DmaBase() before. AdcFlt() must be the
+		same on both so they keep the same rate. Ranges and inputs may differ.
+		- Both ADCs are started by back to back writes with interrupts off.
+		They share the modulator clock, so each pair is taken within one
+		modulator cycle.
+		- Call AdcStreamInt(pADI_ADC0) from DMA_ADC0_Int_Handler() and
+		AdcStreamInt(pADI_ADC1) from DMA_ADC1_Int_Handler(), at the same
+		priority. pfPair is called from the second of the two.
+		- If a stream loses results the pairs are no longer aligned and
+		pfPair is not called again, see AdcDualSta(). Restart with
+		AdcDualStart().
+**/
+
+int AdcDualStart(int *piBuf0, int *piBuf1, int iHalf, void (*pfPair)(int *piAdc0, int *piAdc1, int iNum))
+{
+	unsigned long ulMde0, ulMde1, ulPri;
+
+	AdcGo(pADI_ADC0, ADCMDE_ADCMD_IDLE);
+	AdcGo(pADI_ADC1, ADCMDE_ADCMD_IDLE);
+	if(pADI_ADC0->FLT != pADI_ADC1->FLT)
+		return 0;
+	AdcDualSt.ulHalves[0] = 0;
+	AdcDualSt.ulHalves[1] = 0;
+	AdcDualSt.ulPairs = 0;
+	AdcDualSt.pfPair = pfPair;
+	if(AdcStrmArm(0, piBuf0, iHalf, AdcDualHalf0) == 0)
+		return 0;
+	if(AdcStrmArm(1, piBuf1, iHalf, AdcDualHalf1) == 0)
+		{
+		AdcStrmEnd(0);
+		return 0;
+		}
+	ulMde0 = (pADI_ADC0->MDE & 0xFFFF8) | ADCMDE_ADCMD_CONT;
+	ulMde1 = (pADI_ADC1->MDE & 0xFFFF8) | ADCMDE_ADCMD_CONT;
+	ulPri = __get_PRIMASK();
+	__disable_irq();
+	pADI_ADC0->MDE = ulMde0;					// Common start
+	pADI_ADC1->MDE = ulMde1;
+	__set_PRIMASK(ulPri);
+	return 1;
+}
+
+/**
+	@brief int AdcDualSta(unsigned long *pulPairs)
+			==========Tells if the AdcDualStart() pairs are still aligned.
+	@param pulPairs :{}
+		- Set to the number of frames passed to pfPair.
+	@return 0 while aligned, or the number of gaps in the two streams.
+**/
+
+int AdcDualSta(unsigned long *pulPairs)
+{
+	*pulPairs = AdcDualSt.ulPairs;
+	return AdcStrmSt[0].iGaps + AdcStrmSt[1].iGaps;
+}
+
+/**
+	@brief int AdcDualStop(void)
+			==========Stops both ADCs and their streams.
+	@return 1.
+	@note
+		- The frame being filled is dropped. Both ADCs are left idle, ready
+		to be set up for other measurements.
+**/
+
+int AdcDualStop(void)
+{
+	AdcStreamStop(pADI_ADC0);
+	AdcStreamStop(pADI_ADC1);
+	return 1;
+}
+
+/**
+	@brief int AdcFastStart(ADI_ADC_TypeDef *pPort, int iRate, int *piRing, int iHalf)
+			==========Streams SINC2 results into a ring, a fast channel next to the main filter.
+	@param pPort :{pADI_ADC0, pADI_ADC1}
+		- pADI_ADC0 for the SINC2 filter to follow the ADC0 modulator.
+		- pADI_ADC1 for the SINC2 filter to follow the ADC1 modulator.
+	@param iRate :{DETCON_RATE_2ms, DETCON_RATE_4ms, DETCON_RATE_6ms, DETCON_RATE_8ms}
+		- SINC2 decimation, one result every 2ms, 4ms, 6ms or 8ms.
+	@param piRing :{}
+		- Ring of 2*iHalf results, filled by the SINC2 DMA channel.
+	@param iHalf :{1-1024}
+		- Results between AdcFastInt() calls.
+	@return 1 if started or 0 if a parameter is out of range or DmaDescChk()
+		finds the ring outside SRAM.
+	@note
+		- The main filter of the ADC is not changed. Set it up and start it in
+		ADCMDE_ADCMD_CONT as usual, for example with AdcStreamStart(). The
+		SINC2 filter runs from the modulator while the ADC converts.
+		- Call AdcFastInt() from DMA_SINC2_Int_Handler() and read the results
+		with AdcFastRd(). AdcFastLast() gives the newest one at once.
+		- Uses DMA channel SINC2_C and DETCON, which AdcDetCon() also sets.
+**/
+
+int AdcFastStart(ADI_ADC_TypeDef *pPort, int iRate, int *piRing, int iHalf)
+{
+	pADI_ADCSTEP->DETCON &= ~0x80;				// SINC2 off while the DMA is set up
+	if(AdcStrmArm(ADCSTRM_SINC2, piRing, iHalf, 0) == 0)
+		return 0;
+	pADI_ADCSTEP->DETCON = (pADI_ADCSTEP->DETCON & ~0x87) | 0x80
+		| ((pPort == pADI_ADC1) ? 0x4 : 0) | (iRate & 0x3);
+	return 1;
+}
+
+/**
+	@brief int AdcFastInt(void)
+			==========Re-arms the filled halves of the SINC2 ring.
+	@return Number of halves re-armed, 0 to 2.
+	@note
+		- Call from DMA_SINC2_Int_Handler(). If it runs late the DMA stops,
+		is restarted and the gap counted, see AdcFastSta().
+		- With DmaMgrLib leave SYNC2_B out of DMAMGR_VECTORS.
+**/
+
+int AdcFastInt(void)
+{
+	return AdcStrmSrv(ADCSTRM_SINC2);
+}
+
+/**
+	@brief int AdcFastRd(int *piData, int iMax)
+			==========Reads the SINC2 results not read yet, oldest first.
+	@param piData :{}
+		- Room for iMax results.
+	@param iMax :{1-}
+		- Most results to read.
+	@return Number of results read, 0 if none are new.
+	@note
+		- Includes results of the half the DMA is still filling, so the
+		latency is one SINC2 result whatever iHalf is.
+		- Results overwritten before they were read are skipped and counted,
+		see AdcFastSta(). Read at least every iHalf results.
+		- Call from the main loop or one interrupt only.
+**/
+
+int AdcFastRd(int *piData, int iMax)
+{
+	AdcStrm *pSt = &AdcStrmSt[ADCSTRM_SINC2];
+	DmaDesc *pDesc;
+	unsigned long ulWr;
+	int iSize, iIdx, iNum = 0;
+	int i1;
+
+	if(pSt->piBuf == 0)
+		return 0;
+	iSize = 2 * pSt->iHalf;
+	NVIC_DisableIRQ(DMA_SINC2_IRQn);			// ulDone and iNext move together
+	ulWr = pSt->ulDone;
+	iIdx = pSt->iNext;
+	for(i1=0; i1<2; i1++)						// Add what the DMA wrote since
+	{
+		pDesc = Dma_GetDescriptor(SINC2_C - 1, iIdx);
+		if(pDesc->ctrlCfg.Bits.cycle_ctrl != DMA_STOP)
+		{
+			ulWr += pSt->iHalf - 1 - pDesc->ctrlCfg.Bits.n_minus_1;
+			break;
+		}
+		ulWr += pSt->iHalf;
+		iIdx ^= 1;
+	}
+	NVIC_EnableIRQ(DMA_SINC2_IRQn);
+	if((ulWr - pSt->ulRd) > (unsigned long)iSize)	// Overwritten before being read
+	{
+		pSt->ulLost += ulWr - pSt->ulRd - iSize;
+		pSt->ulRd = ulWr - iSize;
+	}
+	while((pSt->ulRd != ulWr) && (iNum < iMax))
+		piData[iNum++] = pSt->piBuf[pSt->ulRd++ % iSize];
+	return iNum;
+}
+
+/**
+	@brief int AdcFastLast(void)
+			==========Returns the newest SINC2 result.
+	@return STEPDAT, the SINC2 result the DMA last moved.
+	@note Same format as AdcStpRd().
+**/
+
+int AdcFastLast(void)
+{
+	return pADI_ADCSTEP->STEPDAT;
+}
+
+/**
+	@brief int AdcFastSta(int *piGaps)
+			==========Returns the SINC2 results lost since AdcFastStart().
+	@param piGaps :{}
+		- If not 0, set to the times the DMA stopped because AdcFastInt() ran
+		late. Results converted while it was stopped are not counted.
+	@return Results overwritten before AdcFastRd() read them.
+**/
+
+int AdcFastSta(int *piGaps)
+{
+	if(piGaps)
+		*piGaps = AdcStrmSt[ADCSTRM_SINC2].iGaps;
+	return (int)AdcStrmSt[ADCSTRM_SINC2].ulLost;
+}
+
+/**
+	@brief int AdcFastStop(void)
+			==========Stops the SINC2 filter and its DMA.
+	@return 1.
+	@note The main filter of the ADC carries on.
+**/
+
+int AdcFastStop(void)
+{
+	pADI_ADCSTEP->DETCON &= ~0x80;
+	AdcStrmEnd(ADCSTRM_SINC2);
+	return 1;
+}
+
+/**
+	@brief int AdcScanStart(ADI_ADC_TypeDef *pPort, AdcScanEntry *pEntry, int iNum, DmaDesc *pList, void (*pfDone)(ADI_ADC_TypeDef *pPort))
+			==========Runs a list of measurements with no CPU between them.
+	@param pPort :{pADI_ADC0, pADI_ADC1}
+		- pADI_ADC0 for ADC0.
+		- pADI_ADC1 for ADC1.
+	@param pEntry :{}
+		- iNum measurements, each with its inputs, gain, reference, input
+		buffers, number of results and result buffer. AdcScanStart() fills
+		their ulCtl[] which the DMA reads, so they must stay valid.
+	@param iNum :{1-64}
+		- Number of entries.
+	@param pList :{}
+		- Task list of ADCSCAN_TASKS(iNum) descriptors, valid until pfDone.
+	@param pfDone :{}
+		- Called from AdcScanInt() once the results of the last entry are in,
+		0 for none.
+	@return 1 if started or 0 if a parameter is out of range.
+	@note
+		- Set up AdcFlt() and the reference buffers (AdcBuf() iRBufCfg) and
+		calibrate before, the scan keeps them and the current ADCxOF and
+		ADCxINTGN for all entries.
+		- The DMA channel runs a peripheral scatter-gather list. For each entry
+		it writes ADCxMSKI to ADCxMDE in ADC DMA write mode, which starts
+		continuous conversions, switches ADCDMACON to read mode, reads iNum
+		results from ADCxDAT, then switches back to write mode for the next
+		entry. The first request after each switch is taken by the switch.
+		- Call AdcScanInt() from DMA_ADC0_Int_Handler() or DMA_ADC1_Int_Handler().
+		- The other ADC and SINC2 DMA enables in ADCDMACON must not change
+		while a scan runs.
+**/
+
+int AdcScanStart(ADI_ADC_TypeDef *pPort, AdcScanEntry *pEntry, int iNum, DmaDesc *pList, void (*pfDone)(ADI_ADC_TypeDef *pPort))
+{
+	int iAdc = (pPort == pADI_ADC1);
+	AdcScan *pSc = &AdcScanSt[iAdc];
+	int iChan = iAdc ? ADC1_C : ADC0_C;
+	int iBit = 1 << (iChan - 1);
+	IRQn_Type eIrq = iAdc ? DMA_ADC1_IRQn : DMA_ADC0_IRQn;
+	unsigned long ulCon, ulMde, ulOther;
+	AdcScanEntry *pE;
+	DmaSgTask Task;
+	int iTask = 0;
+	int i1;
+
+	if((pEntry == 0) || (pList == 0) || (iNum < 1) || (iNum > 64))
+		return 0;
+	AdcGo(pPort, ADCMDE_ADCMD_IDLE);
+	DmaSet(iBit, 0, 0, 0);						// Mask the channel while it is set up
+	DmaClr(0, iBit, 0, 0);
+	pSc->iBusy = 0;
+	ulOther = pADI_ADCDMA->ADCDMACON & (iAdc ? 0x13 : 0x1C);
+	pSc->ulConWr = ulOther | (iAdc ? 0x4 : 0x1);
+	pSc->ulConRd = ulOther | (iAdc ? 0xC : 0x3);
+	ulCon = (pPort->CON | ADCCON_ADCEN) & ~0x3F3FF;	// Inputs, reference and buffers per entry
+	ulMde = pPort->MDE & 0xFF00;					// Gain and mode per entry
+	for(i1=0; i1<iNum; i1++)
+	{
+		pE = &pEntry[i1];
+		if((pE->iNum < 1) || (pE->iNum > 1024) || (pE->piData == 0))
+			return 0;
+		pE->ulCtl[ADCSCAN_MSKI] = ADCMSKI_RDY;
+		pE->ulCtl[ADCSCAN_CON] = ulCon | (pE->iBuf & 0x3C000) | (pE->iRef & 0x3000)
+			| (pE->iInP & 0x3E0) | (pE->iInN & 0x1F);
+		pE->ulCtl[ADCSCAN_OF] = pPort->OF;
+		pE->ulCtl[ADCSCAN_INTGN] = pPort->INTGN;
+		pE->ulCtl[ADCSCAN_MDE] = ulMde | (pE->iGain & 0xF8) | ADCMDE_ADCMD_CONT;
+
+		Task.pSrc = pE->ulCtl;						// Control registers, the ADC steps through them
+		Task.pDst = &pPort->MSKI;
+		Task.iNumVals = ADCSCAN_CTL;
+		Task.iCfg = DMA_SIZE_WORD|DMA_SRCINC_WORD|DMA_DSTINC_NO;
+		DmaSgTaskSet(&pList[iTask++], &Task, DMA_PSG_ALT);
+		Task.pSrc = &pSc->ulConRd;					// Read mode
+		Task.pDst = &pADI_ADCDMA->ADCDMACON;
+		Task.iNumVals = 1;
+		Task.iCfg = DMA_SIZE_WORD|DMA_SRCINC_NO|DMA_DSTINC_NO;
+		DmaSgTaskSet(&pList[iTask++], &Task, DMA_PSG_ALT);
+		Task.pSrc = &pPort->DAT;					// Results
+		Task.pDst = pE->piData;
+		Task.iNumVals = pE->iNum;
+		Task.iCfg = DMA_SIZE_WORD|DMA_SRCINC_NO|DMA_DSTINC_WORD;
+		DmaSgTaskSet(&pList[iTask++], &Task, (i1 < iNum-1) ? DMA_PSG_ALT : DMA_BASIC);
+		if(i1 < iNum-1)
+		{
+			Task.pSrc = &pSc->ulConWr;				// Write mode for the next entry
+			Task.pDst = &pADI_ADCDMA->ADCDMACON;
+			Task.iNumVals = 1;
+			Task.iCfg = DMA_SIZE_WORD|DMA_SRCINC_NO|DMA_DSTINC_NO;
+			DmaSgTaskSet(&pList[iTask++], &Task, DMA_PSG_ALT);
+		}
+	}
+	if((DmaSgListSetup(iChan, pList, iTask, DMA_PSG_PRI) == 0) || DmaDescChk(iChan))
+		return 0;
+	pSc->pfDone = pfDone;
+	pSc->iBusy = 1;
+	pADI_ADCDMA->ADCDMACON = pSc->ulConWr;
+	NVIC_ClearPendingIRQ(eIrq);
+	NVIC_EnableIRQ(eIrq);
+	DmaClr(0, 0, iBit, 0);						// Start on the primary structure
+	DmaClr(iBit, 0, 0, 0);
+	DmaSet(0, iBit, 0, 0);
+	return 1;
+}
+
+/**
+	@brief int AdcScanInt(ADI_ADC_TypeDef *pPort)
+			==========Ends a scan once its last results are in.
+	@param pPort :{pADI_ADC0, pADI_ADC1}
+		- pADI_ADC0 from DMA_ADC0_Int_Handler().
+		- pADI_ADC1 from DMA_ADC1_Int_Handler().
+	@return 1 if a scan ended or 0 if none was running.
+	@note
+		- Puts the ADC in idle mode, turns its DMA off and calls pfDone.
+		pfDone may start the next scan.
+**/
+
+int AdcScanInt(ADI_ADC_TypeDef *pPort)
+{
+	int iAdc = (pPort == pADI_ADC1);
+	AdcScan *pSc = &AdcScanSt[iAdc];
+	int iBit = 1 << ((iAdc ? ADC1_C : ADC0_C) - 1);
+
+	if((pSc->iBusy == 0) || (pADI_DMA->DMAENSET & iBit))
+		return 0;
+	AdcGo(pPort, ADCMDE_ADCMD_IDLE);
+	DmaSet(iBit, 0, 0, 0);
+	AdcDmaCon(iAdc ? ADC1DMAREAD : ADC0DMAREAD, 0);
+	pSc->iBusy = 0;
+	if(pSc->pfDone)
+		pSc->pfDone(pPort);
+	return 1;
+}
+
+/**
+	@brief int AdcScanSta(ADI_ADC_TypeDef *pPort)
+			==========Tells if a scan is running.
+	@param pPort :{pADI_ADC0, pADI_ADC1}
+		- pADI_ADC0 for ADC0.
+		- pADI_ADC1 for ADC1.
+	@return 1 while a scan runs, 0 once AdcScanInt() has ended it.
+**/
+
+int AdcScanSta(ADI_ADC_TypeDef *pPort)
+{
+	return AdcScanSt[pPort == pADI_ADC1].iBusy;
+}
+
 /**@}*/
@@ -6,10 +6,23 @@
    @brief   Set of DMA peripheral functions.
    - DmaBase(), DmaSet(), DmaClr(), DmaSta() and DmaErr() apply to all DMA channels together.
    - DmaOn() apply for each channel separately. 
+   - Check structures with DmaDescChk() and call DmaErrInt() from
+     DMA_Err_Int_Handler() to re-arm channels stopped by bus errors.
    
-   @version    V0.1
+   @version    V0.5
    @author     ADI
-   @date       October 2012
+   @date       October 2026
+   @par Revision History:
+   - V0.1, October 2012: initial version.
+   - V0.2, October 2026: peripheral registers and transfer sizes of the channels
+     taken from the table DmaMap[] by one setup path. Alternate channel numbers
+     decoded the same way by all functions.
+   - V0.3, October 2026: DmaSgBuild() for memory and peripheral scatter-gather.
+   - V0.4, October 2026: DmaStructMemSetup() for memory to memory transfers.
+   - V0.5, October 2026: DmaDescChk(), DmaErrInt() with re-arming of faulted
+     channels and DmaDiagRd() counts. Counts over 1024 refused.
+     DmaPeripheralStructSetup() keeps the count of the structure.
+     DmaSgTaskSet() and DmaSgListSetup() to build task lists one task at a time.
 
 
 All files for ADuCM360/361 provided by ADI, including this file, are
@@ -18,7 +31,6 @@ The user assumes any and all risk from the use of this code.
 It is the responsibility of the person integrating this code into an application
 to ensure that the resulting application performs as required and is safe.
 **/
-#include <stdio.h>
 #include <string.h>
 #include "DmaLib.h"
 
@@ -38,6 +50,42 @@ DmaDesc dmaChanDesc     [CCD_SIZE * 2] __attribute__ ((aligned (DMACHAN_DSC_ALIG
 DmaDesc dmaChanDesc     [CCD_SIZE * 2];
 #endif
 
+// Transfer sizes a channel takes, one bit per DMA_SIZE_ value
+#define DMA_MAP_BYTE		1
+#define DMA_MAP_HWORD	2
+#define DMA_MAP_WORD		4
+
+// Peripheral register of each channel, in channel order. pTx is the
+// destination of memory to peripheral transfers, pRx the source of
+// peripheral to memory transfers, 0 where the channel has no such direction.
+typedef struct
+{
+	volatile void *pTx;
+	volatile void *pRx;
+	unsigned char ucSize;
+} DmaChanMap;
+
+static const DmaChanMap DmaMap[SINC2_C] = {
+	{&pADI_SPI1->SPITX,	0,							DMA_MAP_BYTE},	// SPI1TX_C
+	{0,						&pADI_SPI1->SPIRX,		DMA_MAP_BYTE},	// SPI1RX_C
+	{&pADI_UART->COMTX,	0,							DMA_MAP_BYTE},	// UARTTX_C
+	{0,						&pADI_UART->COMRX,		DMA_MAP_BYTE},	// UARTRX_C
+	{&pADI_I2C->I2CSTX,	0,							DMA_MAP_BYTE},	// I2CSTX_C
+	{0,						&pADI_I2C->I2CSRX,		DMA_MAP_BYTE},	// I2CSRX_C
+	{&pADI_I2C->I2CMTX,	0,							DMA_MAP_BYTE},	// I2CMTX_C
+	{0,						&pADI_I2C->I2CMRX,		DMA_MAP_BYTE},	// I2CMRX_C
+	{&pADI_DAC->DACDAT,	0,							DMA_MAP_WORD},	// DAC_C
+	{&pADI_ADC0->MSKI,	&pADI_ADC0->DAT,			DMA_MAP_WORD},	// ADC0_C, writes start at ADC0MSKI
+	{&pADI_ADC1->MSKI,	&pADI_ADC1->DAT,			DMA_MAP_WORD},	// ADC1_C, writes start at ADC1MSKI
+	{0,						&pADI_ADCSTEP->STEPDAT,	DMA_MAP_WORD}};	// SINC2_C
+
+// Bus error bookkeeping of DmaErrInt()
+static unsigned int uiDmaRun = 0;			// Enabled with DmaSet(), not disabled with DmaClr()
+static unsigned int uiRearm = 0xFFF;		// Channels re-armed after a fault
+static unsigned int uiFaultSig[SINC2_C];	// Control word at the last fault of each channel
+static unsigned char ucFaultRun[SINC2_C];	// Faults in a row without progress
+static DmaDiag DmaDiagSt;
+
 
 
 /**
@@ -97,6 +145,8 @@ int DmaBase(void)
    uiBasPtr = (unsigned int)&dmaChanDesc; // Setup the DMA base pointer.
    pADI_DMA->DMAPDBPTR = uiBasPtr;
    pADI_DMA->DMACFG = 1;                             // Enable DMA controller
+   uiDmaRun = 0;
+   DmaDiagClr();
 	return 1;
 	}
 /**
@@ -174,8 +224,14 @@ int DmaBase(void)
 **/
 int DmaSet(int iMask, int iEnable, int iAlt, int iPriority)
 	{
+	int i1;
+
 	pADI_DMA->DMARMSKSET = iMask;
 	pADI_DMA->DMAENSET = iEnable;
+	uiDmaRun |= (unsigned int)iEnable;
+	for(i1=0; i1<SINC2_C; i1++)
+		if(iEnable & (1 << i1))
+			ucFaultRun[i1] = 0;					// New transfer, forget earlier faults
 	pADI_DMA->DMAALTSET = iAlt;
 	pADI_DMA->DMAPRISET = iPriority;
 	return 1;
@@ -258,6 +314,7 @@ int DmaClr(int iMask, int iEnable, int iAlt, int iPriority)
 	{
 	pADI_DMA->DMARMSKCLR = iMask;
 	pADI_DMA->DMAENCLR = iEnable;
+	uiDmaRun &= ~(unsigned int)iEnable;
 	pADI_DMA->DMAALTCLR = iAlt;
 	pADI_DMA->DMAPRICLR = iPriority;
 	return 1;
@@ -309,9 +366,258 @@ int DmaErr(int iErrClr)
 
 
 /**
-   @brief int DmaPeripheralStructSetup(int iChan, int iCfg)	
+   @brief static DmaDesc *DmaDescSel(int iChan)
+         ==========Returns the descriptor of a channel number, SPI1TX_C to SINC2_C
+         for the primary structure or SPI1TX_C+ALTERNATE to SINC2_C+ALTERNATE
+         for the alternate structure, or 0 for any other value.
+**/
+static DmaDesc *DmaDescSel(int iChan)
+{
+	unsigned int uiChan = (unsigned int)iChan & (ALTERNATE-1);
+
+	if(((unsigned int)iChan & ~(unsigned int)(ALTERNATE|(ALTERNATE-1))) || (uiChan == 0) || (uiChan > SINC2_C))
+		return 0;
+	return &dmaChanDesc[uiChan - 1 + ((unsigned int)iChan & ALTERNATE)];
+}
+
+/**
+   @brief static int DmaInMem(unsigned int uiStart, unsigned int uiEnd, int iWr)
+         ==========Checks that uiStart to uiEnd lies in one region the DMA
+         can read, or write if iWr is not 0.
+**/
+static int DmaInMem(unsigned int uiStart, unsigned int uiEnd, int iWr)
+{
+	if(uiStart > uiEnd)
+		return 0;
+	if((uiStart >= DMA_SRAM_BASE) && (uiEnd < DMA_SRAM_END))
+		return 1;
+	if((uiStart >= DMA_PERIPH_BASE) && (uiEnd < DMA_PERIPH_END))
+		return 1;
+	return (iWr == 0) && (uiEnd < DMA_FLASH_END);
+}
+
+/**
+   @brief int DmaDescChk(int iChan)
+         ==========Checks a structure before its channel is enabled.
+   @param iChan :{SPI1TX_C-SINC2_C,SPI1TX_C+ALTERNATE-SINC2_C+ALTERNATE}
+    - Structure to check.
+   @return 0 if the structure can run, else a combination of:
+    - DMA_CHK_CHAN if iChan is not a channel.
+    - DMA_CHK_STOP if the cycle type is DMA_STOP.
+    - DMA_CHK_SIZE if the source and destination sizes differ or an
+      increment is smaller than the size.
+    - DMA_CHK_ALIGN if an end pointer is not aligned to the size.
+    - DMA_CHK_SRC if the source is not all in flash, SRAM or peripherals.
+    - DMA_CHK_DST if the destination is not all in SRAM or peripherals.
+   @note
+      - The number of values cannot be over 1024 in a structure: the setup
+      functions refuse larger counts.
+      - DmaMgrXfer(), DmaMgrSgXfer() and AdcStreamStart() call it before starting.
+**/
+int DmaDescChk(int iChan)
+{
+	DmaDesc *pDesc = DmaDescSel(iChan);
+	unsigned int uiCtrl, uiSize, uiInc, uiN;
+	int iErr = 0;
+
+	if(pDesc == 0)
+		return DMA_CHK_CHAN;
+	uiCtrl = pDesc->ctrlCfg.ctrlCfgVal;
+	uiSize = (uiCtrl >> 24) & 0x3;
+	uiN = (uiCtrl >> 4) & 0x3FF;						// Values - 1
+	if((uiCtrl & 0x7) == DMA_STOP)
+		iErr |= DMA_CHK_STOP;
+	if((uiSize == 3) || (uiSize != ((uiCtrl >> 28) & 0x3))
+		|| (((uiCtrl >> 26) & 0x3) < uiSize) || ((uiCtrl >> 30) < uiSize))
+		iErr |= DMA_CHK_SIZE;
+	if((pDesc->srcEndPtr | pDesc->destEndPtr) & ((1u << uiSize) - 1))
+		iErr |= DMA_CHK_ALIGN;
+	uiInc = (uiCtrl >> 26) & 0x3;
+	if(!DmaInMem(pDesc->srcEndPtr - ((uiInc == 3) ? 0 : uiN << uiInc), pDesc->srcEndPtr, 0))
+		iErr |= DMA_CHK_SRC;
+	uiInc = uiCtrl >> 30;
+	if(!DmaInMem(pDesc->destEndPtr - ((uiInc == 3) ? 0 : uiN << uiInc), pDesc->destEndPtr, 1))
+		iErr |= DMA_CHK_DST;
+	return iErr;
+}
+
+/**
+   @brief int DmaErrInt(void)
+         ==========Finds the channels a bus error stopped and re-arms them.
+   @return Channel bits (SPI1TX_B...SYNC2_B) of the faulted channels left
+      stopped, 0 if all were re-armed or there was no error.
+   @note
+      - Call from DMA_Err_Int_Handler() and enable DMA_ERR_IRQn.
+      - The controller only flags that an error happened and disables the
+      channel. A channel enabled with DmaSet(), not disabled with DmaClr(),
+      found disabled with its active structure unfinished is the faulted one.
+      Channels enabled by writing DMAENSET directly are not known here and
+      are ignored, so drivers enable their channels with DmaSet().
+      - A faulted channel in DmaRearmCfg() whose structure still passes
+      DmaDescChk() is enabled again and resumes where it stopped. After
+      DMA_REARM_MAX faults in a row without progress it is left stopped.
+      - The counts are read with DmaDiagRd().
+**/
+int DmaErrInt(void)
+{
+	DmaDesc *pDesc;
+	unsigned int uiSig;
+	int iAlt, iBit, i1;
+	int iStop = 0;
+
+	if((pADI_DMA->DMAERRCLR & 1) == 0)
+		return 0;
+	pADI_DMA->DMAERRCLR = 1;
+	DmaDiagSt.ulErrors++;
+	for(i1=0; i1<SINC2_C; i1++)
+	{
+		iBit = 1 << i1;
+		if(((uiDmaRun & iBit) == 0) || (pADI_DMA->DMAENSET & iBit))
+			continue;
+		iAlt = (pADI_DMA->DMAALTSET & iBit) ? ALTERNATE : 0;
+		pDesc = &dmaChanDesc[i1 + iAlt];
+		if(pDesc->ctrlCfg.Bits.cycle_ctrl == DMA_STOP)
+			continue;								// Finished, not faulted
+		DmaDiagSt.usFaults[i1]++;
+		DmaDiagSt.ucLastChan = i1 + 1;
+		uiSig = pDesc->ctrlCfg.ctrlCfgVal ^ (unsigned int)iAlt;
+		if(uiSig != uiFaultSig[i1])
+			ucFaultRun[i1] = 0;						// Progress since the last fault
+		uiFaultSig[i1] = uiSig;
+		if((uiRearm & iBit) && (++ucFaultRun[i1] <= DMA_REARM_MAX) && (DmaDescChk(i1 + 1 + iAlt) == 0))
+		{
+			DmaDiagSt.usRearms[i1]++;
+			pADI_DMA->DMAENSET = iBit;
+			if((pDesc->ctrlCfg.Bits.cycle_ctrl == DMA_AUTO) || (pDesc->ctrlCfg.Bits.cycle_ctrl == DMA_MSG_PRI)
+				|| (pDesc->ctrlCfg.Bits.cycle_ctrl == DMA_MSG_ALT))
+				pADI_DMA->DMASWREQ = iBit;			// Memory transfers need the request again
+		}
+		else
+		{
+			uiDmaRun &= ~iBit;
+			DmaDiagSt.usStops |= iBit;
+			iStop |= iBit;
+		}
+	}
+	return iStop;
+}
+
+/**
+   @brief int DmaRearmCfg(int iChans)
+         ==========Selects the channels DmaErrInt() re-arms after a bus error.
+   @param iChans :{0-0xFFF}
+    - Channel bits, SPI1TX_B...SYNC2_B. All channels by default.
+   @return Previous selection.
+**/
+int DmaRearmCfg(int iChans)
+{
+	int iOld = uiRearm;
+
+	uiRearm = iChans & 0xFFF;
+	return iOld;
+}
+
+/**
+   @brief const DmaDiag *DmaDiagRd(void)
+         ==========Returns the bus error counts kept by DmaErrInt().
+   @return Counts since DmaBase() or DmaDiagClr(), see DmaDiag in DmaLib.h.
+**/
+const DmaDiag *DmaDiagRd(void)
+{
+	return &DmaDiagSt;
+}
+
+/**
+   @brief int DmaDiagClr(void)
+         ==========Clears the bus error counts.
+   @return 1.
+**/
+int DmaDiagClr(void)
+{
+	memset(&DmaDiagSt, 0, sizeof(DmaDiagSt));
+	return 1;
+}
+
+/**
+   @brief static unsigned int DmaEnd(volatile void *pStart, unsigned int uiInc, int iNumVals)
+         ==========Returns the end pointer of a buffer of iNumVals values for
+         the increment code uiInc of a descriptor (0 byte, 1 half-word, 2 word,
+         3 no increment).
+**/
+static unsigned int DmaEnd(volatile void *pStart, unsigned int uiInc, int iNumVals)
+{
+	if(uiInc == 3)
+		return (unsigned int)pStart;
+	return (unsigned int)pStart + ((unsigned int)(iNumVals - 1) << uiInc);
+}
+
+/**
+   @brief static int DmaPtrSetup(int iChan, int iNumVals, volatile void *pMem, int iRx)
+         ==========Single setup path of DmaStructPtrOutSetup() and DmaStructPtrInSetup().
+         Sets the end pointers of a channel from its entry in DmaMap[] and the
+         increments already in its descriptor.
+   @return 1 or 0 if the channel does not move data in that direction or
+         iNumVals is not 1 to 1024.
+**/
+static int DmaPtrSetup(int iChan, int iNumVals, volatile void *pMem, int iRx)
+{
+	DmaDesc *pDesc = DmaDescSel(iChan);
+	const DmaChanMap *pMap;
+
+	if((pDesc == 0) || (iNumVals < 1) || (iNumVals > 1024))
+		return 0;
+	pMap = &DmaMap[(iChan & (ALTERNATE-1)) - 1];
+	if(iRx)
+	{
+		if(pMap->pRx == 0)
+			return 0;
+		pDesc->srcEndPtr  = DmaEnd(pMap->pRx, pDesc->ctrlCfg.Bits.src_inc, iNumVals);
+		pDesc->destEndPtr = DmaEnd(pMem, pDesc->ctrlCfg.Bits.dst_inc, iNumVals);
+	}
+	else
+	{
+		if(pMap->pTx == 0)
+			return 0;
+		pDesc->srcEndPtr  = DmaEnd(pMem, pDesc->ctrlCfg.Bits.src_inc, iNumVals);
+		pDesc->destEndPtr = DmaEnd(pMap->pTx, pDesc->ctrlCfg.Bits.dst_inc, iNumVals);
+	}
+	return 1;
+}
+
+/**
+   @brief static unsigned int DmaCtrlWord(int iCfg, int iNumVals)
+         ==========Builds the control word of a descriptor: increments and
+         cycle type from iCfg, the size of iCfg for both source and
+         destination and iNumVals transfers.
+**/
+static unsigned int DmaCtrlWord(int iCfg, int iNumVals)
+{
+	unsigned int uiSize = ((unsigned int)iCfg >> 24) & 0x3;
+
+	return ((unsigned int)iCfg & 0xCC000007) | (uiSize << 24) | (uiSize << 28)
+		| (((unsigned int)(iNumVals - 1) & 0x3FF) << 4);
+}
+
+/**
+   @brief static unsigned int DmaCtrl(int iChan, int iCfg, int iNumVals)
+         ==========As DmaCtrlWord() for a channel, checking its register takes the size.
+   @return Control word or 0 if iNumVals is not 1 to 1024 or the channel
+         does not take that size.
+**/
+static unsigned int DmaCtrl(int iChan, int iCfg, int iNumVals)
+{
+	unsigned int uiSize = ((unsigned int)iCfg >> 24) & 0x3;
+
+	if((iNumVals < 1) || (iNumVals > 1024)
+		|| ((DmaMap[(iChan & (ALTERNATE-1)) - 1].ucSize & (1u << uiSize)) == 0))
+		return 0;
+	return DmaCtrlWord(iCfg, iNumVals);
+}
+
+/**
+   @brief int DmaPeripheralStructSetup(int iChan, int iCfg)
          ==========Sets up DMA config structure for the required channel
-            
+
    @param iChan :{0,SPI1TX_C,SPI1RX_C,UARTTX_C,UARTRX_C,I2CSTX_C,I2CSRX_C,I2CMTX_C,I2CMRX_C,
          DAC_C,ADC0_C,ADC1_C,SINC2_C,
          SPI1TX_C+ALTERNATE,SPI1RX_C+ALTERNATE,UARTTX_C+ALTERNATE,UARTRX_C+ALTERNATE,
@@ -322,322 +628,127 @@ int DmaErr(int iErrClr)
    - 2 or SPI1RX_C for the SPI1 receive channel - primary structure
    - 3 or UARTTX_C for the UART Transmit channel - primary structure
    - 4 or UARTRX_C for the UART receive channel - primary structure
-   - 5 or I2CSTX_C for the I2C Slave transmit channel - primary structure 
-   - 6 or I2CSRX_C for the I2C Slave receive channel - primary structure 
-   - 7 or I2CMTX_C for the I2C Master transmit channel - primary structure 
-   - 8 or I2CMRX_C for the I2C Master receive channel - primary structure 
-   - 9 or DAC_C for the DAC output channel - primary structure 
-   - 10 or ADC0_C for the ADC0 output channel - primary structure 
-   - 11 or ADC1_C for the ADC1 output channel - primary structure 
-   - 12 or SINC2_C for the SINC2 output channel - primary structure 
-   - 13 or SPI1TX_C+ALTERNATE for the SPI1 Transmit channel - ALTERNATE structure
-   - 14 or SPI1RX_C+ALTERNATE for the SPI1 receive channel - ALTERNATE structure
-   - 15 or UARTTX_C+ALTERNATE for the UART Transmit channel - ALTERNATE structure
-   - 16 or UARTRX_C+ALTERNATE for the UART receive channel - ALTERNATE structure
-   - 17 or I2CSTX_C+ALTERNATE for the I2C Slave transmit channel - ALTERNATE structure 
-   - 18 or I2CSRX_C+ALTERNATE for the I2C Slave receive channel - ALTERNATE structure 
-   - 19 or I2CMTX_C+ALTERNATE for the I2C Master transmit channel - ALTERNATE structure 
-   - 20 or I2CMRX_C+ALTERNATE for the I2C Master receive channel - ALTERNATE structure 
-   - 21 or DAC_C+ALTERNATE for the DAC output channel - ALTERNATE structure 
-   - 22 or ADC0_C+ALTERNATE for the ADC0 output channel - ALTERNATE structure 
-   - 23 or ADC1_C+ALTERNATE for the ADC1 output channel - ALTERNATE structure 
-   - 24 or SINC2_C+ALTERNATE for the SINC2 output channel - ALTERNATE structure 
+   - 5 or I2CSTX_C for the I2C Slave transmit channel - primary structure
+   - 6 or I2CSRX_C for the I2C Slave receive channel - primary structure
+   - 7 or I2CMTX_C for the I2C Master transmit channel - primary structure
+   - 8 or I2CMRX_C for the I2C Master receive channel - primary structure
+   - 9 or DAC_C for the DAC output channel - primary structure
+   - 10 or ADC0_C for the ADC0 output channel - primary structure
+   - 11 or ADC1_C for the ADC1 output channel - primary structure
+   - 12 or SINC2_C for the SINC2 output channel - primary structure
+   - 17 or SPI1TX_C+ALTERNATE for the SPI1 Transmit channel - ALTERNATE structure
+   - 18 or SPI1RX_C+ALTERNATE for the SPI1 receive channel - ALTERNATE structure
+   - 19 or UARTTX_C+ALTERNATE for the UART Transmit channel - ALTERNATE structure
+   - 20 or UARTRX_C+ALTERNATE for the UART receive channel - ALTERNATE structure
+   - 21 or I2CSTX_C+ALTERNATE for the I2C Slave transmit channel - ALTERNATE structure
+   - 22 or I2CSRX_C+ALTERNATE for the I2C Slave receive channel - ALTERNATE structure
+   - 23 or I2CMTX_C+ALTERNATE for the I2C Master transmit channel - ALTERNATE structure
+   - 24 or I2CMRX_C+ALTERNATE for the I2C Master receive channel - ALTERNATE structure
+   - 25 or DAC_C+ALTERNATE for the DAC output channel - ALTERNATE structure
+   - 26 or ADC0_C+ALTERNATE for the ADC0 output channel - ALTERNATE structure
+   - 27 or ADC1_C+ALTERNATE for the ADC1 output channel - ALTERNATE structure
+   - 28 or SINC2_C+ALTERNATE for the SINC2 output channel - ALTERNATE structure
    @param iCfg :{DMA_DSTINC_BYTE|DMA_DSTINC_HWORD|DMA_DSTINC_WORD|DMA_DSTINC_NO|
                  DMA_SRCINC_BYTE|DMA_SRCINC_HWORD|DMA_SRCINC_WORD|DMA_SRCINC_NO|
                  DMA_SIZE_BYTE|DMA_SIZE_HWORD|DMA_SIZE_WORD}
    - Choose one of DMA_DSTINC_BYTE, DMA_DSTINC_HWORD,DMA_DSTINC_WORD,DMA_DSTINC_NO for destination address increment
    - Choose one of DMA_SRCINC_BYTE,DMA_SRCINC_HWORD,DMA_SRCINC_WORD,DMA_SRCINC_NO for source address increment
    - Choose one of DMA_SIZE_BYTE (byte),DMA_SIZE_HWORD (half-word),DMA_SIZE_WORD(word) for source data size
+     SPI1, UART and I2C channels take DMA_SIZE_BYTE only, DAC, ADC and SINC2 channels DMA_SIZE_WORD only.
 
-   @return 1:
+   @return 1 or 0 if iChan is not a channel or does not take the size in iCfg.
+   @note
+      - The channel is left stopped with the count already in its structure.
+      Set the end pointers with DmaStructPtrOutSetup() or DmaStructPtrInSetup()
+      and the count and cycle type with DmaCycleCntCtrl().
 
 **/
 int DmaPeripheralStructSetup(int iChan, int iCfg)
 {
-		int iChanSel = 0;
-	  DmaDesc Desc;
-	
-	 if (iChan > CCD_SIZE)
-	  {
-		 iChanSel = 1;  // Alternate
-	   iChan = iChan - CCD_SIZE;
-	  }
-   else
-	  iChanSel = 0;
-
-    // Common configuration of all the descriptors used here
-  //  Desc.ctrlCfg.Bits.cycle_ctrl       = (iCfg & 0x7);
-    Desc.ctrlCfg.Bits.next_useburst    = 0x0;
-    Desc.ctrlCfg.Bits.r_power          = 0;  
-    Desc.ctrlCfg.Bits.src_prot_ctrl    = 0x0;
-    Desc.ctrlCfg.Bits.dst_prot_ctrl    = 0x0;
-    Desc.ctrlCfg.Bits.src_size         = ((iCfg & 0x3000000)>>24);
-    Desc.ctrlCfg.Bits.dst_size         = ((iCfg & 0x3000000)>>24);
-	 
-    Desc.ctrlCfg.Bits.n_minus_1        = 16;
-    Desc.ctrlCfg.Bits.src_inc          = ((iCfg & 0xC000000)>>26);
-    Desc.ctrlCfg.Bits.dst_inc          = ((iCfg & 0xC0000000)>>30);
-	  iChan--;
-	  if (iChanSel == 0)
-		    *Dma_GetDescriptor(iChan,0) = Desc;     // primary structure
-		else 
-			  *Dma_GetDescriptor(iChan,1) = Desc;     // alternate structure
-	 
-
-return 1;	
+	DmaDesc *pDesc = DmaDescSel(iChan);
+	unsigned int uiCtrl;
+
+	if(pDesc == 0)
+		return 0;
+	uiCtrl = DmaCtrl(iChan, iCfg & ~0x7, pDesc->ctrlCfg.Bits.n_minus_1 + 1);
+	if(uiCtrl == 0)
+		return 0;
+	pDesc->ctrlCfg.ctrlCfgVal = uiCtrl;
+	return 1;
 }
 /**
-   @brief int DmaStructPtrOutSetup(int iChan, int iNumVals, unsigned char *pucTX_DMA)	
+   @brief int DmaStructPtrOutSetup(int iChan, int iNumVals, unsigned char *pucTX_DMA)
             ==========For DMA operations where the destination is fixed (peripheral register is fixed)
-   @param iChan :{0,SPI1TX_C,UARTTX_C,I2CSTX_C,I2CMTX_C,DAC_C,ADC0_C,ADC1_C,SINC2_C,
+   @param iChan :{0,SPI1TX_C,UARTTX_C,I2CSTX_C,I2CMTX_C,DAC_C,ADC0_C,ADC1_C,
          SPI1TX_C+ALTERNATE,UARTTX_C+ALTERNATE,I2CSTX_C+ALTERNATE,I2CMTX_C+ALTERNATE,
-         DAC_C+ALTERNATE,ADC0_C+ALTERNATE,ADC1_C+ALTERNATE,SINC2_C+ALTERNATE}
+         DAC_C+ALTERNATE,ADC0_C+ALTERNATE,ADC1_C+ALTERNATE}
    - 0 to select no channel
    - 1 or SPI1TX_C for the SPI1 Transmit channel - primary structure
    - 3 or UARTTX_C for the UART Transmit channel - primary structure
-   - 5 or I2CSTX_C for the I2C Slave transmit channel - primary structure 
-   - 7 or I2CMTX_C for the I2C Master transmit channel - primary structure 
-   - 9 or DAC_C for the DAC output channel - primary structure 
-   - 10 or ADC0_C for the ADC0 output channel - primary structure 
-   - 11 or ADC1_C for the ADC1 output channel - primary structure 
-   - 13 or SPI1TX_C+ALTERNATE for the SPI1 Transmit channel - ALTERNATE structure
-   - 15 or UARTTX_C+ALTERNATE for the UART Transmit channel - ALTERNATE structure
-   - 17 or I2CSTX_C+ALTERNATE for the I2C Slave transmit channel - ALTERNATE structure 
-   - 19 or I2CMTX_C+ALTERNATE for the I2C Master transmit channel - ALTERNATE structure 
-   - 21 or DAC_C+ALTERNATE for the DAC output channel - ALTERNATE structure 
-   - 22 or ADC0_C+ALTERNATE for the ADC0 output channel - ALTERNATE structure 
-   - 23 or ADC1_C+ALTERNATE for the ADC1 output channel - ALTERNATE structure 
-   - 24 or SINC2_C+ALTERNATE for the SINC2 output channel - ALTERNATE structure 
-   @param iNumVals :{0-1023}
-   - 0 to 1023. Number of values to transfer
+   - 5 or I2CSTX_C for the I2C Slave transmit channel - primary structure
+   - 7 or I2CMTX_C for the I2C Master transmit channel - primary structure
+   - 9 or DAC_C for the DAC output channel - primary structure
+   - 10 or ADC0_C for ADC0 writes to the control registers from ADC0MSKI - primary structure
+   - 11 or ADC1_C for ADC1 writes to the control registers from ADC1MSKI - primary structure
+   - 17 or SPI1TX_C+ALTERNATE for the SPI1 Transmit channel - ALTERNATE structure
+   - 19 or UARTTX_C+ALTERNATE for the UART Transmit channel - ALTERNATE structure
+   - 21 or I2CSTX_C+ALTERNATE for the I2C Slave transmit channel - ALTERNATE structure
+   - 23 or I2CMTX_C+ALTERNATE for the I2C Master transmit channel - ALTERNATE structure
+   - 25 or DAC_C+ALTERNATE for the DAC output channel - ALTERNATE structure
+   - 26 or ADC0_C+ALTERNATE for ADC0 writes to the control registers - ALTERNATE structure
+   - 27 or ADC1_C+ALTERNATE for ADC1 writes to the control registers - ALTERNATE structure
+   @param iNumVals :{1-1024}
+   - 1 to 1024. Number of values to transfer
    @param *pucTX_DMA :{0-0xFFFFFFFF}
    - Pass Source pointer  address for DMA transfers
-   @return 1:
+   @return 1 or 0 if iChan is not a transmit channel or iNumVals is not 1 to 1024.
+   @note
+      - Call after DmaPeripheralStructSetup(): the end pointers follow the
+      source and destination increments already in the descriptor.
 
 **/
 
 int DmaStructPtrOutSetup(int iChan, int iNumVals, unsigned char *pucTX_DMA)
 {
-		int iChanSel = 0;
-	
-	 if (iChan > CCD_SIZE)
-	  {
-		 iChanSel = 1;  // Alternalte
-	   iChan = iChan - CCD_SIZE;
-	  }
-   else
-	  iChanSel = 0;
-	switch (iChan)
-	  {   
-		 case 1:  // SPI1 Tx 
-			 iChan--;
-			 if (iChanSel == 0)  // - primary structure
-			 {
-	        dmaChanDesc[iChan].srcEndPtr    = (unsigned int)(pucTX_DMA+ iNumVals - 0x1);
-		      dmaChanDesc[iChan].destEndPtr   = (unsigned int)(&pADI_SPI1->SPITX); 
-			 }
-			 else // Alternate structure used
-			 {
-				   dmaChanDesc[iChan + CCD_SIZE].srcEndPtr    = (unsigned int)(pucTX_DMA+ iNumVals - 0x1);
-		      dmaChanDesc[iChan + CCD_SIZE].destEndPtr   = (unsigned int)(&pADI_SPI1->SPITX);
-			 }
-		   break;
- 			 
-		 case 3:  // UART Tx
-			 iChan--;
-			 if (iChanSel == 0)  // - primary structure
-			 {
-	        dmaChanDesc[iChan].srcEndPtr    = (unsigned int)(pucTX_DMA+ iNumVals - 0x1);
-		      dmaChanDesc[iChan].destEndPtr   = (unsigned int)(&pADI_UART->COMTX); 
-			 }
-			 else // Alternate structure used
-			 {
-				  dmaChanDesc[iChan+CCD_SIZE].srcEndPtr    = (unsigned int)(pucTX_DMA+ iNumVals - 0x1);
-		      dmaChanDesc[iChan+CCD_SIZE].destEndPtr   = (unsigned int)(&pADI_UART->COMTX);
-			 }
-		   break;
-				 
-		 case 5:  // I2C Slave Tx
-			 iChan--;
-			 if (iChanSel == 0)  // - primary structure
-			 {
-	        dmaChanDesc[iChan].srcEndPtr    = (unsigned int)(pucTX_DMA+ iNumVals - 0x1);
-		      dmaChanDesc[iChan].destEndPtr   = (unsigned int)(&pADI_I2C->I2CSTX); 
-			 }
-			 else // Alternate structure used
-			 {
-				  dmaChanDesc[iChan+CCD_SIZE].srcEndPtr    = (unsigned int)(pucTX_DMA+ iNumVals - 0x1);
-		      dmaChanDesc[iChan+CCD_SIZE].destEndPtr   = (unsigned int)(&pADI_I2C->I2CSTX);
-			 }
-		   break;
-				 
-		case 7:  // I2C Master Tx
-			iChan--;
-			 if (iChanSel == 0)  // - primary structure
-			 {
-	        dmaChanDesc[iChan].srcEndPtr    = (unsigned int)(pucTX_DMA+ iNumVals - 0x1);
-		      dmaChanDesc[iChan].destEndPtr   = (unsigned int)(&pADI_I2C->I2CMTX); 
-			 }
-			 else // Alternate structure used
-			 {
-				  dmaChanDesc[iChan+CCD_SIZE].srcEndPtr    = (unsigned int)(pucTX_DMA+ iNumVals - 0x1);
-		      dmaChanDesc[iChan+CCD_SIZE].destEndPtr   = (unsigned int)(&pADI_I2C->I2CMTX);
-			 }
-		   break;
-				 
-		case 9:  // DAC out
-			iChan--;
-			 if (iChanSel == 0)  // - primary structure
-			 {
-	        dmaChanDesc[iChan].srcEndPtr    = (unsigned int)(pucTX_DMA+ iNumVals - 0x1);
-		      dmaChanDesc[iChan].destEndPtr   = (unsigned int)(&pADI_DAC->DACDAT); 
-			 }
-			 else // Alternate structure used
-			 {
-				  dmaChanDesc[iChan+CCD_SIZE].srcEndPtr    = (unsigned int)(pucTX_DMA+ iNumVals - 0x1);
-		      dmaChanDesc[iChan+CCD_SIZE].destEndPtr   = (unsigned int)(&pADI_DAC->DACDAT);
-			 }
-		   break;
-			 
-		case 10: // ADC0 write to control registers
-			iChan--;
-			 if (iChanSel == 0)  // - primary structure
-			 {
-	        dmaChanDesc[iChan].srcEndPtr    = (unsigned int)(pucTX_DMA+ iNumVals - 0x1);
-		      dmaChanDesc[iChan].destEndPtr   = (unsigned int)(&pADI_ADC0->MSKI + iNumVals - 0x1); 
-			 }
-			 else // Alternate structure used
-			 {
-				  dmaChanDesc[iChan+CCD_SIZE].srcEndPtr    = (unsigned int)(pucTX_DMA+ iNumVals - 0x1);
-		      dmaChanDesc[iChan+CCD_SIZE].destEndPtr   = (unsigned int)(&pADI_ADC0->MSKI + iNumVals - 0x1);
-			 }
-		   break;	
-		 
-	  case 11: // ADC1 write to control registers
-			iChan--;
-			 if (iChanSel == 0)  // - primary structure
-			 {
-	        dmaChanDesc[iChan].srcEndPtr    = (unsigned int)(pucTX_DMA+ iNumVals - 0x1);
-		      dmaChanDesc[iChan].destEndPtr   = (unsigned int)(&pADI_ADC1->MSKI + iNumVals - 0x1); 
-			 }
-			 else // Alternate structure used
-			 {
-				  dmaChanDesc[iChan+CCD_SIZE].srcEndPtr    = (unsigned int)(pucTX_DMA+ iNumVals - 0x1);
-		      dmaChanDesc[iChan+CCD_SIZE].destEndPtr   = (unsigned int)(&pADI_ADC1->MSKI + iNumVals - 0x1);
-			 }
-		   break;	
-	   default:	 
-		     break;	
-	   }
-		 return 1;
+	return DmaPtrSetup(iChan, iNumVals, pucTX_DMA, 0);
 }
 /**
    @brief int DmaStructPtrInSetup(int iChan, int iNumVals, unsigned char *pucRX_DMA);
-	 			==========For DMA operations where the destination is fixed (peripheral register is fixed)
-   @param iChan :{0,SPI1RX_C,UARTRX_C,I2CSRX_C,I2CMRX_C,DAC_C,ADC0_C,ADC1_C,SINC2_C,
-                  SPI1RX_C+ALTERNATE,UARTRX_C+ALTERNATE,I2CSRX_C+ALTERNATE,
-                  I2CMRX_C+ALTERNATE,DAC_C+ALTERNATE,ADC0_C+ALTERNATE,
-                  ADC1_C+ALTERNATE,SINC2_C+ALTERNATE}
+            ==========For DMA operations where the source is fixed (peripheral register is fixed)
+   @param iChan :{0,SPI1RX_C,UARTRX_C,I2CSRX_C,I2CMRX_C,ADC0_C,ADC1_C,SINC2_C,
+                  SPI1RX_C+ALTERNATE,UARTRX_C+ALTERNATE,I2CSRX_C+ALTERNATE,I2CMRX_C+ALTERNATE,
+                  ADC0_C+ALTERNATE,ADC1_C+ALTERNATE,SINC2_C+ALTERNATE}
     - 0 to select no channel
-    - 2 or SPI1TX_C for the SPI1 Transmit channel - primary structure
-    - 4 or UARTTX_C for the UART Transmit channel - primary structure
-    - 6 or I2CSTX_C for the I2C Slave transmit channel - primary structure 
-    - 8 or I2CMTX_C for the I2C Master transmit channel - primary structure 
-    - 9 or DAC_C for the DAC output channel - primary structure 
-    - 10 or ADC0_C for the ADC0 output channel - primary structure 
-    - 11 or ADC1_C for the ADC1 output channel - primary structure 
-    - 12 or SINC2_C for the SINC2 output channel - primary structure 
-    - 14 or SPI1TX_C+ALTERNATE for the SPI1 Transmit channel - ALTERNATE structure
-    - 16 or UARTTX_C+ALTERNATE for the UART Transmit channel - ALTERNATE structure
-    - 18 or I2CSTX_C+ALTERNATE for the I2C Slave transmit channel - ALTERNATE structure 
-    - 20 or I2CMTX_C+ALTERNATE for the I2C Master transmit channel - ALTERNATE structure 
-    - 21 or DAC_C+ALTERNATE for the DAC output channel - ALTERNATE structure 
-    - 22 or ADC0_C+ALTERNATE for the ADC0 output channel - ALTERNATE structure 
-    - 23 or ADC1_C+ALTERNATE for the ADC1 output channel - ALTERNATE structure 
-    - 24 or SINC2_C+ALTERNATE for the SINC2 output channel - ALTERNATE structure 
-   @param iNumVals :{0-1023}
-    - 0 to 1023. Number of values to transfer
+    - 2 or SPI1RX_C for the SPI1 receive channel - primary structure
+    - 4 or UARTRX_C for the UART receive channel - primary structure
+    - 6 or I2CSRX_C for the I2C Slave receive channel - primary structure
+    - 8 or I2CMRX_C for the I2C Master receive channel - primary structure
+    - 10 or ADC0_C for the ADC0 output channel - primary structure
+    - 11 or ADC1_C for the ADC1 output channel - primary structure
+    - 12 or SINC2_C for the SINC2 output channel - primary structure
+    - 18 or SPI1RX_C+ALTERNATE for the SPI1 receive channel - ALTERNATE structure
+    - 20 or UARTRX_C+ALTERNATE for the UART receive channel - ALTERNATE structure
+    - 22 or I2CSRX_C+ALTERNATE for the I2C Slave receive channel - ALTERNATE structure
+    - 24 or I2CMRX_C+ALTERNATE for the I2C Master receive channel - ALTERNATE structure
+    - 26 or ADC0_C+ALTERNATE for the ADC0 output channel - ALTERNATE structure
+    - 27 or ADC1_C+ALTERNATE for the ADC1 output channel - ALTERNATE structure
+    - 28 or SINC2_C+ALTERNATE for the SINC2 output channel - ALTERNATE structure
+   @param iNumVals :{1-1024}
+    - 1 to 1024. Number of values to transfer
    @param *pucRX_DMA :{0-0xFFFFFFFF}
-    - Pass pointer to destination address for DMA transfers		
-   @return 1:
+    - Pass pointer to destination address for DMA transfers
+   @return 1 or 0 if iChan is not a receive channel or iNumVals is not 1 to 1024.
+   @note
+      - Call after DmaPeripheralStructSetup(): the end pointers follow the
+      source and destination increments already in the descriptor.
 
 **/
 int DmaStructPtrInSetup(int iChan, int iNumVals, unsigned char *pucRX_DMA)
 {
- 	int iChanSel = 0;
-	
-	 if (iChan > CCD_SIZE)
-	  {
-		 iChanSel = 1;  // Alternalte
-	   iChan = iChan - CCD_SIZE;
-	  }
-   else
-	  iChanSel = 0;
-	switch (iChan)
-	  {   
-		 case 2:  // SPI1 Rx 
-			 iChan--;
-			 if (iChanSel == 0)  // - primary structure
-			 {
-	        dmaChanDesc[iChan].destEndPtr    = (unsigned int)(pucRX_DMA+ iNumVals - 0x1);
-		      dmaChanDesc[iChan].srcEndPtr   = (unsigned int)(&pADI_SPI1->SPIRX); 
-			 }
-			 else // Alternate structure used
-			 {
-				   dmaChanDesc[iChan + CCD_SIZE].destEndPtr    = (unsigned int)(pucRX_DMA+ iNumVals - 0x1);
-		      dmaChanDesc[iChan + CCD_SIZE].srcEndPtr   = (unsigned int)(&pADI_SPI1->SPIRX);
-			 }
-		   break;
-			 
-		 case 4:  // UART Rx 
-			 iChan--;
-			 if (iChanSel == 0)  // - primary structure
-			 {
-	        dmaChanDesc[iChan].destEndPtr    = (unsigned int)(pucRX_DMA+ iNumVals - 0x1);
-		      dmaChanDesc[iChan].srcEndPtr   = (unsigned int)(&pADI_UART->COMRX); 
-			 }
-			 else // Alternate structure used
-			 {
-				   dmaChanDesc[iChan + CCD_SIZE].destEndPtr    = (unsigned int)(pucRX_DMA+ iNumVals - 0x1);
-		      dmaChanDesc[iChan + CCD_SIZE].srcEndPtr   = (unsigned int)(&pADI_UART->COMRX);
-			 }
-		   break;
-			 
-		 case 6:  // I2C Slave Rx 
-			 iChan--;
-			 if (iChanSel == 0)  // - primary structure
-			 {
-	        dmaChanDesc[iChan].destEndPtr    = (unsigned int)(pucRX_DMA+ iNumVals - 0x1);
-		      dmaChanDesc[iChan].srcEndPtr   = (unsigned int)(&pADI_I2C->I2CSRX); 
-			 }
-			 else // Alternate structure used
-			 {
-				   dmaChanDesc[iChan + CCD_SIZE].destEndPtr    = (unsigned int)(pucRX_DMA+ iNumVals - 0x1);
-		      dmaChanDesc[iChan + CCD_SIZE].srcEndPtr   = (unsigned int)(&pADI_I2C->I2CSRX);
-			 }
-		   break;
-			 
-			case 8:  // I2C Master Rx 
-			 iChan--;
-			 if (iChanSel == 0)  // - primary structure
-			 {
-	        dmaChanDesc[iChan].destEndPtr    = (unsigned int)(pucRX_DMA+ iNumVals - 0x1);
-		      dmaChanDesc[iChan].srcEndPtr   = (unsigned int)(&pADI_I2C->I2CMRX); 
-			 }
-			 else // Alternate structure used
-			 {
-				   dmaChanDesc[iChan + CCD_SIZE].destEndPtr    = (unsigned int)(pucRX_DMA+ iNumVals - 0x1);
-		      dmaChanDesc[iChan + CCD_SIZE].srcEndPtr   = (unsigned int)(&pADI_I2C->I2CMRX);
-			 }
-		   break;
-			 
-			 default:	 
-		     break;	
-		 }
-	return 1;
+	return DmaPtrSetup(iChan, iNumVals, pucRX_DMA, 1);
 }
 /**
-   @brief int DmaCycleCntCtrl(unsigned int iChan, int iNumx, int iCfg)		
+   @brief int DmaCycleCntCtrl(unsigned int iChan, int iNumx, int iCfg)
             ==========Used to re-enable DMA config structure when moving ADC results direct to memory
    @param iChan :{0,SPI1TX_C,SPI1RX_C,UARTTX_C,UARTRX_C,I2CSTX_C,I2CSRX_C,I2CMTX_C,I2CMRX_C,
          DAC_C,ADC0_C,ADC1_C,SINC2_C,
@@ -649,49 +760,224 @@ int DmaStructPtrInSetup(int iChan, int iNumVals, unsigned char *pucRX_DMA)
     - 2 or SPI1RX_C for the SPI1 receive channel - primary structure
     - 3 or UARTTX_C for the UART Transmit channel - primary structure
     - 4 or UARTRX_C for the UART receive channel - primary structure
-    - 5 or I2CSTX_C for the I2C Slave transmit channel - primary structure 
-    - 6 or I2CSRX_C for the I2C Slave receive channel - primary structure 
-    - 7 or I2CMTX_C for the I2C Master transmit channel - primary structure 
-    - 8 or I2CMRX_C for the I2C Master receive channel - primary structure 
-    - 9 or DAC_C for the DAC output channel - primary structure 
-    - 10 or ADC0_C for the ADC0 output channel - primary structure 
-    - 11 or ADC1_C for the ADC1 output channel - primary structure 
-    - 12 or SINC2_C for the SINC2 output channel - primary structure 
-    - 13 or SPI1TX_C+ALTERNATE for the SPI1 Transmit channel - ALTERNATE structure
-    - 14 or SPI1RX_C+ALTERNATE for the SPI1 receive channel - ALTERNATE structure
-    - 15 or UARTTX_C+ALTERNATE for the UART Transmit channel - ALTERNATE structure
-    - 16 or UARTRX_C+ALTERNATE for the UART receive channel - ALTERNATE structure
-    - 17 or I2CSTX_C+ALTERNATE for the I2C Slave transmit channel - ALTERNATE structure 
-    - 18 or I2CSRX_C+ALTERNATE for the I2C Slave receive channel - ALTERNATE structure 
-    - 19 or I2CMTX_C+ALTERNATE for the I2C Master transmit channel - ALTERNATE structure 
-    - 20 or I2CMRX_C+ALTERNATE for the I2C Master receive channel - ALTERNATE structure 
-    - 21 or DAC_C+ALTERNATE for the DAC output channel - ALTERNATE structure 
-    - 22 or ADC0_C+ALTERNATE for the ADC0 output channel - ALTERNATE structure 
-    - 23 or ADC1_C+ALTERNATE for the ADC1 output channel - ALTERNATE structure 
-    - 24 or SINC2_C+ALTERNATE for the SINC2 output channel - ALTERNATE structure 
+    - 5 or I2CSTX_C for the I2C Slave transmit channel - primary structure
+    - 6 or I2CSRX_C for the I2C Slave receive channel - primary structure
+    - 7 or I2CMTX_C for the I2C Master transmit channel - primary structure
+    - 8 or I2CMRX_C for the I2C Master receive channel - primary structure
+    - 9 or DAC_C for the DAC output channel - primary structure
+    - 10 or ADC0_C for the ADC0 output channel - primary structure
+    - 11 or ADC1_C for the ADC1 output channel - primary structure
+    - 12 or SINC2_C for the SINC2 output channel - primary structure
+    - 17 or SPI1TX_C+ALTERNATE for the SPI1 Transmit channel - ALTERNATE structure
+    - 18 or SPI1RX_C+ALTERNATE for the SPI1 receive channel - ALTERNATE structure
+    - 19 or UARTTX_C+ALTERNATE for the UART Transmit channel - ALTERNATE structure
+    - 20 or UARTRX_C+ALTERNATE for the UART receive channel - ALTERNATE structure
+    - 21 or I2CSTX_C+ALTERNATE for the I2C Slave transmit channel - ALTERNATE structure
+    - 22 or I2CSRX_C+ALTERNATE for the I2C Slave receive channel - ALTERNATE structure
+    - 23 or I2CMTX_C+ALTERNATE for the I2C Master transmit channel - ALTERNATE structure
+    - 24 or I2CMRX_C+ALTERNATE for the I2C Master receive channel - ALTERNATE structure
+    - 25 or DAC_C+ALTERNATE for the DAC output channel - ALTERNATE structure
+    - 26 or ADC0_C+ALTERNATE for the ADC0 output channel - ALTERNATE structure
+    - 27 or ADC1_C+ALTERNATE for the ADC1 output channel - ALTERNATE structure
+    - 28 or SINC2_C+ALTERNATE for the SINC2 output channel - ALTERNATE structure
    @param iCfg :{DMA_DSTINC_BYTE|DMA_DSTINC_HWORD|DMA_DSTINC_WORD|DMA_DSTINC_NO|
                  DMA_SRCINC_BYTE|DMA_SRCINC_HWORD|DMA_SRCINC_WORD|DMA_SRCINC_NO|
                  DMA_SIZE_BYTE|DMA_SIZE_HWORD|DMA_SIZE_WORD|
              DMA_STOP|DMA_BASIC|DMA_AUTO|DMA_PING|DMA_PSG_PRI|DMA_PSG_ALT}
-    - Choose one of DMA_DSTINC_BYTE, DMA_DSTINC_HWORD,DMA_DSTINC_WORD,DMA_DSTINC_NO for destination address increment
-    - Choose one of DMA_SRCINC_BYTE,DMA_SRCINC_HWORD,DMA_SRCINC_WORD,DMA_SRCINC_NO for source address increment
-    - Choose one of DMA_SIZE_BYTE (byte),DMA_SIZE_HWORD (half-word),DMA_SIZE_WORD(word) for source data size
+    - Only the cycle type is used, the rest of the descriptor is kept.
     - Choose one of DMA_STOP,DMA_BASIC,DMA_AUTO,DMA_PING,DMA_PSG_PRI,DMA_PSG_ALT
-   @param iNumx :{0-1023}
-    - 0. ADC0 is the SINC2 filter source
-    - 0x4 or DETCON_ADCSEL. ADC1 is the SINC2 filter source
- @return 1:
+   @param iNumx :{1-1024}
+    - Number of values to transfer.
+ @return 1 or 0 if iChan is not a channel or iNumx is not 1 to 1024.
 
 **/
 int DmaCycleCntCtrl(unsigned int iChan, int iNumx, int iCfg)
 {
- 	iChan--;
-	dmaChanDesc[iChan].ctrlCfg.Bits.cycle_ctrl       = (iCfg & 0x7);
-	dmaChanDesc[iChan].ctrlCfg.Bits.n_minus_1        = iNumx - 0x1;
+	DmaDesc *pDesc = DmaDescSel((int)iChan);
+
+	if((pDesc == 0) || (iNumx < 1) || (iNumx > 1024))
+		return 0;
+	pDesc->ctrlCfg.ctrlCfgVal = (pDesc->ctrlCfg.ctrlCfgVal & ~0x3FF7)
+		| (((unsigned int)(iNumx - 1) & 0x3FF) << 4) | (iCfg & 0x7);
+	return 1;
+}
+
+/**
+   @brief int DmaStructMemSetup(int iChan, int iCfg, int iNumVals, volatile void *pSrc, volatile void *pDst)
+         ==========Sets up a whole structure for a memory to memory transfer.
+   @param iChan :{SPI1TX_C-SINC2_C,SPI1TX_C+ALTERNATE-SINC2_C+ALTERNATE}
+    - Channel lent to the transfer. Its peripheral requests must be masked.
+   @param iCfg :{DMA_DSTINC_BYTE|DMA_DSTINC_HWORD|DMA_DSTINC_WORD|DMA_DSTINC_NO|
+                 DMA_SRCINC_BYTE|DMA_SRCINC_HWORD|DMA_SRCINC_WORD|DMA_SRCINC_NO|
+                 DMA_SIZE_BYTE|DMA_SIZE_HWORD|DMA_SIZE_WORD|DMA_STOP|DMA_AUTO}
+    - Increments, size and cycle type, usually DMA_AUTO.
+   @param iNumVals :{1-1024}
+    - Number of values to transfer.
+   @param pSrc :{}
+    - First source value.
+   @param pDst :{}
+    - First destination value.
+   @return 1 or 0 if iChan is not a channel or iNumVals is not 1 to 1024.
+   @note
+      - The controller re-arbitrates every 8 values so a memory transfer
+      delays peripheral channels by little.
+**/
+int DmaStructMemSetup(int iChan, int iCfg, int iNumVals, volatile void *pSrc, volatile void *pDst)
+{
+	DmaDesc *pDesc = DmaDescSel(iChan);
+	unsigned int uiCtrl = DmaCtrlWord(iCfg, iNumVals) | (3 << 14);		// R_power: 8 values
+
+	if((pDesc == 0) || (iNumVals < 1) || (iNumVals > 1024))
+		return 0;
+	pDesc->ctrlCfg.ctrlCfgVal = uiCtrl & ~0x7;
+	pDesc->srcEndPtr  = DmaEnd(pSrc, ((unsigned int)iCfg >> 26) & 0x3, iNumVals);
+	pDesc->destEndPtr = DmaEnd(pDst, ((unsigned int)iCfg >> 30) & 0x3, iNumVals);
+	pDesc->ctrlCfg.ctrlCfgVal = uiCtrl;
 	return 1;
 }
 
+/**
+   @brief int DmaSgBuild(int iChan, const DmaSgTask *pTask, int iNum, DmaDesc *pList, int iMode)
+         ==========Builds a scatter-gather task list and sets up the primary
+         structure of a channel to run it.
+   @param iChan :{SPI1TX_C-SINC2_C}
+    - Channel that runs the list.
+   @param pTask :{}
+    - Array of iNum tasks, each with the start of its source and destination,
+      its number of values and its size and increments.
+   @param iNum :{1-256}
+    - Number of tasks.
+   @param pList :{}
+    - Task list of iNum descriptors filled here. Word aligned, which DmaDesc
+      always is. It must stay valid while the channel runs.
+   @param iMode :{DMA_MSG_PRI,DMA_PSG_PRI}
+    - DMA_MSG_PRI for memory scatter-gather: the whole list runs on one
+      software request, as DMA_AUTO does.
+    - DMA_PSG_PRI for peripheral scatter-gather: each value is moved on a
+      request of the channel's peripheral, as DMA_BASIC does.
+   @return 1 or 0 if iChan, iNum or iMode is out of range or a task has no values.
+   @note
+      - The primary structure copies each task in turn into the alternate
+      structure, which then runs it, so a multi-segment transfer such as
+      header, payload and CRC to COMTX needs a single trigger and no CPU
+      between segments. All but the last task are made DMA_MSG_ALT or
+      DMA_PSG_ALT, the last one DMA_AUTO or DMA_BASIC so the channel stops
+      and raises its done interrupt when the list is finished.
+      - Start the channel on its primary structure: DmaClr() its alternate
+      bit, DmaSet() its enable bit and, for DMA_MSG_PRI, write its bit to
+      DMASWREQ. DmaMgrSgXfer() does this.
+**/
+int DmaSgBuild(int iChan, const DmaSgTask *pTask, int iNum, DmaDesc *pList, int iMode)
+{
+	int iLast = (iMode == DMA_MSG_PRI) ? DMA_AUTO : DMA_BASIC;
+	int i1;
 
+	if((DmaDescSel(iChan) == 0) || (iChan & ALTERNATE) || (iNum < 1) || (iNum > 256)
+		|| ((iMode != DMA_MSG_PRI) && (iMode != DMA_PSG_PRI)))
+		return 0;
+	for(i1=0; i1<iNum; i1++)
+		if(DmaSgTaskSet(&pList[i1], &pTask[i1], (i1 < iNum-1) ? iMode+1 : iLast) == 0)
+			return 0;
+	return DmaSgListSetup(iChan, pList, iNum, iMode);
+}
+
+/**
+   @brief int DmaSgTaskSet(DmaDesc *pDesc, const DmaSgTask *pTask, int iCyc)
+         ==========Fills one descriptor of a scatter-gather task list.
+   @param pDesc :{}
+    - Entry of the task list.
+   @param pTask :{}
+    - Task, as for DmaSgBuild().
+   @param iCyc :{DMA_BASIC,DMA_AUTO,DMA_MSG_ALT,DMA_PSG_ALT}
+    - DMA_MSG_ALT or DMA_PSG_ALT for all tasks but the last, DMA_AUTO or
+      DMA_BASIC for the last one.
+   @return 1 or 0 if the task has no values or more than 1024.
+   @note
+      - For lists whose tasks are not all in one array. Start the list with
+      DmaSgListSetup().
+**/
+int DmaSgTaskSet(DmaDesc *pDesc, const DmaSgTask *pTask, int iCyc)
+{
+	if((pTask->iNumVals < 1) || (pTask->iNumVals > 1024))
+		return 0;
+	pDesc->srcEndPtr  = DmaEnd(pTask->pSrc, ((unsigned int)pTask->iCfg >> 26) & 0x3, pTask->iNumVals);
+	pDesc->destEndPtr = DmaEnd(pTask->pDst, ((unsigned int)pTask->iCfg >> 30) & 0x3, pTask->iNumVals);
+	pDesc->ctrlCfg.ctrlCfgVal = DmaCtrlWord((pTask->iCfg & ~0x7) | (iCyc & 0x7), pTask->iNumVals);
+	pDesc->reserved4Bytes = 0;
+	return 1;
+}
+
+/**
+   @brief int DmaSgListSetup(int iChan, DmaDesc *pList, int iNum, int iMode)
+         ==========Sets up the primary structure of a channel to run a task list.
+   @param iChan :{SPI1TX_C-SINC2_C}
+    - Channel that runs the list.
+   @param pList :{}
+    - Task list of iNum descriptors filled by DmaSgTaskSet().
+   @param iNum :{1-256}
+    - Number of tasks.
+   @param iMode :{DMA_MSG_PRI,DMA_PSG_PRI}
+    - As for DmaSgBuild().
+   @return 1 or 0 if iChan, iNum or iMode is out of range.
+**/
+int DmaSgListSetup(int iChan, DmaDesc *pList, int iNum, int iMode)
+{
+	DmaDesc *pDesc = DmaDescSel(iChan);
+
+	if((pDesc == 0) || (iChan & ALTERNATE) || (iNum < 1) || (iNum > 256)
+		|| ((iMode != DMA_MSG_PRI) && (iMode != DMA_PSG_PRI)))
+		return 0;
+	// Primary structure: copy each task, 4 words, into the alternate structure
+	pDesc->srcEndPtr  = (unsigned int)&pList[iNum-1].reserved4Bytes;
+	pDesc->destEndPtr = (unsigned int)&pDesc[ALTERNATE].reserved4Bytes;
+	pDesc->ctrlCfg.ctrlCfgVal = DmaCtrlWord(DMA_DSTINC_WORD|DMA_SRCINC_WORD|DMA_SIZE_WORD|iMode, 4*iNum)
+		| (2 << 14);											// R_power: 4 words per arbitration
+	return 1;
+}
+
+/**
+   @brief static int DmaChanSetup(int iChan, int iCfg, int iNumVals, volatile void *pMem, int iRx)
+         ==========Sets up a whole descriptor. The channel is kept stopped
+         until the end pointers match the new increments.
+**/
+static int DmaChanSetup(int iChan, int iCfg, int iNumVals, volatile void *pMem, int iRx)
+{
+	DmaDesc *pDesc = DmaDescSel(iChan);
+	unsigned int uiCtrl;
+
+	if(pDesc == 0)
+		return 0;
+	uiCtrl = DmaCtrl(iChan, iCfg, iNumVals);
+	if(uiCtrl == 0)
+		return 0;
+	pDesc->ctrlCfg.ctrlCfgVal = uiCtrl & ~0x7;
+	if(DmaPtrSetup(iChan, iNumVals, pMem, iRx) == 0)
+		return 0;
+	pDesc->ctrlCfg.ctrlCfgVal = uiCtrl;
+	return 1;
+}
+
+/**
+   @brief static int AdcDmaSetup(int iType, int iCfg, int iNumVals, int *piMem, int iRx)
+         ==========Shared body of AdcDmaReadSetup() and AdcDmaWriteSetup().
+   @return 1 or 0 if iType does not move data in the direction iRx.
+**/
+static int AdcDmaSetup(int iType, int iCfg, int iNumVals, int *piMem, int iRx)
+{
+	static const unsigned char ucAdcChan[SINC2DMAREAD+1] = {ADC0_C, ADC0_C, ADC1_C, ADC1_C, SINC2_C};
+	int iChan = 0;
+
+	if(iType >= iALTERNATE)
+	{
+		iType -= iALTERNATE;
+		iChan = ALTERNATE;
+	}
+	if((iType < 0) || (iType > SINC2DMAREAD))
+		return 0;
+	if(((iType == ADC0DMAWRITE) || (iType == ADC1DMAWRITE)) == (iRx != 0))
+		return 0;
+	return DmaChanSetup(iChan | ucAdcChan[iType], iCfg, iNumVals, piMem, iRx);
+}
 
 /**
    @brief int AdcDmaReadSetup(int iType, int iCfg, int iNumVals, int *pucRX_DMA)		
@@ -722,70 +1008,13 @@ int DmaCycleCntCtrl(unsigned int iChan, int iNumx, int iCfg)
     - Number of values to be transferred 
    @param *pucRX_DMA :{0-0xFFFFFFFF}
     - Pass pointer to destination address for DMA transfers
-   @return 1:
+   @return 1 or 0 if iType is not ADC0DMAREAD, ADC1DMAREAD or SINC2DMAREAD
+    or the size in iCfg is not DMA_SIZE_WORD.
 
 **/
-int AdcDmaReadSetup(int iType, int iCfg, int iNumVals, int *pucRX_DMA)	
+int AdcDmaReadSetup(int iType, int iCfg, int iNumVals, int *pucRX_DMA)
 {
-	int iChanSel = 0;
-	DmaDesc Desc;
-	
-	if (iType > 12)
-	{
-		 iChanSel = 1;  // Alternalte
-	   iType = iType - 12;
-	}
-   else
-	  iChanSel = 0;
-	 
-    // Common configuration of all the descriptors used here
-    Desc.ctrlCfg.Bits.cycle_ctrl       = (iCfg & 0x7);
-    Desc.ctrlCfg.Bits.next_useburst    = 0x0;
-    Desc.ctrlCfg.Bits.r_power          = 0;  
-    Desc.ctrlCfg.Bits.src_prot_ctrl    = 0x0;
-    Desc.ctrlCfg.Bits.dst_prot_ctrl    = 0x0;
-    Desc.ctrlCfg.Bits.src_size         = ((iCfg & 0x3000000)>>24);
-   Desc.ctrlCfg.Bits.dst_size         = ((iCfg & 0x3000000)>>24);
-
-    Desc.ctrlCfg.Bits.n_minus_1        = iNumVals - 0x1;
-    Desc.ctrlCfg.Bits.src_inc          = ((iCfg & 0xC000000)>>26);
-    Desc.ctrlCfg.Bits.dst_inc          = ((iCfg & 0xC0000000)>>30);
-	  
-	
-		switch (iType)
-	  {
-     case ADC0DMAREAD: 
-         Desc.srcEndPtr                  = (unsigned int)&pADI_ADC0->DAT;
-		   Desc.destEndPtr                 = (unsigned int)(pucRX_DMA + iNumVals - 0x1); 
-		   if (iChanSel == 0)
-		      *Dma_GetDescriptor(ADC0_C-1,0) = Desc;     // primary structure
-		   else 
-			    *Dma_GetDescriptor(ADC0_C-1,1) = Desc; // alternate structure
-
-		   break;
-		 
-	   case ADC1DMAREAD:
-	     Desc.srcEndPtr                  = (unsigned int)&pADI_ADC1->DAT;
-		   Desc.destEndPtr                 = (unsigned int)(pucRX_DMA + iNumVals - 0x1); 
-		   if (iChanSel == 0)
-		      *Dma_GetDescriptor(ADC1_C-1,0) = Desc;     // primary structure
-		   else 
-			    *Dma_GetDescriptor(ADC1_C-1,1) = Desc; // alternate structure
-
-		   break;
-		 
-	   case SINC2DMAREAD:
-        Desc.srcEndPtr                 = (unsigned int)&pADI_ADCSTEP->STEPDAT;
-        Desc.destEndPtr                = (unsigned int)(pucRX_DMA + iNumVals - 0x1); //
-     if (iChanSel == 0)
-		      *Dma_GetDescriptor(SINC2_C-1,0) = Desc;     // primary structure
-		   else 
-			    *Dma_GetDescriptor(SINC2_C-1,1) = Desc; // alternate structure
-		     break;	
-		 default:	 
-		     break;
-	   }
-return 1;	
+	return AdcDmaSetup(iType, iCfg, iNumVals, pucRX_DMA, 1);
 }
 /**
    @brief int AdcDmaWriteSetup(int iType, int iCfg, int iNumVals, int *pucTX_DMA)	
@@ -816,65 +1045,20 @@ return 1;
     - Number of values to be transferred 	
    @param *pucTX_DMA :{0-0xFFFFFFFF}
     - Pass Source pointer  address for DMA transfers
-   @return 1:
+   @return 1 or 0 if iType is not ADC0DMAWRITE or ADC1DMAWRITE
+    or the size in iCfg is not DMA_SIZE_WORD.
 
 **/
 int AdcDmaWriteSetup(int iType, int iCfg, int iNumVals, int *pucTX_DMA)
 {
-		int iChanSel = 0;
-	  DmaDesc Desc;
-	
-	 if (iType > 12)
-	  {
-		 iChanSel = 1;  // Alternalte
-	   iType = iType - 12;
-	  }
-   else
-	  iChanSel = 0;
-
-    // Common configuration of all the descriptors used here
-    Desc.ctrlCfg.Bits.cycle_ctrl       = (iCfg & 0x7);
-    Desc.ctrlCfg.Bits.next_useburst    = 0x0;
-    Desc.ctrlCfg.Bits.r_power          = 0;  
-    Desc.ctrlCfg.Bits.src_prot_ctrl    = 0x0;
-    Desc.ctrlCfg.Bits.dst_prot_ctrl    = 0x0;
-    Desc.ctrlCfg.Bits.src_size         = ((iCfg & 0x3000000)>>24);
-   Desc.ctrlCfg.Bits.dst_size         = ((iCfg & 0x3000000)>>24);
-
-    Desc.ctrlCfg.Bits.n_minus_1        = iNumVals - 0x1;
-    Desc.ctrlCfg.Bits.src_inc          = ((iCfg & 0xC000000)>>26);
-    Desc.ctrlCfg.Bits.dst_inc          = ((iCfg & 0xC0000000)>>30);
-	
-		switch (iType)
-	  {
-     case ADC0DMAWRITE: 
-	     Desc.srcEndPtr                  = (unsigned int)&pucTX_DMA;
-		   Desc.destEndPtr                 = (unsigned int)(pADI_ADC0->MSKI + iNumVals - 0x1); 
-       if (iChanSel == 0)
-		      *Dma_GetDescriptor(ADC0_C-1,0) = Desc;     // primary structure
-		   else 
-			    *Dma_GetDescriptor(ADC0_C-1,1) = Desc; // alternate structure
-		   break;
-	   case ADC1DMAWRITE:
-	     Desc.srcEndPtr                  = (unsigned int)&pucTX_DMA;
-		   Desc.destEndPtr                 = (unsigned int)(pADI_ADC1->MSKI + iNumVals - 0x1); 
-		 if (iChanSel == 0)
-		      *Dma_GetDescriptor(ADC1_C-1,0) = Desc;     // primary structure
-		   else 
-			    *Dma_GetDescriptor(ADC1_C-1,1) = Desc; // alternate structure
-		   break;
-	   default:	 
-		     break;	
-	   }
-return 1;	
+	return AdcDmaSetup(iType, iCfg, iNumVals, pucTX_DMA, 0);
 }
 /**
    @brief int DacDmaWriteSetup(int iType, int iCfg, int iNumVals, int *pucTX_DMA)	
             ==========Specific function to setup DAC DMA control structure
-       Source address always starts with ADCxMSKI register.
-   @param iType :{DAC_C,DAC_C+iALTERNATE}
+   @param iType :{DAC_C,DAC_C+ALTERNATE}
       - 9 or DAC_C for DAC Primary DMA control 
-      - 21 or DAC_C+iALTERNATE for DAC Alternate DMA control
+      - 25 or DAC_C+ALTERNATE for DAC Alternate DMA control
    @param iCfg :{DMA_DSTINC_BYTE|DMA_DSTINC_HWORD|DMA_DSTINC_WORD|DMA_DSTINC_NO|
                   DMA_SRCINC_BYTE|DMA_SRCINC_HWORD|DMA_SRCINC_WORD|DMA_SRCINC_NO|
                   DMA_SIZE_BYTE|DMA_SIZE_HWORD|DMA_SIZE_WORD|
@@ -887,44 +1071,15 @@ return 1;
     - Number of values to be transferred 	
    @param *pucTX_DMA :{0-0xFFFFFFFF}
     - Pass Source pointer  address for DMA transfers
-   @return 1:
+   @return 1 or 0 if iType is not DAC_C or DAC_C+ALTERNATE
+    or the size in iCfg is not DMA_SIZE_WORD.
 
 **/
 int DacDmaWriteSetup(int iType, int iCfg, int iNumVals, int *pucTX_DMA)
 {
-	 int iChanSel = 0;
-	 DmaDesc Desc;
-	
-	 if (iType > 12)
-	  {
-		 iChanSel = 1;  // Alternalte
-	  }
-    else
-	  iChanSel = 0;
-
-    // Common configuration of all the descriptors used here
-    Desc.ctrlCfg.Bits.cycle_ctrl       = (iCfg & 0x7);
-    Desc.ctrlCfg.Bits.next_useburst    = 0x0;
-    Desc.ctrlCfg.Bits.r_power          = 0;  
-    Desc.ctrlCfg.Bits.src_prot_ctrl    = 0x0;
-    Desc.ctrlCfg.Bits.dst_prot_ctrl    = 0x0;
-    Desc.ctrlCfg.Bits.src_size         = ((iCfg & 0x3000000)>>24);
-    Desc.ctrlCfg.Bits.dst_size         = ((iCfg & 0x3000000)>>24);
-
-    Desc.ctrlCfg.Bits.n_minus_1        = iNumVals - 0x1;
-    Desc.ctrlCfg.Bits.src_inc          = ((iCfg & 0xC000000)>>26);
-    Desc.ctrlCfg.Bits.dst_inc          = ((iCfg & 0xC0000000)>>30);
-	
-    Desc.srcEndPtr                  = (unsigned int)(pucTX_DMA + iNumVals - 0x1);
-	 Desc.destEndPtr                 = (unsigned int)(&pADI_DAC->DACDAT); 
-    if (iChanSel == 0)
-	     *Dma_GetDescriptor(DAC_C-1,0) = Desc;     // primary structure
-	 else 
-	     *Dma_GetDescriptor(DAC_C-1,1) = Desc; // alternate structure
-
-return 1;	
+	if((iType & (ALTERNATE-1)) != DAC_C)
+		return 0;
+	return DmaChanSetup(iType, iCfg, iNumVals, pucTX_DMA, 0);
 }
 
 /**@}*/
-
-
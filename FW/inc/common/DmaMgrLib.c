@@ -0,0 +1,586 @@
+/**
+ *****************************************************************************
+   @addtogroup dmamgr
+   @{
+   @file     DmaMgrLib.c
+   @brief    Set of DMA channel manager functions on top of DmaLib.
+   - Set up the controller with DmaMgrInit().
+   - Claim a channel with DmaMgrAcq(), free it with DmaMgrRel().
+   - Start a transfer with DmaMgrXfer() or a scatter-gather task list with
+     DmaMgrSgXfer(), which call back when they end.
+   - Read the state of a channel with DmaMgrSta().
+   - Copy and fill memory with DmaMemcpy() and DmaMemset().
+
+   @version  V0.5
+   @author   ADI
+   @date     October 2026
+   @par Revision History:
+   - V0.1, October 2026: initial version.
+   - V0.2, October 2026: DmaMgrSgXfer() and DMA_AUTO started by software request.
+   - V0.3, October 2026: DmaMemcpy() and DmaMemset().
+   - V0.4, October 2026: structures checked with DmaDescChk() before starting.
+     Bus errors handled by DmaErrInt(), which re-arms faulted channels.
+   - V0.5, October 2026: DmaMemcpy() and DmaMemset() return -1 when a bus
+     error ends a copy they wait for.
+
+   @note
+      The DMA_*_Int_Handler() of the channels in DMAMGR_VECTORS and
+      DMA_Err_Int_Handler() are defined here. Each one calls the shared
+      dispatcher, which masks the channel once its transfer has ended,
+      records the state and calls the callback given to DmaMgrXfer(). A
+      driver therefore neither writes its own handler nor polls a flag, and
+      transfers on several channels overlap without extra bookkeeping.
+      Callbacks run in the DMA interrupt and may start the next transfer.
+
+All files for ADuCM360 provided by ADI, including this file, are
+provided  as is without warranty of any kind, either expressed or implied.
+The user assumes any and all risk from the use of this code.
+It is the responsibility of the person integrating this code into an application
+to ensure that the resulting application performs as required and is safe.
+
+**/
+
+#include <string.h>
+#include "DmaMgrLib.h"
+
+// State of each channel, in channel order
+typedef struct
+{
+	volatile unsigned char ucSta;				// DMAMGR_FREE...DMAMGR_ERR
+	unsigned char ucCyc;						// Cycle type of the running transfer
+	void (*pfDone)(int iChan, int iSta);		// Callback, 0 for none
+} DmaMgrChan;
+
+static DmaMgrChan DmaMgrCh[SINC2_C];
+
+// Memory transfer of DmaMemcpy() or DmaMemset(), run in chunks of up to 1024 values
+static int iMemMin = DMAMGR_MEM_MIN;
+static volatile int iMemBusy = 0;
+static volatile int iMemSta;					// DMAMGR_DONE or DMAMGR_ERR, how it ended
+static unsigned char *pucMemDst;
+static const unsigned char *pucMemSrc;			// 0 for DmaMemset()
+static unsigned int uiMemLeft;					// Values not started yet
+static int iMemCfg;								// Size and increments
+static unsigned long ulMemFill;					// Source of DmaMemset()
+static void (*pfMemDone)(int iChan, int iSta);
+
+static void DmaMgrStart(int iChan, int iCyc, void (*pfDone)(int iChan, int iSta));
+static void DmaMemStart(void);
+static void DmaMemNext(int iChan, int iSta);
+
+/**
+	@brief static void DmaMgrStart(int iChan, int iCyc, void (*pfDone)(int iChan, int iSta))
+			==========Marks a channel busy and starts it on its primary structure.
+		Memory cycle types are started by a software request with the
+		peripheral requests left masked, the others by unmasking them.
+**/
+
+static void DmaMgrStart(int iChan, int iCyc, void (*pfDone)(int iChan, int iSta))
+	{
+	DmaMgrChan *pCh = &DmaMgrCh[iChan-1];
+	int iBit = 1 << (iChan-1);
+
+	pCh->pfDone = pfDone;
+	pCh->ucCyc = iCyc;
+	pCh->ucSta = DMAMGR_BUSY;
+	NVIC_ClearPendingIRQ((IRQn_Type)(INT_NUM_DMA_FIRST + iChan-1));
+	NVIC_EnableIRQ((IRQn_Type)(INT_NUM_DMA_FIRST + iChan-1));
+	DmaClr(0, 0, iBit, 0);						// Start on the primary structure
+	if((iCyc == DMA_AUTO) || (iCyc == DMA_MSG_PRI))
+		{
+		DmaSet(iBit, iBit, 0, 0);
+		pADI_DMA->DMASWREQ = iBit;
+		}
+	else
+		{
+		DmaClr(iBit, 0, 0, 0);					// Unmask peripheral requests
+		DmaSet(0, iBit, 0, 0);
+		}
+	}
+
+/**
+	@brief int DmaMgrInit(void)
+			==========Sets up the DMA controller and frees all channels.
+	@return 1.
+	@note
+		- Calls DmaBase(), so call it once before any DMA user, UrtLib included.
+**/
+
+int DmaMgrInit(void)
+	{
+	int i1;
+
+	DmaBase();
+	for(i1=0; i1<SINC2_C; i1++)
+		{
+		DmaMgrCh[i1].ucSta = DMAMGR_FREE;
+		DmaMgrCh[i1].pfDone = 0;
+		}
+	DmaErr(DMA_ERR_CLR);
+	NVIC_EnableIRQ(DMA_ERR_IRQn);
+	return 1;
+	}
+
+/**
+	@brief int DmaMgrAcq(int iChan)
+			==========Claims a channel.
+	@param iChan :{SPI1TX_C,SPI1RX_C,UARTTX_C,UARTRX_C,I2CSTX_C,I2CSRX_C,I2CMTX_C,I2CMRX_C,DAC_C,ADC0_C,ADC1_C,SINC2_C}	\n
+		Channel to claim.
+	@return 1 if claimed or 0 if iChan is not a channel or is already claimed.
+	@note
+		- May be called from interrupts.
+**/
+
+int DmaMgrAcq(int iChan)
+	{
+	unsigned long ulPri;
+	int iOk = 0;
+
+	if((iChan < SPI1TX_C) || (iChan > SINC2_C))
+		return 0;
+	ulPri = __get_PRIMASK();
+	__disable_irq();
+	if(DmaMgrCh[iChan-1].ucSta == DMAMGR_FREE)
+		{
+		DmaMgrCh[iChan-1].ucSta = DMAMGR_IDLE;
+		iOk = 1;
+		}
+	__set_PRIMASK(ulPri);
+	return iOk;
+	}
+
+/**
+	@brief int DmaMgrRel(int iChan)
+			==========Stops a claimed channel and frees it.
+	@param iChan :{SPI1TX_C-SINC2_C}	\n
+		Channel claimed with DmaMgrAcq().
+	@return 1 or 0 if iChan is not a claimed channel.
+	@note
+		- A running transfer is abandoned without calling its callback.
+**/
+
+int DmaMgrRel(int iChan)
+	{
+	int iBit;
+
+	if((iChan < SPI1TX_C) || (iChan > SINC2_C) || (DmaMgrCh[iChan-1].ucSta == DMAMGR_FREE))
+		return 0;
+	iBit = 1 << (iChan-1);
+	DmaSet(iBit, 0, 0, 0);						// Mask requests first
+	DmaClr(0, iBit, iBit, 0);
+	NVIC_DisableIRQ((IRQn_Type)(INT_NUM_DMA_FIRST + iChan-1));
+	NVIC_ClearPendingIRQ((IRQn_Type)(INT_NUM_DMA_FIRST + iChan-1));
+	DmaMgrCh[iChan-1].pfDone = 0;
+	DmaMgrCh[iChan-1].ucSta = DMAMGR_FREE;
+	return 1;
+	}
+
+/**
+	@brief int DmaMgrXfer(int iChan, int iCfg, int iNumVals, void *pMem, int iDir, void (*pfDone)(int iChan, int iSta))
+			==========Sets up a transfer on a claimed channel and starts it.
+	@param iChan :{SPI1TX_C-SINC2_C, SPI1TX_C+ALTERNATE-SINC2_C+ALTERNATE}	\n
+		Channel claimed with DmaMgrAcq(). Add ALTERNATE to only set up the
+		alternate structure, which is used by DMA_PING transfers: set it up
+		first, then start the channel with the primary structure.
+	@param iCfg :{DMA_DSTINC_BYTE|DMA_DSTINC_HWORD|DMA_DSTINC_WORD|DMA_DSTINC_NO|
+		DMA_SRCINC_BYTE|DMA_SRCINC_HWORD|DMA_SRCINC_WORD|DMA_SRCINC_NO|
+		DMA_SIZE_BYTE|DMA_SIZE_HWORD|DMA_SIZE_WORD|DMA_BASIC|DMA_AUTO|DMA_PING}	\n
+		Increments, size and cycle type as for DmaPeripheralStructSetup()
+		and DmaCycleCntCtrl(). DMA_AUTO is started by a software request.
+	@param iNumVals :{1-1024}	\n
+		Number of values to transfer.
+	@param pMem :{}	\n
+		Memory side of the transfer.
+	@param iDir :{DMAMGR_TX, DMAMGR_RX}	\n
+		DMAMGR_TX for memory to peripheral, DMAMGR_RX for peripheral to memory.
+	@param pfDone :{}	\n
+		Called from the DMA interrupt as pfDone(iChan, DMAMGR_DONE) when a
+		structure has been transferred, iChan having ALTERNATE added for the
+		alternate structure, or as pfDone(iChan, DMAMGR_ERR) after a bus
+		error. 0 for no callback. Ignored with ALTERNATE.
+	@return 1 if started or 0 if the channel is not claimed, is still busy,
+		does not take the direction or size given, or DmaDescChk() finds
+		the structure, or with DMA_PING the alternate structure, wrong.
+	@note
+		- The peripheral must be set up to request DMA transfers.
+		- DmaMgrSta() stays DMAMGR_BUSY until the channel stops. With
+		DMA_PING the callback may re-arm the structure that just finished
+		with DmaStructPtrOutSetup()/DmaStructPtrInSetup() and DmaCycleCntCtrl().
+**/
+
+int DmaMgrXfer(int iChan, int iCfg, int iNumVals, void *pMem, int iDir, void (*pfDone)(int iChan, int iSta))
+	{
+	int iPri = iChan & (ALTERNATE-1);
+	DmaMgrChan *pCh;
+	int iOk;
+
+	if((iPri < SPI1TX_C) || (iPri > SINC2_C))
+		return 0;
+	pCh = &DmaMgrCh[iPri-1];
+	if((pCh->ucSta == DMAMGR_FREE) || ((pCh->ucSta == DMAMGR_BUSY) && !(iChan & ALTERNATE)))
+		return 0;
+	if(DmaPeripheralStructSetup(iChan, iCfg) == 0)
+		return 0;
+	if(iDir == DMAMGR_RX)
+		iOk = DmaStructPtrInSetup(iChan, iNumVals, pMem);
+	else
+		iOk = DmaStructPtrOutSetup(iChan, iNumVals, pMem);
+	if((iOk == 0) || (DmaCycleCntCtrl(iChan, iNumVals, iCfg) == 0) || DmaDescChk(iChan))
+		return 0;
+	if(iChan & ALTERNATE)
+		return 1;
+	if(((iCfg & 0x7) == DMA_PING) && DmaDescChk(iChan + ALTERNATE))
+		return 0;
+	DmaMgrStart(iPri, iCfg & 0x7, pfDone);
+	return 1;
+	}
+
+/**
+	@brief int DmaMgrSgXfer(int iChan, const DmaSgTask *pTask, int iNum, DmaDesc *pList, int iMode, void (*pfDone)(int iChan, int iSta))
+			==========Starts a scatter-gather task list on a claimed channel.
+	@param iChan :{SPI1TX_C-SINC2_C}	\n
+		Channel claimed with DmaMgrAcq().
+	@param pTask :{}	\n
+		Tasks, see DmaSgBuild().
+	@param iNum :{1-256}	\n
+		Number of tasks.
+	@param pList :{}	\n
+		Task list of iNum descriptors, valid until the callback.
+	@param iMode :{DMA_MSG_PRI,DMA_PSG_PRI}	\n
+		DMA_MSG_PRI runs the list at once, DMA_PSG_PRI on peripheral requests.
+	@param pfDone :{}	\n
+		Called once as for DmaMgrXfer() when the last task has finished.
+	@return 1 if started or 0 if the channel is not claimed, is still busy
+		or the list cannot be built.
+**/
+
+int DmaMgrSgXfer(int iChan, const DmaSgTask *pTask, int iNum, DmaDesc *pList, int iMode, void (*pfDone)(int iChan, int iSta))
+	{
+	if((iChan < SPI1TX_C) || (iChan > SINC2_C)
+		|| (DmaMgrCh[iChan-1].ucSta == DMAMGR_FREE) || (DmaMgrCh[iChan-1].ucSta == DMAMGR_BUSY))
+		return 0;
+	if((DmaSgBuild(iChan, pTask, iNum, pList, iMode) == 0) || DmaDescChk(iChan))
+		return 0;
+	DmaMgrStart(iChan, iMode, pfDone);
+	return 1;
+	}
+
+/**
+	@brief int DmaMgrSta(int iChan)
+			==========Returns the state of a channel.
+	@param iChan :{SPI1TX_C-SINC2_C}	\n
+		Channel.
+	@return DMAMGR_FREE, DMAMGR_IDLE, DMAMGR_BUSY, DMAMGR_DONE or DMAMGR_ERR,
+		DMAMGR_FREE if iChan is not a channel.
+**/
+
+int DmaMgrSta(int iChan)
+	{
+	if((iChan < SPI1TX_C) || (iChan > SINC2_C))
+		return DMAMGR_FREE;
+	return DmaMgrCh[iChan-1].ucSta;
+	}
+
+/**
+	@brief void DmaMgrInt(int iChan)
+			==========Shared dispatcher of the channel done interrupts.
+	@param iChan :{SPI1TX_C-SINC2_C}	\n
+		Channel whose interrupt was raised.
+	@note
+		- Called by the DMA_*_Int_Handler() defined here. Call it from the
+		application's own handler for a channel left out of DMAMGR_VECTORS.
+**/
+
+void DmaMgrInt(int iChan)
+	{
+	DmaMgrChan *pCh = &DmaMgrCh[iChan-1];
+	int iBit = 1 << (iChan-1);
+	int iDone = iChan;
+
+	if(pCh->ucSta != DMAMGR_BUSY)
+		{
+		DmaSet(iBit, 0, 0, 0);					// Stray request, mask it
+		return;
+		}
+	if((pCh->ucCyc == DMA_PING) && !(pADI_DMA->DMAALTSET & iBit))
+		iDone = iChan + ALTERNATE;				// Back on the primary, the alternate finished
+	if(!(pADI_DMA->DMAENSET & iBit))			// Channel stopped
+		{
+		DmaSet(iBit, 0, 0, 0);
+		pCh->ucSta = DMAMGR_DONE;
+		}
+	if(pCh->pfDone)
+		pCh->pfDone(iDone, DMAMGR_DONE);
+	}
+
+/**
+	@brief void DmaMgrErrInt(void)
+			==========Dispatcher of the DMA bus error interrupt.
+	@note
+		- DmaErrInt() finds the channels the error stopped and re-arms them.
+		A busy channel it leaves stopped is marked DMAMGR_ERR and its
+		callback is called.
+**/
+
+void DmaMgrErrInt(void)
+	{
+	int iStop = DmaErrInt();
+	int i1;
+
+	for(i1=0; i1<SINC2_C; i1++)
+		{
+		if(((iStop & (1 << i1)) == 0) || (DmaMgrCh[i1].ucSta != DMAMGR_BUSY))
+			continue;
+		DmaSet(1 << i1, 0, 0, 0);
+		DmaMgrCh[i1].ucSta = DMAMGR_ERR;
+		if(DmaMgrCh[i1].pfDone)
+			DmaMgrCh[i1].pfDone(i1+1, DMAMGR_ERR);
+		}
+	}
+
+/**
+	@brief int DmaMemCfg(int iMin)
+			==========Sets the shortest copy or fill DmaMemcpy() and DmaMemset() pass to the DMA.
+	@param iMin :{0-}	\n
+		Length in bytes. Shorter ones are done by the CPU. 0 sends all to the DMA.
+	@return Previous value, DMAMGR_MEM_MIN after reset.
+**/
+
+int DmaMemCfg(int iMin)
+	{
+	int iOld = iMemMin;
+
+	iMemMin = iMin;
+	return iOld;
+	}
+
+/**
+	@brief int DmaMemcpy(void *pDst, const void *pSrc, int iLen, void (*pfDone)(int iChan, int iSta))
+			==========Copies memory with DMA_AUTO transfers on channel DMAMGR_MEM_CHAN.
+	@param pDst :{}	\n
+		Destination. Must not overlap pSrc.
+	@param pSrc :{}	\n
+		Source.
+	@param iLen :{0-}	\n
+		Number of bytes.
+	@param pfDone :{}	\n
+		0 to return once the copy is done. Otherwise the function returns at
+		once and pfDone(DMAMGR_MEM_CHAN, DMAMGR_DONE or DMAMGR_ERR) is called
+		from the DMA interrupt when the copy is done.
+	@return 1 if the DMA took the copy or 0 if the CPU did it, in which case
+		pfDone has already been called. -1 if pfDone is 0 and a bus error
+		ended the DMA copy part way, the destination is then only partly
+		written.
+	@note
+		- The CPU copies lengths under the DmaMemCfg() setting, and also copies
+		when the channel is taken, by a previous asynchronous copy for example.
+		- Words are moved when pDst and pSrc are word aligned, half-words when
+		they are half-word aligned, bytes otherwise. The CPU copies the last
+		bytes that do not fill a value.
+		- The DMA interrupts must be enabled, also to wait for the copy.
+**/
+
+int DmaMemcpy(void *pDst, const void *pSrc, int iLen, void (*pfDone)(int iChan, int iSta))
+	{
+	unsigned int uiAlign = (unsigned int)pDst | (unsigned int)pSrc;
+	int iSize = ((uiAlign & 3) == 0) ? 2 : (((uiAlign & 1) == 0) ? 1 : 0);
+	int iTail = iLen & ((1 << iSize) - 1);
+
+	if(iLen < 0)
+		iLen = 0;
+	if((iLen < iMemMin) || (iLen < (1 << iSize)) || (DmaMgrAcq(DMAMGR_MEM_CHAN) == 0))
+		{
+		memcpy(pDst, pSrc, iLen);
+		if(pfDone)
+			pfDone(DMAMGR_MEM_CHAN, DMAMGR_DONE);
+		return 0;
+		}
+	memcpy((unsigned char *)pDst + iLen - iTail, (const unsigned char *)pSrc + iLen - iTail, iTail);
+	pucMemDst = pDst;
+	pucMemSrc = pSrc;
+	uiMemLeft = iLen >> iSize;
+	iMemCfg = (iSize << 24) | (iSize << 26) | (iSize << 30);
+	pfMemDone = pfDone;
+	iMemBusy = 1;
+	DmaMemStart();
+	if(pfDone)
+		return 1;
+	while(iMemBusy);
+	return (iMemSta == DMAMGR_DONE) ? 1 : -1;
+	}
+
+/**
+	@brief int DmaMemset(void *pDst, int iVal, int iLen, void (*pfDone)(int iChan, int iSta))
+			==========Fills memory with DMA_AUTO transfers on channel DMAMGR_MEM_CHAN.
+	@param pDst :{}	\n
+		Destination.
+	@param iVal :{0-255}	\n
+		Byte value written.
+	@param iLen :{0-}	\n
+		Number of bytes.
+	@param pfDone :{}	\n
+		As for DmaMemcpy().
+	@return As DmaMemcpy(), -1 if pfDone is 0 and a bus error ended the
+		fill part way.
+	@note
+		- As for DmaMemcpy(), with the alignment of pDst alone.
+**/
+
+int DmaMemset(void *pDst, int iVal, int iLen, void (*pfDone)(int iChan, int iSta))
+	{
+	unsigned int uiAlign = (unsigned int)pDst;
+	int iSize = ((uiAlign & 3) == 0) ? 2 : (((uiAlign & 1) == 0) ? 1 : 0);
+	int iTail = iLen & ((1 << iSize) - 1);
+
+	if(iLen < 0)
+		iLen = 0;
+	if((iLen < iMemMin) || (iLen < (1 << iSize)) || (DmaMgrAcq(DMAMGR_MEM_CHAN) == 0))
+		{
+		memset(pDst, iVal, iLen);
+		if(pfDone)
+			pfDone(DMAMGR_MEM_CHAN, DMAMGR_DONE);
+		return 0;
+		}
+	memset((unsigned char *)pDst + iLen - iTail, iVal, iTail);
+	ulMemFill = (iVal & 0xFF) * 0x01010101UL;
+	pucMemDst = pDst;
+	pucMemSrc = 0;
+	uiMemLeft = iLen >> iSize;
+	iMemCfg = (iSize << 24) | DMA_SRCINC_NO | (iSize << 30);
+	pfMemDone = pfDone;
+	iMemBusy = 1;
+	DmaMemStart();
+	if(pfDone)
+		return 1;
+	while(iMemBusy);
+	return (iMemSta == DMAMGR_DONE) ? 1 : -1;
+	}
+
+/**
+	@brief int DmaMemBusy(void)
+			==========Returns 1 while an asynchronous DmaMemcpy() or DmaMemset() runs.
+**/
+
+int DmaMemBusy(void)
+	{
+	return iMemBusy;
+	}
+
+/**
+	@brief static void DmaMemStart(void)
+			==========Starts the next chunk of the memory transfer.
+**/
+
+static void DmaMemStart(void)
+	{
+	unsigned int uiNum = (uiMemLeft > 1024) ? 1024 : uiMemLeft;
+	unsigned int uiBytes = uiNum << ((iMemCfg >> 24) & 0x3);
+
+	DmaStructMemSetup(DMAMGR_MEM_CHAN, iMemCfg | DMA_AUTO, uiNum,
+		pucMemSrc ? (volatile void *)pucMemSrc : (volatile void *)&ulMemFill, pucMemDst);
+	pucMemDst += uiBytes;
+	if(pucMemSrc)
+		pucMemSrc += uiBytes;
+	uiMemLeft -= uiNum;
+	DmaMgrStart(DMAMGR_MEM_CHAN, DMA_AUTO, DmaMemNext);
+	}
+
+/**
+	@brief static void DmaMemNext(int iChan, int iSta)
+			==========Callback of each chunk: starts the next one or ends the transfer.
+**/
+
+static void DmaMemNext(int iChan, int iSta)
+	{
+	if((iSta == DMAMGR_DONE) && uiMemLeft)
+		{
+		DmaMemStart();
+		return;
+		}
+	DmaMgrRel(DMAMGR_MEM_CHAN);
+	iMemSta = iSta;
+	iMemBusy = 0;
+	if(pfMemDone)
+		pfMemDone(iChan, iSta);
+	}
+
+#if DMAMGR_VECTORS
+void DMA_Err_Int_Handler(void)
+	{
+	DmaMgrErrInt();
+	}
+#endif
+#if DMAMGR_VECTORS & SPI1TX_B
+void DMA_SPI1_TX_Int_Handler(void)
+	{
+	DmaMgrInt(SPI1TX_C);
+	}
+#endif
+#if DMAMGR_VECTORS & SPI1RX_B
+void DMA_SPI1_RX_Int_Handler(void)
+	{
+	DmaMgrInt(SPI1RX_C);
+	}
+#endif
+#if DMAMGR_VECTORS & UARTTX_B
+void DMA_UART_TX_Int_Handler(void)
+	{
+	DmaMgrInt(UARTTX_C);
+	}
+#endif
+#if DMAMGR_VECTORS & UARTRX_B
+void DMA_UART_RX_Int_Handler(void)
+	{
+	DmaMgrInt(UARTRX_C);
+	}
+#endif
+#if DMAMGR_VECTORS & I2CSTX_B
+void DMA_I2C0_STX_Int_Handler(void)
+	{
+	DmaMgrInt(I2CSTX_C);
+	}
+#endif
+#if DMAMGR_VECTORS & I2CSRX_B
+void DMA_I2C0_SRX_Int_Handler(void)
+	{
+	DmaMgrInt(I2CSRX_C);
+	}
+#endif
+#if DMAMGR_VECTORS & I2CMTX_B
+void DMA_I2C0_MTX_Int_Handler(void)
+	{
+	DmaMgrInt(I2CMTX_C);
+	}
+#endif
+#if DMAMGR_VECTORS & I2CMRX_B
+void DMA_I2C0_MRX_Int_Handler(void)
+	{
+	DmaMgrInt(I2CMRX_C);
+	}
+#endif
+#if DMAMGR_VECTORS & DAC_B
+void DMA_DAC_Out_Int_Handler(void)
+	{
+	DmaMgrInt(DAC_C);
+	}
+#endif
+#if DMAMGR_VECTORS & ADC0_B
+void DMA_ADC0_Int_Handler(void)
+	{
+	DmaMgrInt(ADC0_C);
+	}
+#endif
+#if DMAMGR_VECTORS & ADC1_B
+void DMA_ADC1_Int_Handler(void)
+	{
+	DmaMgrInt(ADC1_C);
+	}
+#endif
+#if DMAMGR_VECTORS & SYNC2_B
+void DMA_SINC2_Int_Handler(void)
+	{
+	DmaMgrInt(SINC2_C);
+	}
+#endif
+
+/**@}*/
@@ -0,0 +1,84 @@
+/**
+ *****************************************************************************
+   @file     DmaMgrLib.h
+   @brief    Set of DMA channel manager functions on top of DmaLib.
+   - Set up the controller with DmaMgrInit().
+   - Claim a channel with DmaMgrAcq(), free it with DmaMgrRel().
+   - Start a transfer with DmaMgrXfer() or a scatter-gather task list with
+     DmaMgrSgXfer(), which call back when they end.
+   - Read the state of a channel with DmaMgrSta().
+   - Copy and fill memory with DmaMemcpy() and DmaMemset().
+
+   @version  V0.5
+   @author   ADI
+   @date     October 2026
+   @par Revision History:
+   - V0.1, October 2026: initial version.
+   - V0.2, October 2026: DmaMgrSgXfer() and DMA_AUTO started by software request.
+   - V0.3, October 2026: DmaMemcpy() and DmaMemset().
+   - V0.4, October 2026: structures checked with DmaDescChk() before starting.
+     Bus errors handled by DmaErrInt(), which re-arms faulted channels.
+   - V0.5, October 2026: DmaMemcpy() and DmaMemset() return -1 when a bus
+     error ends a copy they wait for.
+
+
+
+All files for ADuCM360 provided by ADI, including this file, are
+provided  as is without warranty of any kind, either expressed or implied.
+The user assumes any and all risk from the use of this code.
+It is the responsibility of the person integrating this code into an application
+to ensure that the resulting application performs as required and is safe.
+
+**/
+#ifndef DMAMGRLIB_H
+#define DMAMGRLIB_H
+
+#include "DmaLib.h"
+
+// Channels whose DMA_*_Int_Handler() DmaMgrLib.c provides, as DmaLib channel
+// bits (SPI1TX_B...SYNC2_B). Clear the bit of a channel whose handler the
+// application keeps, for example UARTTX_B|UARTRX_B with UrtLib DMA.
+#ifndef DMAMGR_VECTORS
+#define DMAMGR_VECTORS	0xFFF
+#endif
+
+// Channel lent to DmaMemcpy() and DmaMemset() while they run. Its peripheral
+// cannot use DMA at the same time.
+#ifndef DMAMGR_MEM_CHAN
+#define DMAMGR_MEM_CHAN	I2CSTX_C
+#endif
+
+// Default shortest copy or fill in bytes given to the DMA, see DmaMemCfg().
+// Below it starting the channel and taking its interrupt cost more than a
+// CPU copy. The DmaMem example measures the crossover.
+#ifndef DMAMGR_MEM_MIN
+#define DMAMGR_MEM_MIN	64
+#endif
+
+// Channel states returned by DmaMgrSta() and passed to the callbacks
+#define DMAMGR_FREE		0	// Not acquired
+#define DMAMGR_IDLE		1	// Acquired, no transfer started yet
+#define DMAMGR_BUSY		2	// Transfer running
+#define DMAMGR_DONE		3	// Last transfer complete
+#define DMAMGR_ERR		4	// Last transfer stopped by a bus error
+
+// Direction of DmaMgrXfer(), only needed to tell ADC0_C and ADC1_C apart
+#define DMAMGR_TX		0	// Memory to peripheral register
+#define DMAMGR_RX		1	// Peripheral register to memory
+
+extern int DmaMgrInit(void);
+extern int DmaMgrAcq(int iChan);
+extern int DmaMgrRel(int iChan);
+extern int DmaMgrXfer(int iChan, int iCfg, int iNumVals, void *pMem, int iDir,
+   void (*pfDone)(int iChan, int iSta));
+extern int DmaMgrSgXfer(int iChan, const DmaSgTask *pTask, int iNum, DmaDesc *pList, int iMode,
+   void (*pfDone)(int iChan, int iSta));
+extern int DmaMgrSta(int iChan);
+extern int DmaMemCfg(int iMin);
+extern int DmaMemcpy(void *pDst, const void *pSrc, int iLen, void (*pfDone)(int iChan, int iSta));
+extern int DmaMemset(void *pDst, int iVal, int iLen, void (*pfDone)(int iChan, int iSta));
+extern int DmaMemBusy(void);
+extern void DmaMgrInt(int iChan);
+extern void DmaMgrErrInt(void);
+
+#endif
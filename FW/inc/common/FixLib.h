@@ -0,0 +1,103 @@
+/**
+ *****************************************************************************
+   @file     FixLib.h
+   @brief    Set of fixed-point conversion functions for ADC results.
+   - Precompute a scale with FixAdcCfg() for each gain and reference, or
+     FixScaleSet() for any ratio.
+   - Convert ADC codes to microvolts with FixMul() or a DMA buffer with
+     FixMulBlk(). Average a buffer with FixAvg().
+   - Scale one value by a ratio of two others with FixRatio(), for example
+     an RTD resistance in milliohms.
+   - Linearise with a table of equally spaced points with FixLin() or
+     FixLinBlk(), for example milliohms to millidegrees.
+   - Linearise with precomputed slopes and intercepts with FixSeg() or
+     FixSegBlk(), without a divide.
+   - Evaluate a polynomial in Horner form with FixPoly() or FixPolyBlk(),
+     for example an ITS-90 thermocouple inverse polynomial.
+
+   @version  V0.3
+   @author   ADI
+   @date     October 2026
+   @par Revision History:
+   - V0.1, October 2026: initial version.
+   - V0.2, October 2026: added FixSeg() and FixSegBlk().
+   - V0.3, October 2026: added FixPoly() and FixPolyBlk().
+
+
+
+All files for ADuCM360 provided by ADI, including this file, are
+provided  as is without warranty of any kind, either expressed or implied.
+The user assumes any and all risk from the use of this code.
+It is the responsibility of the person integrating this code into an application
+to ensure that the resulting application performs as required and is safe.
+
+**/
+#ifndef FIXLIB_H
+#define FIXLIB_H
+
+// Internal reference in microvolts, for FixAdcCfg()
+#define FIX_REF_INT_UV	1200000
+
+// Bits of a signed ADC result over the full scale, +-Vref/gain is +-2^28
+#define FIX_ADC_BITS	28
+
+// Precomputed scale: out = (in*lMul) >> iShift, rounded
+typedef struct
+{
+   long lMul;                    // 2^30 to 2^31-1 unless the ratio is large
+   int iShift;                   // 1 to 62
+} FixScale;
+
+// Table of iSeg+1 outputs at inputs lX0, lX0+lStep, ... for FixLin()
+typedef struct
+{
+   long lX0;                     // Input of plY[0]
+   long lStep;                   // Input step between points, above 0
+   int iSeg;                     // Segments, plY holds iSeg+1 points
+   const long *plY;              // Outputs
+} FixLinTab;
+
+// One segment of a FixSegTab: out = lB + ((lM*(in-lX0)) >> iFrac)
+typedef struct
+{
+   long lM;                      // Slope with iFrac fraction bits
+   long lB;                      // Output of the segment line at lX0
+} FixSegPt;
+
+// Table of equally spaced segments for FixSeg(), usually generated on a host
+typedef struct
+{
+   long lX0;                     // Input at the start of segment 0
+   unsigned long ulInv;          // 2^32/segment width, width above 1
+   int iSeg;                     // Segments in pSeg
+   int iFrac;                    // Fraction bits of the slopes, 0 to 62
+   const FixSegPt *pSeg;         // Segments
+} FixSegTab;
+
+// Polynomial for FixPoly(), usually generated on a host:
+// out = (sum of plC[i]*u^i) >> iFrac, u = (in-lX0) << iShift as a fraction of 2^31
+typedef struct
+{
+   long lX0;                     // Input at u = 0
+   long lXMin;                   // Inputs are clamped to lXMin..lXMax
+   long lXMax;
+   int iShift;                   // |u| below 2^31 from lXMin to lXMax
+   int iOrder;                   // Order, plC holds iOrder+1 coefficients
+   int iFrac;                    // Fraction bits of plC and of the sums, 1 to 30
+   const long *plC;              // Coefficients from order 0
+} FixPolyTab;
+
+extern int FixScaleSet(FixScale *pScale, unsigned long ulNum, unsigned long ulDen, int iDenShift);
+extern int FixAdcCfg(FixScale *pScale, int iGain, unsigned long ulRefUv);
+extern long FixMul(const FixScale *pScale, long lIn);
+extern int FixMulBlk(const FixScale *pScale, const int *piIn, long *plOut, int iNum);
+extern long FixAvg(const int *piIn, int iNum);
+extern long FixRatio(long lNum, long lDen, long lScale);
+extern long FixLin(const FixLinTab *pTab, long lX);
+extern int FixLinBlk(const FixLinTab *pTab, const long *plX, long *plY, int iNum);
+extern long FixSeg(const FixSegTab *pTab, long lX);
+extern int FixSegBlk(const FixSegTab *pTab, const long *plX, long *plY, int iNum);
+extern long FixPoly(const FixPolyTab *pTab, long lX);
+extern int FixPolyBlk(const FixPolyTab *pTab, const long *plX, long *plY, int iNum);
+
+#endif
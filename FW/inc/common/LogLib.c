@@ -0,0 +1,282 @@
+/**
+ *****************************************************************************
+   @addtogroup log
+   @{
+   @file     LogLib.c
+   @brief    Set of deferred binary logging functions.
+   - Set up the record ring and output with LogCfg().
+   - Log a format ID and raw arguments with LogWr0(), LogWr1(), LogWr2()
+     or LogWr().
+   - Send queued records from the main loop with LogPoll().
+
+   @version  V0.1
+   @author   ADI
+   @date     October 2026
+   @par Revision History:
+   - V0.1, October 2026: initial version.
+
+   @note
+      Formatting text with sprintf() takes thousands of cycles per float on
+      the Cortex-M3, which has no FPU, and sending it byte by byte blocks the
+      measurement loop. Here a call site only stores a format ID and the raw
+      32-bit arguments in a RAM ring, which takes a few dozen cycles and may
+      be done from an interrupt. LogPoll() later sends each record as a COBS
+      frame with CRC (see CobsLib):
+         sequence number, format ID, arguments as 4 bytes little endian.
+      The host decoder LogDec.c rebuilds the text from the same format table.
+      The sequence number counts every LogWr() call, so a gap shows the host
+      how many records were dropped because the ring was full.
+
+All files for ADuCM360 provided by ADI, including this file, are
+provided  as is without warranty of any kind, either expressed or implied.
+The user assumes any and all risk from the use of this code.
+It is the responsibility of the person integrating this code into an application
+to ensure that the resulting application performs as required and is safe.
+
+**/
+
+#include "LogLib.h"
+#include <ADuCM360.h>
+#include "CobsLib.h"
+
+// Record ring, in 32-bit words. Each record is a header word holding
+// format ID (bits 0-7), argument count (bits 8-15) and sequence number
+// (bits 16-23), followed by its arguments.
+static unsigned long *pulLogBuf = 0;
+static unsigned int uiLogMask = 0;
+static volatile unsigned int uiLogHead = 0;	// Written by LogWr() only
+static volatile unsigned int uiLogTail = 0;	// Written by LogPoll() only
+static unsigned char ucLogSeq = 0;
+static unsigned int uiLogDrop = 0;
+
+// Frame being sent by LogPoll()
+static int (*pfLogWr)(const unsigned char *pucData, int iLen) = 0;
+static CobsEnc LogEnc;
+static unsigned char aucLogOut[LOG_REC_MAX+4];	// COBS code, record, CRC and delimiter
+static int iLogOutLen = 0;
+static int iLogOut = 0;
+
+static void LogEncWr(const unsigned char *pucData, int iLen);
+
+/**
+	@brief int LogCfg(unsigned long *pulBuf, int iSize, int (*pfWr)(const unsigned char *pucData, int iLen))
+			==========Sets up the record ring and the output.
+	@param pulBuf :{}	\n
+		Storage for the record ring.
+	@param iSize :{8,16,32,64,128,256,512,1024}	\n
+		Number of 32-bit words in pulBuf, a power of two. A record takes
+		1 word plus 1 per argument.
+	@param pfWr :{}	\n
+		Function that sends bytes without waiting and returns how many it
+		took, for example a wrapper around UrtBufWr().
+	@return 1 if successful or 0 if iSize is not a power of two or too small.
+**/
+
+int LogCfg(unsigned long *pulBuf, int iSize, int (*pfWr)(const unsigned char *pucData, int iLen))
+	{
+	if((iSize < LOG_ARGS+1) || (iSize & (iSize-1)))
+		return 0;
+	pulLogBuf = pulBuf;
+	uiLogMask = iSize-1;
+	uiLogHead = 0;
+	uiLogTail = 0;
+	ucLogSeq = 0;
+	uiLogDrop = 0;
+	pfLogWr = pfWr;
+	iLogOutLen = 0;
+	iLogOut = 0;
+	return 1;
+	}
+
+/**
+	@brief int LogWr(int iId, int iCnt, const unsigned long *pulArg)
+			==========Queues a record.
+	@param iId :{0-255}	\n
+		Format ID, from the enum built from the format table.
+	@param iCnt :{0-LOG_ARGS}	\n
+		Number of arguments.
+	@param pulArg :{}	\n
+		Arguments as raw 32-bit values. Pass floats through LogFlt().
+	@return 1 if queued or 0 if the ring is full and the record was dropped.
+	@note
+		- May be called from the main loop and from interrupts. Interrupts
+		are disabled for the few words copied.
+**/
+
+int LogWr(int iId, int iCnt, const unsigned long *pulArg)
+	{
+	unsigned long ulPri;
+	unsigned int uiHead;
+	int i1;
+
+	if(iCnt > LOG_ARGS)
+		iCnt = LOG_ARGS;
+	ulPri = __get_PRIMASK();
+	__disable_irq();
+	uiHead = uiLogHead;
+	if((uiLogMask+1) - (uiHead-uiLogTail) < (unsigned int)(iCnt+1))
+		{
+		ucLogSeq++;								// Host sees the gap
+		uiLogDrop++;
+		__set_PRIMASK(ulPri);
+		return 0;
+		}
+	pulLogBuf[uiHead++ & uiLogMask] = (iId&0xFF) | (iCnt<<8) | ((unsigned long)ucLogSeq<<16);
+	for(i1=0; i1<iCnt; i1++)
+		pulLogBuf[uiHead++ & uiLogMask] = pulArg[i1];
+	uiLogHead = uiHead;
+	ucLogSeq++;
+	__set_PRIMASK(ulPri);
+	return 1;
+	}
+
+/**
+	@brief int LogWr0(int iId)
+			==========Queues a record without arguments.
+	@param iId :{0-255}	\n
+		Format ID.
+	@return As LogWr().
+**/
+
+int LogWr0(int iId)
+	{
+	return LogWr(iId, 0, 0);
+	}
+
+/**
+	@brief int LogWr1(int iId, unsigned long ulArg0)
+			==========Queues a record with one argument.
+	@param iId :{0-255}	\n
+		Format ID.
+	@param ulArg0 :{}	\n
+		Argument, raw 32-bit value.
+	@return As LogWr().
+**/
+
+int LogWr1(int iId, unsigned long ulArg0)
+	{
+	return LogWr(iId, 1, &ulArg0);
+	}
+
+/**
+	@brief int LogWr2(int iId, unsigned long ulArg0, unsigned long ulArg1)
+			==========Queues a record with two arguments.
+	@param iId :{0-255}	\n
+		Format ID.
+	@param ulArg0 :{}	\n
+		First argument, raw 32-bit value.
+	@param ulArg1 :{}	\n
+		Second argument, raw 32-bit value.
+	@return As LogWr().
+**/
+
+int LogWr2(int iId, unsigned long ulArg0, unsigned long ulArg1)
+	{
+	unsigned long aulArg[2];
+
+	aulArg[0] = ulArg0;
+	aulArg[1] = ulArg1;
+	return LogWr(iId, 2, aulArg);
+	}
+
+/**
+	@brief unsigned long LogFlt(float fVal)
+			==========Returns the bits of a float so it can be logged unconverted.
+	@param fVal :{}	\n
+		Value to log.
+	@return IEEE 754 single precision bits of fVal.
+**/
+
+unsigned long LogFlt(float fVal)
+	{
+	union
+		{
+		float fVal;
+		unsigned long ulVal;
+		} Pun;
+
+	Pun.fVal = fVal;
+	return Pun.ulVal;
+	}
+
+/**
+	@brief static void LogEncWr(const unsigned char *pucData, int iLen)
+			==========Collects the encoded frame in aucLogOut.
+**/
+
+static void LogEncWr(const unsigned char *pucData, int iLen)
+	{
+	int i1;
+
+	for(i1=0; i1<iLen; i1++)
+		aucLogOut[iLogOutLen++] = pucData[i1];
+	}
+
+/**
+	@brief int LogPoll(void)
+			==========Sends queued records while the output takes them.
+	@return Number of bytes passed to the output.
+	@note
+		- Call from the main loop. Never waits: a frame the output cannot
+		take yet is finished by a later call.
+**/
+
+int LogPoll(void)
+	{
+	unsigned char aucRec[LOG_REC_MAX];
+	unsigned long ulWord;
+	unsigned int uiTail;
+	int iSent = 0;
+	int iCnt;
+	int iWr;
+	int i1;
+
+	if(pfLogWr == 0)
+		return 0;
+	for(;;)
+		{
+		if(iLogOut == iLogOutLen)				// Last frame sent, encode the next record
+			{
+			uiTail = uiLogTail;
+			if(uiTail == uiLogHead)
+				break;
+			ulWord = pulLogBuf[uiTail++ & uiLogMask];
+			iCnt = (ulWord>>8) & 0xFF;
+			aucRec[0] = ulWord>>16;
+			aucRec[1] = ulWord;
+			for(i1=0; i1<iCnt; i1++)
+				{
+				ulWord = pulLogBuf[uiTail++ & uiLogMask];
+				aucRec[2+4*i1] = ulWord;
+				aucRec[3+4*i1] = ulWord>>8;
+				aucRec[4+4*i1] = ulWord>>16;
+				aucRec[5+4*i1] = ulWord>>24;
+				}
+			uiLogTail = uiTail;					// Words copied, LogWr() may reuse them
+			iLogOutLen = 0;
+			iLogOut = 0;
+			CobsEncStart(&LogEnc, LogEncWr);
+			CobsEncPut(&LogEnc, aucRec, 2+4*iCnt);
+			CobsEncEnd(&LogEnc);
+			}
+		iWr = pfLogWr(&aucLogOut[iLogOut], iLogOutLen-iLogOut);
+		iLogOut += iWr;
+		iSent += iWr;
+		if(iLogOut < iLogOutLen)
+			break;								// Output full, try again next call
+		}
+	return iSent;
+	}
+
+/**
+	@brief int LogDrop(void)
+			==========Returns the number of records dropped because the ring was full.
+	@return Records dropped since LogCfg().
+**/
+
+int LogDrop(void)
+	{
+	return uiLogDrop;
+	}
+
+/**@}*/
@@ -4,9 +4,13 @@
    @{
    @file     PwrLib.c
    @brief    Functions for controling power modes
-   @version  V0.1
+   @version  V0.2
    @author   PAD CSE group
-   @date     September 2012 
+   @date     October 2026
+   @par Revision History:
+   - V0.1, September 2012: initial version.
+   - V0.2, October 2026: Added PwrWait(). PwrCfg() clears SLEEPDEEP for the
+                         lighter modes.
 
 
 All files for ADuCM360/361 provided by ADI, including this file, are
@@ -42,6 +46,8 @@ int PwrCfg(int iMode)
 	   {
 		    SCB->SCR = 0x04;		// sleepdeep mode - write to the Cortex-m3 System Control register bit2
 	   }
+	else
+		SCB->SCR = 0;				// Left set by an earlier deep sleep otherwise
 	pADI_PWRCTL->PWRKEY = 0x4859;	// key1
 	pADI_PWRCTL->PWRKEY = 0xF27B;	// key2 
 	pADI_PWRCTL->PWRMOD = iMode;
@@ -52,6 +58,38 @@ int PwrCfg(int iMode)
 		 
 	return 1;
 }
+/**
+	@brief int PwrWait(int iMode, volatile int *piFlag)
+			========== Sleeps until an interrupt handler sets a flag.
+	@param iMode :{PWRMOD_MOD_MCUHALT,PWRMOD_MOD_PERHALT,PWRMOD_MOD_SYSHALT,PWRMOD_MOD_TOTALHALT,PWRMOD_MOD_HIBERNATE }
+		- Mode passed to PwrCfg() for each sleep.
+	@param piFlag :{}
+		- Flag set to non 0 by the interrupt handlers that should wake the
+		caller, for example on an ADC step or a wake-up timer tick.
+	@note	The flag is checked with interrupts held off, so one set just
+		before the sleep is not missed: the pending interrupt ends the WFI
+		and runs as soon as they are let through. Interrupts that do not
+		set the flag are served and the core sleeps again. The caller
+		clears the flag.
+	@return Number of times the core woke up.
+**/
+int PwrWait(int iMode, volatile int *piFlag)
+{
+	unsigned long ulPri;
+	int iWakes = 0;
+
+	ulPri = __get_PRIMASK();
+	__disable_irq();
+	while (*piFlag == 0)
+	{
+		PwrCfg(iMode);
+		iWakes++;
+		__enable_irq();			// Serve the interrupt that woke the core
+		__disable_irq();
+	}
+	__set_PRIMASK(ulPri);
+	return iWakes;
+}
 /**
 	@brief int PwrRead(void)
 			========== reads MCU control register including WCENACK bit.
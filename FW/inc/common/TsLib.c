@@ -0,0 +1,322 @@
+/**
+ *****************************************************************************
+   @addtogroup ts
+   @{
+   @file     TsLib.c
+   @brief    Set of timestamp functions on a free running timer.
+   - Start the time base on timer 0 or 1 with TsCfg() and call TsInt() from
+     its interrupt handler.
+   - Read the time in ticks extended to 64 bits with TsNow(), convert to
+     microseconds with TsUs().
+   - Set up the event ring with TsLogCfg(). Record events with TsMark(), for
+     example from a DMA or external interrupt handler, and read them with
+     TsRd().
+   - Let the timer latch the time of one hardware event, for example an
+     external interrupt edge or an ADC conversion, with TsCap().
+
+   @version  V0.1
+   @author   ADI
+   @date     October 2026
+   @par Revision History:
+   - V0.1, October 2026: initial version.
+
+   @note
+      The timer counts up from 0 to 0xFFFF and wraps. TsInt() adds 0x10000
+      to a 64-bit count on each wrap, so the time never wraps in practice.
+      At PCLK/16 from a 2MHz PCLK a tick is 8us and the timer wraps about
+      twice a second. TsMark() stamps when it runs, so interrupt latency adds
+      to the stamp. A capture is latched by the timer itself on the event, so
+      it is exact to one tick whenever TsInt() reads it.
+
+All files for ADuCM360 provided by ADI, including this file, are
+provided  as is without warranty of any kind, either expressed or implied.
+The user assumes any and all risk from the use of this code.
+It is the responsibility of the person integrating this code into an application
+to ensure that the resulting application performs as required and is safe.
+
+**/
+
+#include "TsLib.h"
+#include "GptLib.h"
+
+#define TS_WRAP	0x10000						// Ticks per timer wrap
+
+static ADI_TIMER_TypeDef *pTsTmr = 0;		// Time base, 0 until TsCfg()
+static int iTsCon = 0;						// TxCON without the capture bits
+static unsigned long ulTsHz = 1;			// Ticks per second
+static volatile unsigned long long ullTsWrap = 0;	// Ticks of the completed wraps
+static int iTsCapSrc = TS_SRC_NONE;			// Source logged for captures
+static unsigned long ulTsCapCnt = 0;		// Captures so far, tag of the next one
+
+// Event ring
+static TsEvt *pTsLog = 0;
+static unsigned int uiTsMask = 0;
+static volatile unsigned int uiTsHead = 0;	// Written by TsLogWr() only
+static volatile unsigned int uiTsTail = 0;	// Written by TsRd() only
+static unsigned int uiTsDrop = 0;
+
+static void TsWait(void);
+static int TsLogWr(int iSrc, unsigned long ulTag, unsigned long long ullTick);
+
+/**
+	@brief int TsCfg(ADI_TIMER_TypeDef *pTMR, int iClkSrc, int iScale, unsigned long ulHz)
+			==========Starts the time base.
+	@param pTMR :{pADI_TM0,pADI_TM1}	\n
+		- pADI_TM0 for timer 0.
+		- pADI_TM1 for timer 1.
+	@param iClkSrc :{TCON_CLK_UCLK,TCON_CLK_PCLK,TCON_CLK_LFOSC,TCON_CLK_LFXTAL}	\n
+		Timer clock, as for GptCfg().
+	@param iScale :{TCON_PRE_DIV1,TCON_PRE_DIV16,TCON_PRE_DIV256,TCON_PRE_DIV32768}	\n
+		Timer prescaler, as for GptCfg().
+	@param ulHz :{1-}	\n
+		Resulting tick rate, used by TsUs() only.
+	@return 1 if successful or 0 if the timer is busy or a parameter is out
+		of range.
+	@note
+		- Enable the clock of the timer with ClkDis() and its interrupt in
+		the NVIC, and call TsInt() from its handler at least once per wrap.
+		- The time restarts from 0. Events in the ring are kept.
+**/
+
+int TsCfg(ADI_TIMER_TypeDef *pTMR, int iClkSrc, int iScale, unsigned long ulHz)
+	{
+	if(((pTMR != pADI_TM0) && (pTMR != pADI_TM1)) || (ulHz == 0))
+		return 0;
+	if(GptCfg(pTMR, iClkSrc, iScale, TCON_ENABLE_DIS) == 0)	// Stopped
+		return 0;
+	pTsTmr = pTMR;
+	TsWait();
+	GptLd(pTMR, 0);								// Counts up from 0
+	GptClrInt(pTMR, TSTA_TMOUT|TSTA_CAP);
+	TsWait();
+	iTsCon = iClkSrc|iScale|TCON_MOD_FREERUN|TCON_UP_EN|TCON_ENABLE_EN;
+	ulTsHz = ulHz;
+	ullTsWrap = 0;
+	iTsCapSrc = TS_SRC_NONE;
+	ulTsCapCnt = 0;
+	return GptCfg(pTMR, 0, 0, iTsCon);
+	}
+
+/**
+	@brief int TsCap(int iEvent, int iSrc)
+			==========Logs the time the timer latches on a hardware event.
+	@param iEvent :{T0CON_EVENT_EXT0-T0CON_EVENT_EXT7, T0CON_EVENT_ADC0, T0CON_EVENT_ADC1,
+		T0CON_EVENT_STEP, T1CON_EVENT_COM, T1CON_EVENT_DMADONE, T1CON_EVENT_EXT1-T1CON_EVENT_EXT3}	\n
+		Event of the timer passed to TsCfg(), see GptCapSrc().
+	@param iSrc :{TS_SRC_NONE, TS_SRC_ADC0, TS_SRC_ADC1, TS_SRC_EXT(0)-TS_SRC_EXT(7), TS_SRC_USER-}	\n
+		Source recorded with each capture, TS_SRC_NONE to stop capturing.
+	@return 1 if successful or 0 if TsCfg() was not called or the timer is
+		busy.
+	@note
+		- Captures are logged by TsInt() with the capture count as tag. Set
+		up the ring with TsLogCfg() first.
+		- The timer holds one capture until it is read, so events closer
+		together than the interrupt latency of TsInt() are missed. An
+		external interrupt must still be cleared with EiClr() in its own
+		handler.
+		- A capture is only placed right if TsInt() reads it within one wrap.
+**/
+
+int TsCap(int iEvent, int iSrc)
+	{
+	if(pTsTmr == 0)
+		return 0;
+	if(iSrc == TS_SRC_NONE)
+		{
+		iTsCapSrc = TS_SRC_NONE;
+		TsWait();
+		return GptCfg(pTsTmr, 0, 0, iTsCon);	// Capture off, count carries on
+		}
+	TsWait();
+	if(GptCapSrc(pTsTmr, iEvent) == 0)
+		return 0;
+	GptCapRd(pTsTmr);							// Free the capture register
+	GptClrInt(pTsTmr, TSTA_CAP);
+	iTsCapSrc = iSrc;
+	TsWait();
+	return GptCfg(pTsTmr, 0, 0, iTsCon|TCON_EVENTEN);
+	}
+
+/**
+	@brief int TsInt(void)
+			==========Services the time base interrupt.
+	@return Status bits TSTA_TMOUT and TSTA_CAP that were serviced.
+	@note Call from GP_Tmr0_Int_Handler() or GP_Tmr1_Int_Handler().
+**/
+
+int TsInt(void)
+	{
+	unsigned long ulPri;
+	unsigned long long ullNow;
+	int iSta = GptSta(pTsTmr);
+	int iCap;
+
+	if(iSta & TSTA_TMOUT)
+		{
+		ulPri = __get_PRIMASK();
+		__disable_irq();						// TsNow() sees either the flag or the count
+		GptClrInt(pTsTmr, TSTA_TMOUT);
+		while(GptSta(pTsTmr) & TSTA_TMOUT)		// Clear reaches the timer clock
+			;
+		ullTsWrap += TS_WRAP;
+		__set_PRIMASK(ulPri);
+		}
+	if(iSta & TSTA_CAP)
+		{
+		iCap = GptCapRd(pTsTmr) & (TS_WRAP-1);	// Allows the next capture
+		GptClrInt(pTsTmr, TSTA_CAP);
+		ullNow = TsNow();
+		if(iTsCapSrc != TS_SRC_NONE)			// Back from now by the age of the capture
+			TsLogWr(iTsCapSrc, ulTsCapCnt++, ullNow - ((unsigned int)(ullNow - iCap) & (TS_WRAP-1)));
+		}
+	return iSta & (TSTA_TMOUT|TSTA_CAP);
+	}
+
+/**
+	@brief unsigned long long TsNow(void)
+			==========Returns the time.
+	@return Ticks since TsCfg().
+	@note May be called from the main loop and from interrupts, including
+		ones that delay TsInt().
+**/
+
+unsigned long long TsNow(void)
+	{
+	unsigned long ulPri;
+	unsigned long long ullNow;
+	unsigned int uiVal;
+
+	if(pTsTmr == 0)
+		return 0;
+	ulPri = __get_PRIMASK();
+	__disable_irq();
+	uiVal = GptVal(pTsTmr) & (TS_WRAP-1);
+	ullNow = ullTsWrap;
+	if(GptSta(pTsTmr) & TSTA_TMOUT)				// Wrapped and TsInt() not run yet
+		{
+		uiVal = GptVal(pTsTmr) & (TS_WRAP-1);	// Read again, surely after the wrap
+		ullNow += TS_WRAP;
+		}
+	__set_PRIMASK(ulPri);
+	return ullNow + uiVal;
+	}
+
+/**
+	@brief unsigned long long TsUs(unsigned long long ullTick)
+			==========Converts ticks to microseconds.
+	@param ullTick :{}	\n
+		Time or time difference in ticks.
+	@return Microseconds, rounded down.
+	@note Uses the ulHz passed to TsCfg(). Costs two 64-bit divides.
+**/
+
+unsigned long long TsUs(unsigned long long ullTick)
+	{
+	return (ullTick / ulTsHz) * 1000000
+		+ ((ullTick % ulTsHz) * 1000000) / ulTsHz;
+	}
+
+/**
+	@brief int TsLogCfg(TsEvt *pLog, int iSize)
+			==========Sets up the event ring.
+	@param pLog :{}	\n
+		Storage for iSize events.
+	@param iSize :{2,4,8,16,32,64,128,256}	\n
+		Number of events in pLog, a power of two.
+	@return 1 if successful or 0 if iSize is not a power of two.
+**/
+
+int TsLogCfg(TsEvt *pLog, int iSize)
+	{
+	if((iSize < 2) || (iSize & (iSize-1)))
+		return 0;
+	pTsLog = 0;									// TsLogWr() drops events meanwhile
+	uiTsMask = iSize-1;
+	uiTsHead = 0;
+	uiTsTail = 0;
+	uiTsDrop = 0;
+	pTsLog = pLog;
+	return 1;
+	}
+
+/**
+	@brief int TsMark(int iSrc, unsigned long ulTag)
+			==========Records an event at the current time.
+	@param iSrc :{TS_SRC_ADC0, TS_SRC_ADC1, TS_SRC_SINC2, TS_SRC_URT_RX, TS_SRC_URT_TX,
+		TS_SRC_EXT(0)-TS_SRC_EXT(7), TS_SRC_USER-}	\n
+		Source of the event.
+	@param ulTag :{}	\n
+		Value kept with the event, for example a sample or frame count.
+	@return 1 if recorded or 0 if the ring is full and the event was dropped.
+	@note May be called from the main loop and from interrupts.
+**/
+
+int TsMark(int iSrc, unsigned long ulTag)
+	{
+	return TsLogWr(iSrc, ulTag, TsNow());
+	}
+
+/**
+	@brief int TsRd(TsEvt *pEvt)
+			==========Reads the oldest event.
+	@param pEvt :{}	\n
+		Event read.
+	@return 1 if an event was read or 0 if the ring is empty.
+	@note Call from the main loop or one interrupt only.
+**/
+
+int TsRd(TsEvt *pEvt)
+	{
+	unsigned int uiTail = uiTsTail;
+
+	if((pTsLog == 0) || (uiTail == uiTsHead))
+		return 0;
+	*pEvt = pTsLog[uiTail & uiTsMask];
+	uiTsTail = uiTail + 1;
+	return 1;
+	}
+
+/**
+	@brief int TsDrop(void)
+			==========Returns the number of events dropped.
+	@return Events dropped because the ring was full, since TsLogCfg().
+**/
+
+int TsDrop(void)
+	{
+	return (int)uiTsDrop;
+	}
+
+// Waits for a write to TxCON to reach the timer clock domain
+static void TsWait(void)
+	{
+	while(GptSta(pTsTmr) & TSTA_CON)
+		;
+	}
+
+// Adds an event to the ring, 0 if it is full
+static int TsLogWr(int iSrc, unsigned long ulTag, unsigned long long ullTick)
+	{
+	unsigned long ulPri;
+	unsigned int uiHead;
+	TsEvt *pEvt;
+
+	ulPri = __get_PRIMASK();
+	__disable_irq();
+	uiHead = uiTsHead;
+	if((pTsLog == 0) || ((uiHead - uiTsTail) > uiTsMask))
+		{
+		uiTsDrop++;
+		__set_PRIMASK(ulPri);
+		return 0;
+		}
+	pEvt = &pTsLog[uiHead & uiTsMask];
+	pEvt->ullTick = ullTick;
+	pEvt->ulTag = ulTag;
+	pEvt->iSrc = iSrc;
+	uiTsHead = uiHead + 1;
+	__set_PRIMASK(ulPri);
+	return 1;
+	}
+
+/**@}*/
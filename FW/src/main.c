@@ -12,13 +12,15 @@
 #define TRUE		1
 #define FALSE		0
 
-volatile uint8_t ucTxBufferEmpty  = 0; // Used to indicate that the UART Tx buffer is empty
-volatile uint8_t ucRxBufferFull  = 0; // Used to indicate that the UART Rx buffer is full
+#define UART_TX_RING_SIZE	256	// Must be a power of two
+#define UART_RX_RING_SIZE	256	// Must be a power of two
 
-uint8_t szTemp[128] = "";
+uint8_t ucTxRingBuf[UART_TX_RING_SIZE];	// Storage for the UART transmit ring
+uint8_t ucRxRingBuf[UART_RX_RING_SIZE];	// Storage for the UART receive ring
+RingBuf UartTxRing;						// Drained by the THRE interrupt
+RingBuf UartRxRing;						// Filled by the receive interrupt
 
-volatile uint8_t ucCOMIID0 = 0;
-volatile uint8_t ucComRx = 0;
+uint8_t szTemp[128] = "";
 
 void WatchDogInit(void){
 	//---------- Disable Watchdog timer resets ----------
@@ -55,7 +57,9 @@ void UARTInit(void){
    pADI_GP0->GPCON |= 0x9000;                   // Configure P0.6/P0.7 for UART
    UrtCfg(pADI_UART,B1200,COMLCR_WLS_8BITS,COMLCR_PEN_EN);  // setup baud rate for 9600, 8-bits
    UrtMod(pADI_UART,COMMCR_DTR,0);              // Setup modem bits
-   UrtIntCfg(pADI_UART,COMIEN_ERBFI|COMIEN_ETBEI);  // Setup UART IRQ sources
+   RingInit(&UartTxRing, ucTxRingBuf, UART_TX_RING_SIZE);
+   RingInit(&UartRxRing, ucRxRingBuf, UART_RX_RING_SIZE);
+   UrtBufCfg(pADI_UART,&UartTxRing,&UartRxRing);  // Setup UART IRQ sources and rings
 }
 
 void Chip_Initialize(){
@@ -68,32 +72,30 @@ void Chip_Initialize(){
 }
 
 void SendChar(uint8_t ch){
-	ucTxBufferEmpty = 0;
-    UrtTx(pADI_UART, ch);
-    while (ucTxBufferEmpty == 0) {};
+    while (UrtBufWr(pADI_UART, &ch, 1) == 0) {};	// Only waits while the Tx ring is full
 }
 
 void SendMsg(uint8_t *str){
-	uint16_t len =0 , i;
+	uint16_t len =0 , i = 0;
 
 	len = strlen((char*)str);
-	for(i=0; i<len; i++){
-		SendChar(str[i]);
+	while(i < len){
+		i += UrtBufWr(pADI_UART, &str[i], len - i);	// Returns once everything is queued
 	}
 }
 
 uint8_t* ReadMsg(void){
 	uint8_t cnt = 0;
+	uint8_t ch;
 	static uint8_t str[128] = "";
-	while(TRUE){
-		if(ucRxBufferFull){
-			//ucComRx = UrtRx(pADI_UART);
-			str[cnt++] = ucComRx;
-			ucRxBufferFull = FALSE;
-			if(ucComRx == '\0' || ucComRx == '\r' || ucComRx == '\n')
+	while(cnt < sizeof(str) - 1){
+		if(UrtBufRd(pADI_UART, &ch, 1)){
+			str[cnt++] = ch;
+			if(ch == '\0' || ch == '\r' || ch == '\n')
 				break;
 		}
 	}
+	str[cnt] = '\0';
 	return str;
 }
 
@@ -103,23 +105,14 @@ int main(){
 
    	SendMsg("Input Text\r\n");
    	while(TRUE){
-		if(ucRxBufferFull){
-			//ReadMsg();
+		if(UrtBufRxCnt(pADI_UART)){
 			SendMsg(ReadMsg());
 			SendMsg("\r\n");
 			SendMsg("Input Text\r\n");
-			ucRxBufferFull = FALSE;
 		}
    	}
 }
 void UART_Int_Handler()
 {
-	ucCOMIID0 = UrtIntSta(pADI_UART);   	// Read UART Interrupt ID register
-   	if ((ucCOMIID0 & 0x7) == 0x2){       	// Transmit buffer empty
-   		ucTxBufferEmpty = TRUE;
-   	}
-   	if ((ucCOMIID0 & 0x7) == 0x4){       	// Receive byte
-   		ucComRx = UrtRx(pADI_UART);
-   		ucRxBufferFull = TRUE;
-   	}
+	UrtBufInt(pADI_UART);					// Move bytes between the UART and the rings
 }
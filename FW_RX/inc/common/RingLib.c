@@ -0,0 +1,193 @@
+/**
+ *****************************************************************************
+   @addtogroup ring
+   @{
+   @file     RingLib.c
+   @brief    Set of single-producer/single-consumer byte ring buffer functions.
+   - Initialise a ring over caller supplied storage with RingInit().
+   - Producer side: RingPut(), RingWr(), RingFree().
+   - Consumer side: RingGet(), RingRd(), RingCnt(), RingFlush().
+
+   @version  V0.1
+   @author   ADI
+   @date     October 2026
+   @par Revision History:
+   - V0.1, October 2026: initial version.
+
+   @note
+      The indices are free running 32-bit counters, so the fill level is
+      always uiHead-uiTail and no slot is wasted. Each index is written by one
+      side only and word writes are atomic on the Cortex-M3, which lets an ISR
+      be the producer (UART receive) or the consumer (UART transmit) while the
+      main loop works the other end without disabling interrupts.
+
+All files for ADuCM360 provided by ADI, including this file, are
+provided  as is without warranty of any kind, either expressed or implied.
+The user assumes any and all risk from the use of this code.
+It is the responsibility of the person integrating this code into an application
+to ensure that the resulting application performs as required and is safe.
+
+**/
+
+#include "RingLib.h"
+
+/**
+	@brief int RingInit(RingBuf *pRing, unsigned char *pucBuf, int iSize)
+			==========Initialises an empty ring buffer.
+	@param pRing :{}	\n
+		Ring control block to initialise.
+	@param pucBuf :{}	\n
+		Storage for the ring, iSize bytes.
+	@param iSize :{2,4,8,16,32,64,128,256,512,1024,2048,4096}	\n
+		Size of pucBuf in bytes. Must be a power of two.
+	@return 1 if successful or 0 if iSize is not a power of two.
+**/
+
+int RingInit(RingBuf *pRing, unsigned char *pucBuf, int iSize)
+	{
+	if((iSize < 2) || (iSize & (iSize-1)))
+		return 0;
+	pRing->pucBuf = pucBuf;
+	pRing->uiMask = iSize-1;
+	pRing->uiHead = 0;
+	pRing->uiTail = 0;
+	return 1;
+	}
+
+/**
+	@brief int RingPut(RingBuf *pRing, int iByte)
+			==========Producer: adds one byte to the ring.
+	@param pRing :{}	\n
+		Ring to write to.
+	@param iByte :{0-255}	\n
+		Byte to add.
+	@return 1 if successful or 0 if the ring is full.
+**/
+
+int RingPut(RingBuf *pRing, int iByte)
+	{
+	unsigned int uiHead = pRing->uiHead;
+
+	if((uiHead - pRing->uiTail) > pRing->uiMask)
+		return 0;
+	pRing->pucBuf[uiHead & pRing->uiMask] = iByte;
+	pRing->uiHead = uiHead+1;				// Publish only after the data is stored
+	return 1;
+	}
+
+/**
+	@brief int RingGet(RingBuf *pRing)
+			==========Consumer: removes one byte from the ring.
+	@param pRing :{}	\n
+		Ring to read from.
+	@return The oldest byte (0-255) or -1 if the ring is empty.
+**/
+
+int RingGet(RingBuf *pRing)
+	{
+	unsigned int uiTail = pRing->uiTail;
+	int iByte;
+
+	if(uiTail == pRing->uiHead)
+		return -1;
+	iByte = pRing->pucBuf[uiTail & pRing->uiMask];
+	pRing->uiTail = uiTail+1;				// Release the slot only after the data is read
+	return iByte;
+	}
+
+/**
+	@brief int RingWr(RingBuf *pRing, const unsigned char *pucData, int iLen)
+			==========Producer: adds up to iLen bytes to the ring.
+	@param pRing :{}	\n
+		Ring to write to.
+	@param pucData :{}	\n
+		Bytes to add.
+	@param iLen :{0-}	\n
+		Number of bytes available in pucData.
+	@return Number of bytes added. Less than iLen if the ring filled up.
+**/
+
+int RingWr(RingBuf *pRing, const unsigned char *pucData, int iLen)
+	{
+	unsigned int uiHead = pRing->uiHead;
+	int iFree = pRing->uiMask + 1 - (uiHead - pRing->uiTail);
+	int i1;
+
+	if(iLen > iFree)
+		iLen = iFree;
+	for(i1=0; i1<iLen; i1++)
+		pRing->pucBuf[(uiHead+i1) & pRing->uiMask] = pucData[i1];
+	pRing->uiHead = uiHead+iLen;
+	return iLen;
+	}
+
+/**
+	@brief int RingRd(RingBuf *pRing, unsigned char *pucData, int iLen)
+			==========Consumer: removes up to iLen bytes from the ring.
+	@param pRing :{}	\n
+		Ring to read from.
+	@param pucData :{}	\n
+		Destination for the bytes.
+	@param iLen :{0-}	\n
+		Space available in pucData.
+	@return Number of bytes removed. 0 if the ring was empty.
+**/
+
+int RingRd(RingBuf *pRing, unsigned char *pucData, int iLen)
+	{
+	unsigned int uiTail = pRing->uiTail;
+	int iCnt = pRing->uiHead - uiTail;
+	int i1;
+
+	if(iLen > iCnt)
+		iLen = iCnt;
+	for(i1=0; i1<iLen; i1++)
+		pucData[i1] = pRing->pucBuf[(uiTail+i1) & pRing->uiMask];
+	pRing->uiTail = uiTail+iLen;
+	return iLen;
+	}
+
+/**
+	@brief int RingCnt(RingBuf *pRing)
+			==========Returns the number of bytes waiting in the ring.
+	@param pRing :{}	\n
+		Ring to check.
+	@return Number of bytes that RingGet() can return.
+**/
+
+int RingCnt(RingBuf *pRing)
+	{
+	return pRing->uiHead - pRing->uiTail;
+	}
+
+/**
+	@brief int RingFree(RingBuf *pRing)
+			==========Returns the free space in the ring.
+	@param pRing :{}	\n
+		Ring to check.
+	@return Number of bytes that RingPut() can accept.
+**/
+
+int RingFree(RingBuf *pRing)
+	{
+	return pRing->uiMask + 1 - (pRing->uiHead - pRing->uiTail);
+	}
+
+/**
+	@brief int RingFlush(RingBuf *pRing)
+			==========Consumer: discards all bytes waiting in the ring.
+	@param pRing :{}	\n
+		Ring to empty.
+	@return Number of bytes discarded.
+**/
+
+int RingFlush(RingBuf *pRing)
+	{
+	unsigned int uiHead = pRing->uiHead;
+	int iCnt = uiHead - pRing->uiTail;
+
+	pRing->uiTail = uiHead;
+	return iCnt;
+	}
+
+/**@}*/
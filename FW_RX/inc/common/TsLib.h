@@ -0,0 +1,63 @@
+/**
+ *****************************************************************************
+   @file     TsLib.h
+   @brief    Set of timestamp functions on a free running timer.
+   - Start the time base on timer 0 or 1 with TsCfg() and call TsInt() from
+     its interrupt handler.
+   - Read the time in ticks extended to 64 bits with TsNow(), convert to
+     microseconds with TsUs().
+   - Set up the event ring with TsLogCfg(). Record events with TsMark(), for
+     example from a DMA or external interrupt handler, and read them with
+     TsRd().
+   - Let the timer latch the time of one hardware event, for example an
+     external interrupt edge or an ADC conversion, with TsCap().
+
+   @version  V0.1
+   @author   ADI
+   @date     October 2026
+   @par Revision History:
+   - V0.1, October 2026: initial version.
+
+
+
+All files for ADuCM360 provided by ADI, including this file, are
+provided  as is without warranty of any kind, either expressed or implied.
+The user assumes any and all risk from the use of this code.
+It is the responsibility of the person integrating this code into an application
+to ensure that the resulting application performs as required and is safe.
+
+**/
+#ifndef TSLIB_H
+#define TSLIB_H
+
+#include <ADuCM360.h>
+
+// Event sources for TsMark() and TsCap()
+#define TS_SRC_NONE		0
+#define TS_SRC_ADC0		1		// ADC0 DMA half done or conversion
+#define TS_SRC_ADC1		2		// ADC1 DMA half done or conversion
+#define TS_SRC_SINC2	3		// SINC2 DMA half done
+#define TS_SRC_URT_RX	4		// Start of a received UART frame
+#define TS_SRC_URT_TX	5		// Start of a transmitted UART frame
+#define TS_SRC_EXT(n)	(8+(n))	// External interrupt n, 0 to 7
+#define TS_SRC_USER		16		// First source free for the application
+
+// Event recorded by TsMark() or a TsCap() capture
+typedef struct
+{
+   unsigned long long ullTick;   // Timer ticks since TsCfg()
+   unsigned long ulTag;          // Caller value, capture count for TsCap()
+   int iSrc;                     // TS_SRC_ value
+} TsEvt;
+
+extern int TsCfg(ADI_TIMER_TypeDef *pTMR, int iClkSrc, int iScale, unsigned long ulHz);
+extern int TsCap(int iEvent, int iSrc);
+extern int TsInt(void);
+extern unsigned long long TsNow(void);
+extern unsigned long long TsUs(unsigned long long ullTick);
+extern int TsLogCfg(TsEvt *pLog, int iSize);
+extern int TsMark(int iSrc, unsigned long ulTag);
+extern int TsRd(TsEvt *pEvt);
+extern int TsDrop(void);
+
+#endif
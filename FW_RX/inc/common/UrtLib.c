@@ -5,19 +5,61 @@
    @file     UrtLib.c
    @brief    Set of UART peripheral functions.
    - Configure the UART pins by setting the mux options in GPCON
-   - Configure UART with UrtCfg().
+   - Configure UART with UrtCfg(). Check the baud rate achieved with UrtBaudRd().
+   - For a fixed clock setup UrtCfgDiv() takes dividers from URT_COMDIV() and
+     URT_COMFBR() worked out at compile time.
    - Set modem control with UrtMod() if desired.
    - Check space in Tx buffer with UrtLinSta().
    - Output character with UrtTx().
    - Read characters with UrtRx().
+   - For interrupt driven buffered operation attach rings with UrtBufCfg(),
+     queue with UrtBufWr(), read with UrtBufRd() and call UrtBufInt() from
+     UART_Int_Handler(). UrtBufRxFn() hands received bytes to a function
+     instead, for example a COBS decoder.
+   - For RTS/CTS hardware flow control call UrtFlowCfg() and UrtBufInt() from
+     UART_Int_Handler().
+   - Read line error counts with UrtErrRd(). UrtBufRdErr() and
+     UrtRxDmaRdErr() flag each damaged byte read.
+   - For DMA transmission start a block with UrtTxDma() and call UrtTxDmaInt()
+     from DMA_UART_TX_Int_Handler().
+   - For continuous DMA reception start with UrtRxDmaCfg(), read with
+     UrtRxDmaRd() and call UrtRxDmaInt() from DMA_UART_RX_Int_Handler().
+   - To hand short frames over after a gap on the line start a timer with
+     UrtRxIdleCfg() and call UrtRxIdleInt() from GP_Tmr0_Int_Handler() or
+     GP_Tmr1_Int_Handler(). UrtRxStartFn() adds a function raised when a
+     frame starts, for example to timestamp it. The timer stops while the
+     line is idle, UrtBufInt() restarts it from UART_Int_Handler().
    
-   @version  V0.3
+   @version  V0.16
    @author   ADI
-   @date     April 2013
+   @date     October 2026
    @par Revision History:
    - V0.1, March 2012: initial version. 
    - V0.2, October 2012: Fixed Baud rate generation function
    - V0.3, April 2013: Fixed doxygen comments
+   - V0.4, October 2026: Added interrupt driven ring buffered transfers.
+   - V0.5, October 2026: Added DMA transmit with completion callback.
+   - V0.6, October 2026: Added continuous ping-pong DMA receive.
+   - V0.7, October 2026: Added idle line detection for DMA receive.
+   - V0.8, October 2026: UrtCfg() searches COMDIV, DIVM and DIVN for the
+     lowest baud rate error at the actual UART clock. Added UrtBaudCalc(),
+     UrtBaudRd() and UrtCfgDiv().
+   - V0.9, October 2026: Added UrtBufRxFn() to decode received bytes in the
+     interrupt.
+   - V0.10, October 2026: Added RTS/CTS flow control with UrtFlowCfg().
+   - V0.11, October 2026: UrtBufInt() counts and flags line errors, added
+     UrtErrRd().
+   - V0.12, October 2026: Added UrtRxStartFn() for the start of idle line
+     frames.
+   - V0.13, October 2026: UrtBufWr() starts the transmitter with interrupts
+     masked, the CTS edge could start it at the same time.
+   - V0.14, October 2026: Keeps the positions of up to URT_ERR_MAX damaged
+     bytes, flagged by UrtBufRdErr() and UrtRxDmaRdErr().
+   - V0.15, October 2026: The UART DMA channels are enabled with DmaSet(),
+     so DmaErrInt() re-arms them after a bus error. DmaLib.c is needed.
+   - V0.16, October 2026: The idle line timer stops once a frame is handed
+     over and the first byte of the next one restarts it, no interrupts
+     while the line is idle.
 
      
 
@@ -32,16 +74,64 @@ to ensure that the resulting application performs as required and is safe.
 #include "UrtLib.h"
 #include <ADuCM360.h>
 #include "DmaLib.h"
+#include "GptLib.h"
+
+static RingBuf *pUrtTxRing = 0;			// Drained by UrtBufInt() on THRE
+static RingBuf *pUrtRxRing = 0;			// Filled by UrtBufInt() on receive
+static volatile int iUrtTxIdle = 1;		// 1 when no THRE interrupt is outstanding
+static void (*pfUrtRxByte)(int iByte) = 0;	// Takes received bytes instead of pUrtRxRing
+static int iUrtFlow = 0;					// 1 when RTS/CTS flow control is on
+static int iUrtRxHigh = 0;					// Receive ring level that deasserts RTS
+static int iUrtRxLow = 0;					// Receive ring level that asserts RTS again
+static volatile int iUrtRtsOff = 0;			// 1 while RTS is deasserted by UrtBufInt()
+static UrtErr UrtErrCnt;					// Line error counts, see UrtErrRd()
+static int iUrtRxErr = 0;					// COMLSR error bits of the byte waiting in COMRX
+static unsigned int auiUrtErrPos[URT_ERR_MAX];	// Receive indices of bytes with errors, not yet read
+static unsigned char aucUrtErrBits[URT_ERR_MAX];	// Their COMLSR error bits
+static volatile unsigned int uiUrtErrHead = 0;	// Written by UrtBufInt()
+static volatile unsigned int uiUrtErrTail = 0;	// Read by UrtBufRdErr() and UrtRxDmaRdErr()
+
+static const unsigned char *pucUrtDmaTx = 0;	// First byte not yet handed to the DMA
+static volatile int iUrtDmaTxLeft = 0;		// Bytes not yet handed to the DMA
+static volatile int iUrtDmaTxBusy = 0;		// 1 from UrtTxDma() until the callback
+static void (*pfUrtDmaTxDone)(void) = 0;	// Raised by UrtTxDmaInt() at the end
+
+static volatile unsigned char *pucUrtDmaRx = 0;	// Circular receive buffer
+static unsigned int uiUrtDmaRxHalf = 0;		// Bytes per descriptor, half the buffer
+static volatile unsigned int uiUrtDmaRxDone = 0;	// Free running count of completed halves
+static volatile int iUrtDmaRxAlt = 0;		// Descriptor being filled, 0 primary, 1 alternate
+static unsigned int uiUrtDmaRxTail = 0;		// Free running read index
+
+static ADI_TIMER_TypeDef *pUrtIdleTmr = 0;	// Timer ticking once per character time
+static volatile int iUrtIdleStop = 0;		// 1 while the timer waits for the next byte
+static int iUrtIdleChars = 0;				// Silent character times that end a frame
+static volatile int iUrtIdleCnt = 0;		// Silent ticks seen so far
+static unsigned int uiUrtIdleLast = 0;		// DMA write index at the previous tick
+static unsigned int uiUrtIdleMark = 0;		// DMA write index at the end of the last frame
+static void (*pfUrtIdleFrame)(int iLen) = 0;	// Raised by UrtRxIdleInt() with the frame length
+static void (*pfUrtIdleStart)(void) = 0;	// Raised when a frame starts
+
+// Largest block one basic DMA cycle can move (n_minus_1 is 10 bits)
+#define URT_DMA_MAX	1024
+
+// COMLSR bits that mark a damaged or lost byte
+#define URT_LSR_ERR	(COMLSR_OE|COMLSR_PE|COMLSR_FE|COMLSR_BI)
+
+static unsigned int UrtRxDmaHead(void);
+static void UrtErrAdd(unsigned int uiPos, int iBits);
+static void UrtErrFlg(unsigned int uiFrom, unsigned char *pucErr, int iLen);
+static void UrtIdleStop(ADI_UART_TypeDef *pPort);
+static void UrtIdleRun(ADI_UART_TypeDef *pPort);
 
 /**
 	@brief int UrtCfg(ADI_UART_TypeDef *pPort, int iBaud, int iBits, int iFormat)
 			==========Configure the UART.
 	@param pPort :{pADI_UART,}	\n
 		Set to pADI_UART. Only one channel available.
-	@param iBaud :{B1200,B2200,B2400,B4800,B9600,B19200,B38400,B57600,B115200,B230400,B430800}	\n
+	@param iBaud :{B1200,B2200,B2400,B4800,B9600,B19200,B38400,B57600,B115200,B230400,B460800}	\n
 		Set iBaud to the baudrate required:
 		Values usually: 1200, 2200 (for HART), 2400, 4800, 9600, 
-		        19200, 38400, 57600, 115200, 230400, 430800, or type in baud-rate directly 
+		        19200, 38400, 57600, 115200, 230400, 460800, or type in baud-rate directly 
 	@param iBits :{COMLCR_WLS_5BITS,COMLCR_WLS_6BITS,COMLCR_WLS_7BITS,COMLCR_WLS_8BITS}	\n
 			- 0 = COMLCR_WLS_5BITS for data length 5bits.
 			- 1 = COMLCR_WLS_6BITS for data length 6bits.
@@ -57,64 +147,152 @@ to ensure that the resulting application performs as required and is safe.
 	@return Value of COMLSR: See UrtLinSta() function for bit details.
 	@note
 		- Powers up UART if not powered up.
-		- Standard baudrates are accurate to better than 0.1% plus clock error.\n
-		- Non standard baudrates are accurate to better than 1% plus clock error.
+		- COMDIV, DIVM and DIVN are chosen by UrtBaudCalc() for the lowest
+		error at the UART clock set by CLKCON1 and CLKSYSDIV. Read back the
+		rate achieved with UrtBaudRd().
+		- Rates above UART clock/32 cannot be reached, the fastest rate
+		possible is set instead. 460800 baud needs the full 16MHz UART clock.
 **/
 
 int UrtCfg(ADI_UART_TypeDef *pPort, int iBaud, int iBits, int iFormat)
 	{
-	int i1;
 	int iDiv;
-			
-	iDiv = (pADI_CLKCTL->CLKCON1& 0x0E00);// Read UART clock as set by CLKCON1
-	iDiv = iDiv>>9;
-	
-	switch (iDiv)
-		{
-			case 0:
-				iDiv = 1;
-			  break;
-			
-			case 1:
-				iDiv = 2;
-			  break;
-			
-			case 2:
-				iDiv = 4;
-			  break;
-		
-	    	case 3:
-				iDiv = 8;
-			  break;
-		
-			case 4:
-				iDiv = 16;
-			  break;
-			
-			case 5:
-				iDiv = 32;
-			  break;
-			
-			case 6:
-				iDiv = 64;
-			  break;	
-			
-			case 7:
-				iDiv = 128;
-			  break;
-			default:	 
-		     break;
-			}
-			if ((pADI_CLKCTL->CLKSYSDIV& 0x1)==1)
-				 iDiv = iDiv*2;
-	i1 = (16000000/(32*iDiv))/iBaud;	  // UART baud rate clock source is UARTCLK divided by 32
-	pPort->COMDIV = i1;
-	pPort->COMFBR = 0x8800|(((((2048/(32*iDiv))*16000000)/i1)/iBaud)-2048);
+	int iFbr;
+
+	UrtBaudCalc(UrtClk(), iBaud, &iDiv, &iFbr);
+	return UrtCfgDiv(pPort, iDiv, iFbr, iBits, iFormat);
+	}
+
+/**
+	@brief int UrtCfgDiv(ADI_UART_TypeDef *pPort, int iDiv, int iFbr, int iBits, int iFormat)
+			==========Configure the UART with precalculated baud rate dividers.
+	@param pPort :{pADI_UART,}	\n
+		Set to pADI_UART. Only one channel available.
+	@param iDiv :{1-65535}	\n
+		Value for COMDIV, usually URT_COMDIV(clock,baud).
+	@param iFbr :{0x8800-0x9FFF}	\n
+		Value for COMFBR, usually URT_COMFBR(clock,baud).
+	@param iBits :{COMLCR_WLS_5BITS,COMLCR_WLS_6BITS,COMLCR_WLS_7BITS,COMLCR_WLS_8BITS}	\n
+		Data length as for UrtCfg().
+	@param iFormat :{0|COMLCR_STOP_EN|COMLCR_PEN_EN|COMLCR_EPS_EN|COMLCR_SP_EN}	\n
+		Data format as for UrtCfg().
+	@return Value of COMLSR: See UrtLinSta() function for bit details.
+	@note
+		- Skips the divider search in UrtCfg() when the clock setup is fixed.
+**/
+
+int UrtCfgDiv(ADI_UART_TypeDef *pPort, int iDiv, int iFbr, int iBits, int iFormat)
+	{
+	pPort->COMDIV = iDiv;
+	pPort->COMFBR = iFbr;
 	pPort->COMIEN = 0;
 	pPort->COMLCR = (iFormat&0x3c)|(iBits&3);	
 	return	pPort->COMLSR;
 	}
 
+/**
+	@brief int UrtClk(void)
+			==========Returns the UART clock in Hz as set by CLKCON1 and CLKSYSDIV.
+	@return UART clock, 16MHz divided by 1 to 256.
+**/
+
+int UrtClk(void)
+	{
+	int iClk = 16000000 >> ((pADI_CLKCTL->CLKCON1 & 0x0E00) >> 9);
+
+	if(pADI_CLKCTL->CLKSYSDIV & 0x1)
+		iClk >>= 1;
+	return iClk;
+	}
+
+/**
+	@brief int UrtBaudCalc(int iClk, int iBaud, int *piDiv, int *piFbr)
+			==========Finds the COMDIV and COMFBR values closest to a baud rate.
+	@param iClk :{}	\n
+		UART clock in Hz, as returned by UrtClk().
+	@param iBaud :{B1200,B2200,B2400,B4800,B9600,B19200,B38400,B57600,B115200,B230400,B460800}	\n
+		Baud rate required.
+	@param piDiv :{}	\n
+		Receives the value for COMDIV.
+	@param piFbr :{}	\n
+		Receives the value for COMFBR, fractional divider enabled.
+	@return Baud rate achieved, rounded to the nearest Hz.
+	@note
+		- Baud = iClk/(32*COMDIV*(DIVM+DIVN/2048)). With R = DIVM*2048+DIVN
+		this is iClk*64/(COMDIV*R), R from 2048 to 8191. Every COMDIV that
+		allows a valid R is tried with its nearest R.
+		- DIVM and DIVN are adjacent in COMFBR, so COMFBR is 0x8000|R.
+**/
+
+int UrtBaudCalc(int iClk, int iBaud, int *piDiv, int *piFbr)
+	{
+	unsigned long long ullNum = (unsigned long long)iClk*64;	// Baud*COMDIV*R
+	unsigned long long ullErr, ullBestErr, ullDen, ullBestDen = 1;
+	unsigned int uiDiv, uiRem, uiBestDiv = 1, uiBestRem = 2048;
+	unsigned int uiMax = ullNum/((unsigned long long)iBaud*2048);	// Largest COMDIV with R>=2048
+
+	if(uiMax > 65535)
+		uiMax = 65535;
+	uiDiv = (ullNum/iBaud+8190)/8191;						// Smallest COMDIV with R<=8191
+	if(uiDiv == 0)
+		uiDiv = 1;
+	ullBestErr = ullNum;									// Worse than any candidate
+	for(; uiDiv<=uiMax; uiDiv++)
+		{
+		uiRem = (ullNum + (unsigned long long)iBaud*uiDiv/2)/((unsigned long long)iBaud*uiDiv);
+		if(uiRem > 8191)
+			uiRem = 8191;
+		if(uiRem < 2048)
+			uiRem = 2048;
+		ullDen = (unsigned long long)iBaud*uiDiv*uiRem;
+		ullErr = (ullNum > ullDen) ? (ullNum - ullDen) : (ullDen - ullNum);
+		if(ullErr*ullBestDen < ullBestErr*ullDen)			// Compare relative errors
+			{
+			ullBestErr = ullErr;
+			ullBestDen = ullDen;
+			uiBestDiv = uiDiv;
+			uiBestRem = uiRem;
+			if(ullErr == 0)
+				break;
+			}
+		}
+	*piDiv = uiBestDiv;
+	*piFbr = 0x8000|uiBestRem;
+	return (ullNum + (uiBestDiv*uiBestRem)/2)/(uiBestDiv*uiBestRem);
+	}
+
+/**
+	@brief int UrtBaudRd(ADI_UART_TypeDef *pPort, int iBaud, int *piPpm)
+			==========Reads back the baud rate the UART is running at.
+	@param pPort :{pADI_UART,}	\n
+		Set to pADI_UART. Only one channel available.
+	@param iBaud :{B1200,B2200,B2400,B4800,B9600,B19200,B38400,B57600,B115200,B230400,B460800}	\n
+		Baud rate wanted, used for the error.
+	@param piPpm :{0,}	\n
+		Receives the error of the achieved rate against iBaud in ppm, or 0 if not needed.
+	@return Baud rate achieved from COMDIV, COMFBR and the current clock setup.
+	@note
+		- Excludes the error of the 16MHz oscillator itself.
+**/
+
+int UrtBaudRd(ADI_UART_TypeDef *pPort, int iBaud, int *piPpm)
+	{
+	long long llNum = (long long)UrtClk()*64;
+	long long llDen;
+	int iRate;
+
+	if(pPort->COMFBR & 0x8000)
+		llDen = (long long)pPort->COMDIV*(pPort->COMFBR & 0x1FFF);
+	else
+		llDen = (long long)pPort->COMDIV*2048;					// Fractional divider off
+	if(llDen == 0)
+		return 0;
+	iRate = (llNum + llDen/2)/llDen;
+	if(piPpm)
+		*piPpm = ((llNum - iBaud*llDen)*1000000)/(iBaud*llDen);
+	return iRate;
+	}
+
 /**
 	@brief int UrtBrk(ADI_UART_TypeDef *pPort, int iBrk)
 			==========Force SOUT pin to 0
@@ -311,4 +489,902 @@ int UrtIntSta(ADI_UART_TypeDef *pPort)
 	return pPort->COMIIR;
 	}
 
+/**
+	@brief int UrtBufCfg(ADI_UART_TypeDef *pPort, RingBuf *pTxRing, RingBuf *pRxRing)
+			==========Attaches transmit and receive rings for interrupt driven operation.
+	@param pPort :{pADI_UART,}	\n
+		Set to pADI_UART. Only one channel available.
+	@param pTxRing :{}	\n
+		Ring initialised with RingInit(), drained by the THRE interrupt.
+	@param pRxRing :{0,}	\n
+		Ring initialised with RingInit(), filled by the receive interrupt.
+		0 to leave reception to UrtRxDmaCfg().
+	@return 1.
+	@note
+		- Enables COMIEN_ETBEI and COMIEN_ELSI, and COMIEN_ERBFI if pRxRing is
+		not 0. Other COMIEN bits are kept.
+		- Call UrtBufInt() from UART_Int_Handler() and enable UART_IRQn.
+**/
+
+int UrtBufCfg(ADI_UART_TypeDef *pPort, RingBuf *pTxRing, RingBuf *pRxRing)
+	{
+	pUrtTxRing = pTxRing;
+	pUrtRxRing = pRxRing;
+	iUrtTxIdle = 1;
+	uiUrtErrTail = uiUrtErrHead;
+	if(pRxRing)
+		pPort->COMIEN |= COMIEN_ERBFI|COMIEN_ETBEI|COMIEN_ELSI;
+	else
+		pPort->COMIEN |= COMIEN_ETBEI|COMIEN_ELSI;
+	return 1;
+	}
+
+/**
+	@brief int UrtFlowCfg(ADI_UART_TypeDef *pPort, int iHigh, int iLow)
+			==========Turns RTS/CTS hardware flow control on or off.
+	@param pPort :{pADI_UART,}	\n
+		Set to pADI_UART. Only one channel available.
+	@param iHigh :{0,1-}	\n
+		Receive ring level at which RTS is deasserted, or 0 to turn flow
+		control off. Leave room for the bytes the far end sends before it
+		sees RTS change.
+	@param iLow :{0-}	\n
+		Receive ring level at or below which UrtBufRd() asserts RTS again.
+		Must be below iHigh.
+	@return 1.
+	@note
+		- Asserts RTS and enables COMIEN_EDSSI. The modem status interrupt is
+		serviced by UrtBufInt(), so call it from UART_Int_Handler() and enable
+		UART_IRQn even when transmitting with UrtTxDma().
+		- While CTS is deasserted UrtBufInt() stops feeding COMTX and
+		COMIEN_EDMAT is cleared to hold a UrtTxDma() transfer. Both carry on
+		from the CTS edge without polling.
+		- Select the RTS and CTS pins with GPCON, this function does not
+		change the port multiplexers.
+**/
+
+int UrtFlowCfg(ADI_UART_TypeDef *pPort, int iHigh, int iLow)
+	{
+	iUrtRxHigh = iHigh;
+	iUrtRxLow = iLow;
+	iUrtRtsOff = 0;
+	iUrtFlow = (iHigh != 0);
+	if(iUrtFlow)
+		{
+		pPort->COMMCR |= COMMCR_RTS;
+		pPort->COMIEN |= COMIEN_EDSSI;
+		}
+	else
+		pPort->COMIEN &= ~COMIEN_EDSSI;
+	return 1;
+	}
+
+/**
+	@brief static int UrtCtsOff(ADI_UART_TypeDef *pPort)
+			==========Checks if flow control is holding the transmitter.
+	@return 1 if flow control is on and CTS is deasserted, 0 otherwise.
+**/
+
+static int UrtCtsOff(ADI_UART_TypeDef *pPort)
+	{
+	return iUrtFlow && !(pPort->COMMSR & COMMSR_CTS);
+	}
+
+/**
+	@brief int UrtBufRxFn(ADI_UART_TypeDef *pPort, void (*pfRx)(int iByte))
+			==========Hands each received byte to a function from the interrupt.
+	@param pPort :{pADI_UART,}	\n
+		Set to pADI_UART. Only one channel available.
+	@param pfRx :{0,}	\n
+		Function called by UrtBufInt() with each received byte, or 0 to go
+		back to the receive ring given to UrtBufCfg().
+	@return 1.
+	@note
+		- Call after UrtBufCfg(). Enables COMIEN_ERBFI if pfRx is not 0.
+		- pfRx runs in UART_Int_Handler() and must be short, one byte time at
+		most to avoid overruns.
+**/
+
+int UrtBufRxFn(ADI_UART_TypeDef *pPort, void (*pfRx)(int iByte))
+	{
+	pfUrtRxByte = pfRx;
+	if(pfRx)
+		pPort->COMIEN |= COMIEN_ERBFI;
+	return 1;
+	}
+
+/**
+	@brief int UrtBufWr(ADI_UART_TypeDef *pPort, const unsigned char *pucData, int iLen)
+			==========Queues bytes for interrupt driven transmission.
+	@param pPort :{pADI_UART,}	\n
+		Set to pADI_UART. Only one channel available.
+	@param pucData :{}	\n
+		Bytes to transmit.
+	@param iLen :{0-}	\n
+		Number of bytes in pucData.
+	@return Number of bytes queued. Less than iLen if the transmit ring is full.
+	@note
+		- Returns without waiting for the bytes to be sent.
+		- If the transmitter is idle the first byte is written to COMTX here,
+		the THRE interrupt then sends the rest.
+		- The idle test and the first write are made with interrupts masked,
+		as the CTS edge of UrtFlowCfg() restarts the transmitter from
+		UrtBufInt() and the ring has only one consumer.
+**/
+
+int UrtBufWr(ADI_UART_TypeDef *pPort, const unsigned char *pucData, int iLen)
+	{
+	int iQueued;
+	unsigned long ulPri;
+
+	iQueued = RingWr(pUrtTxRing, pucData, iLen);
+	ulPri = __get_PRIMASK();
+	__disable_irq();							// The modem status interrupt also kicks
+	if(iUrtTxIdle && RingCnt(pUrtTxRing) && !UrtCtsOff(pPort))
+		{
+		iUrtTxIdle = 0;
+		pPort->COMTX = RingGet(pUrtTxRing);
+		}
+	__set_PRIMASK(ulPri);
+	return iQueued;
+	}
+
+/**
+	@brief int UrtBufRd(ADI_UART_TypeDef *pPort, unsigned char *pucData, int iLen)
+			==========Reads received bytes from the receive ring.
+	@param pPort :{pADI_UART,}	\n
+		Set to pADI_UART. Only one channel available.
+	@param pucData :{}	\n
+		Destination for the received bytes.
+	@param iLen :{0-}	\n
+		Space available in pucData.
+	@return Number of bytes read. 0 if nothing was received.
+	@note
+		- Line errors of the bytes read are dropped, use UrtBufRdErr() to
+		have them flagged.
+**/
+
+int UrtBufRd(ADI_UART_TypeDef *pPort, unsigned char *pucData, int iLen)
+	{
+	return UrtBufRdErr(pPort, pucData, 0, iLen);
+	}
+
+/**
+	@brief int UrtBufRdErr(ADI_UART_TypeDef *pPort, unsigned char *pucData, unsigned char *pucErr, int iLen)
+			==========Reads received bytes from the receive ring with their line errors.
+	@param pPort :{pADI_UART,}	\n
+		Set to pADI_UART. Only one channel available.
+	@param pucData :{}	\n
+		Destination for the received bytes.
+	@param pucErr :{0,}	\n
+		Receives the COMLSR error bits of each byte read, 0 for a good byte,
+		or 0 if not needed.
+	@param iLen :{0-}	\n
+		Space available in pucData and pucErr.
+	@return Number of bytes read. 0 if nothing was received.
+	@note
+		- UrtBufInt() keeps the positions of the last URT_ERR_MAX damaged
+		bytes not yet read. Further errors are still counted but not flagged,
+		UrtErr.uiUnflg counts them.
+**/
+
+int UrtBufRdErr(ADI_UART_TypeDef *pPort, unsigned char *pucData, unsigned char *pucErr, int iLen)
+	{
+	unsigned int uiFrom = pUrtRxRing->uiTail;
+
+	iLen = RingRd(pUrtRxRing, pucData, iLen);
+	UrtErrFlg(uiFrom, pucErr, iLen);
+	if(iUrtRtsOff && (RingCnt(pUrtRxRing) <= iUrtRxLow))
+		{
+		iUrtRtsOff = 0;
+		pPort->COMMCR |= COMMCR_RTS;				// Room again, let the far end send
+		}
+	return iLen;
+	}
+
+/**
+	@brief int UrtBufRxCnt(ADI_UART_TypeDef *pPort)
+			==========Returns the number of received bytes waiting.
+	@param pPort :{pADI_UART,}	\n
+		Set to pADI_UART. Only one channel available.
+	@return Number of bytes in the receive ring.
+**/
+
+int UrtBufRxCnt(ADI_UART_TypeDef *pPort)
+	{
+	return RingCnt(pUrtRxRing);
+	}
+
+/**
+	@brief int UrtBufTxCnt(ADI_UART_TypeDef *pPort)
+			==========Returns the number of bytes still queued for transmission.
+	@param pPort :{pADI_UART,}	\n
+		Set to pADI_UART. Only one channel available.
+	@return Number of bytes in the transmit ring, not counting the byte in COMTX.
+**/
+
+int UrtBufTxCnt(ADI_UART_TypeDef *pPort)
+	{
+	return RingCnt(pUrtTxRing);
+	}
+
+/**
+	@brief int UrtBufInt(ADI_UART_TypeDef *pPort)
+			==========Services the UART interrupt for buffered operation.
+	@param pPort :{pADI_UART,}	\n
+		Set to pADI_UART. Only one channel available.
+	@return 1.
+	@note
+		- Call from UART_Int_Handler().
+		- Loops until COMIIR reports no pending interrupt.
+		- A received byte is dropped if the receive ring is full.
+		- Line status interrupts are counted by error class for UrtErrRd().
+		The byte they refer to is flagged: passed with its error bits above
+		bit 7 to the UrtBufRxFn() function, or for the ring and DMA paths
+		its receive index kept for UrtBufRdErr() and UrtRxDmaRdErr().
+		- Restarts the idle line timer of UrtRxIdleCfg() when the first byte
+		of a frame arrives.
+**/
+
+int UrtBufInt(ADI_UART_TypeDef *pPort)
+	{
+	int iIir;
+	int iByte;
+
+	if(iUrtIdleStop && (UrtRxDmaHead() != uiUrtIdleMark))
+		UrtIdleRun(pPort);						// The DMA already took the first byte
+	while(((iIir = pPort->COMIIR) & 0x1) == 0)
+		{
+		switch(iIir & 0x6)
+			{
+			case 0x4:							// Receive byte
+				if(iUrtIdleStop)
+					{
+					UrtIdleRun(pPort);			// Left in COMRX for the DMA
+					break;
+					}
+				iByte = pPort->COMRX&0xff;
+				if(pfUrtRxByte)
+					pfUrtRxByte(iByte | (iUrtRxErr<<8));
+				else
+					{
+					if(iUrtRxErr && (RingFree(pUrtRxRing) > 0))
+						UrtErrAdd(pUrtRxRing->uiHead, iUrtRxErr);
+					if(RingPut(pUrtRxRing, iByte) == 0)
+						UrtErrCnt.uiFull++;
+					if(iUrtFlow && !iUrtRtsOff && (RingCnt(pUrtRxRing) >= iUrtRxHigh))
+						{
+						iUrtRtsOff = 1;
+						pPort->COMMCR &= ~COMMCR_RTS;	// High water, hold the far end
+						}
+					}
+				iUrtRxErr = 0;
+				break;
+
+			case 0x2:							// Transmit buffer empty
+				if(UrtCtsOff(pPort))
+					{
+					iUrtTxIdle = 1;				// Paused, the CTS edge restarts it
+					break;
+					}
+				iByte = RingGet(pUrtTxRing);
+				if(iByte < 0)
+					iUrtTxIdle = 1;
+				else
+					pPort->COMTX = iByte;
+				break;
+
+			case 0x6:							// Line status, cleared by reading COMLSR
+				iByte = pPort->COMLSR & URT_LSR_ERR;
+				if(iByte & COMLSR_OE)
+					UrtErrCnt.uiOe++;
+				if(iByte & COMLSR_PE)
+					UrtErrCnt.uiPe++;
+				if(iByte & COMLSR_FE)
+					UrtErrCnt.uiFe++;
+				if(iByte & COMLSR_BI)
+					UrtErrCnt.uiBi++;
+				// The damaged byte (or the one after a lost byte) is still in COMRX
+				if(pucUrtDmaRx)
+					{
+					UrtErrCnt.uiPos = UrtRxDmaHead();
+					UrtErrAdd(UrtErrCnt.uiPos, iByte);
+					}
+				else if(pUrtRxRing)
+					UrtErrCnt.uiPos = pUrtRxRing->uiHead;
+				iUrtRxErr |= iByte;
+				break;
+
+			default:							// Modem status, cleared by reading COMMSR
+				iByte = pPort->COMMSR;
+				if(!iUrtFlow || !(iByte & COMMSR_DCTS))
+					break;
+				if(iByte & COMMSR_CTS)			// Far end ready, resume
+					{
+					if(iUrtDmaTxBusy)
+						pPort->COMIEN |= COMIEN_EDMAT;
+					if(pUrtTxRing && iUrtTxIdle && RingCnt(pUrtTxRing))
+						{
+						iUrtTxIdle = 0;
+						pPort->COMTX = RingGet(pUrtTxRing);
+						}
+					}
+				else if(iUrtDmaTxBusy)
+					pPort->COMIEN &= ~COMIEN_EDMAT;	// Hold the DMA requests
+				break;
+			}
+		}
+	return 1;
+	}
+
+/**
+	@brief static void UrtErrAdd(unsigned int uiPos, int iBits)
+			==========Keeps the receive index of a damaged byte, called from UrtBufInt().
+**/
+
+static void UrtErrAdd(unsigned int uiPos, int iBits)
+	{
+	unsigned int uiHead = uiUrtErrHead;
+
+	if((uiHead - uiUrtErrTail) >= URT_ERR_MAX)
+		{
+		UrtErrCnt.uiUnflg++;					// Full, counted but not flagged
+		return;
+		}
+	auiUrtErrPos[uiHead % URT_ERR_MAX] = uiPos;
+	aucUrtErrBits[uiHead % URT_ERR_MAX] = iBits;
+	uiUrtErrHead = uiHead+1;
+	}
+
+/**
+	@brief static void UrtErrFlg(unsigned int uiFrom, unsigned char *pucErr, int iLen)
+			==========Flags the damaged bytes among iLen bytes read from receive index uiFrom.
+	@note
+		- Positions before uiFrom+iLen are used up, including those of bytes
+		skipped unread.
+**/
+
+static void UrtErrFlg(unsigned int uiFrom, unsigned char *pucErr, int iLen)
+	{
+	unsigned int uiTail = uiUrtErrTail;
+	unsigned int uiOff;
+	int i1;
+
+	if(pucErr)
+		for(i1=0; i1<iLen; i1++)
+			pucErr[i1] = 0;
+	while(uiTail != uiUrtErrHead)
+		{
+		uiOff = auiUrtErrPos[uiTail % URT_ERR_MAX] - uiFrom;
+		if(((int)uiOff >= 0) && (uiOff >= (unsigned int)iLen))
+			break;								// Not read yet
+		if(pucErr && ((int)uiOff >= 0))
+			pucErr[uiOff] = aucUrtErrBits[uiTail % URT_ERR_MAX];
+		uiTail++;
+		}
+	uiUrtErrTail = uiTail;
+	}
+
+/**
+	@brief int UrtErrRd(ADI_UART_TypeDef *pPort, UrtErr *pErr, int iClr)
+			==========Reads the line error counts.
+	@param pPort :{pADI_UART,}	\n
+		Set to pADI_UART. Only one channel available.
+	@param pErr :{0,}	\n
+		Receives the counts since they were last cleared, or 0 if not needed.
+	@param iClr :{0,1}	\n
+		- 0 to keep counting.
+		- 1 to clear the counts after reading.
+	@return Total of overrun, parity, framing and break errors.
+	@note
+		- Counted by UrtBufInt(), which enables COMIEN_ELSI through UrtBufCfg().
+		- uiPos is the free running receive index of the last error only: the
+		ring head for UrtBufCfg() reception or the DMA write index for
+		UrtRxDmaCfg(). Read with UrtBufRdErr() or UrtRxDmaRdErr() to have
+		every damaged byte flagged.
+**/
+
+int UrtErrRd(ADI_UART_TypeDef *pPort, UrtErr *pErr, int iClr)
+	{
+	UrtErr Snap = UrtErrCnt;
+
+	if(pErr)
+		*pErr = Snap;
+	if(iClr)									// Subtract, so counts made meanwhile are kept
+		{
+		UrtErrCnt.uiOe -= Snap.uiOe;
+		UrtErrCnt.uiPe -= Snap.uiPe;
+		UrtErrCnt.uiFe -= Snap.uiFe;
+		UrtErrCnt.uiBi -= Snap.uiBi;
+		UrtErrCnt.uiFull -= Snap.uiFull;
+		UrtErrCnt.uiUnflg -= Snap.uiUnflg;
+		}
+	return Snap.uiOe + Snap.uiPe + Snap.uiFe + Snap.uiBi;
+	}
+
+/**
+	@brief static void UrtTxDmaArm(void)
+			==========Programs the UARTTX_C primary descriptor with the next block.
+	@note
+		- The descriptor table is found through DMAPDBPTR as set by DmaBase().
+		The channel is enabled with DmaSet() so DmaErrInt() can re-arm it.
+**/
+
+static void UrtTxDmaArm(void)
+	{
+	DmaDesc *pDesc;
+	int iNum;
+
+	iNum = iUrtDmaTxLeft;
+	if(iNum > URT_DMA_MAX)
+		iNum = URT_DMA_MAX;
+	pDesc = (DmaDesc *)pADI_DMA->DMAPDBPTR + (UARTTX_C-1);
+	pDesc->srcEndPtr = (unsigned int)(pucUrtDmaTx + iNum - 1);
+	pDesc->destEndPtr = (unsigned int)(&pADI_UART->COMTX);
+	pDesc->ctrlCfg.ctrlCfgVal = DMA_DSTINC_NO|DMA_SRCINC_BYTE|DMA_SIZE_BYTE|
+		((iNum-1)<<4)|DMA_BASIC;
+	pucUrtDmaTx += iNum;
+	iUrtDmaTxLeft -= iNum;
+	pADI_DMA->DMAALTCLR = DMAALTCLR_UARTTX;			// Use the primary structure
+	pADI_DMA->DMARMSKCLR = DMARMSKCLR_UARTTX;
+	DmaSet(0, DMAENSET_UARTTX, 0, 0);
+	}
+
+/**
+	@brief int UrtTxDma(ADI_UART_TypeDef *pPort, const unsigned char *pucBuf, int iLen, void (*pfCallback)(void))
+			==========Transmits a block with the UART Tx DMA channel.
+	@param pPort :{pADI_UART,}	\n
+		Set to pADI_UART. Only one channel available.
+	@param pucBuf :{}	\n
+		Bytes to transmit. Must stay valid until pfCallback is raised.
+	@param iLen :{1-}	\n
+		Number of bytes. Blocks longer than 1024 bytes are sent as several
+		DMA cycles, re-armed from UrtTxDmaInt().
+	@param pfCallback :{0,}	\n
+		Function raised from DMA_UART_TX_Int_Handler() once the last byte has
+		been written to COMTX, or 0 for none.
+	@return 1 if the transfer was started or 0 if a transfer is already running.
+	@note
+		- DmaBase() must have been called and DMA_UART_TX_IRQn enabled. The
+		channel is enabled with DmaSet(), call DmaErrInt() from
+		DMA_Err_Int_Handler() to re-arm it after a bus error.
+		- COMIEN_EDMAT is set only after the channel is armed, with COMTX empty
+		this raises the DMA request directly so no dummy byte has to be written.
+		- The last byte may still be shifting out when pfCallback runs, check
+		COMLSR_TEMT with UrtLinSta() before turning the UART off.
+**/
+
+int UrtTxDma(ADI_UART_TypeDef *pPort, const unsigned char *pucBuf, int iLen, void (*pfCallback)(void))
+	{
+	if(iUrtDmaTxBusy || (iLen <= 0))
+		return 0;
+	iUrtDmaTxBusy = 1;
+	pucUrtDmaTx = pucBuf;
+	iUrtDmaTxLeft = iLen;
+	pfUrtDmaTxDone = pfCallback;
+	UrtTxDmaArm();
+	if(!UrtCtsOff(pPort))
+		pPort->COMIEN |= COMIEN_EDMAT;			// Request goes active, transfer starts
+	return 1;
+	}
+
+/**
+	@brief int UrtTxDmaBusy(ADI_UART_TypeDef *pPort)
+			==========Checks if a UrtTxDma() transfer is running.
+	@param pPort :{pADI_UART,}	\n
+		Set to pADI_UART. Only one channel available.
+	@return 1 if a transfer is running or 0 if UrtTxDma() can be called.
+**/
+
+int UrtTxDmaBusy(ADI_UART_TypeDef *pPort)
+	{
+	return iUrtDmaTxBusy;
+	}
+
+/**
+	@brief int UrtTxDmaInt(ADI_UART_TypeDef *pPort)
+			==========Services the UART Tx DMA completion interrupt.
+	@param pPort :{pADI_UART,}	\n
+		Set to pADI_UART. Only one channel available.
+	@return 1 if the transfer finished and the callback was raised or 0 if
+		the next block of a long transfer was armed.
+	@note
+		- Call from DMA_UART_TX_Int_Handler().
+**/
+
+int UrtTxDmaInt(ADI_UART_TypeDef *pPort)
+	{
+	if(iUrtDmaTxLeft)
+		{
+		UrtTxDmaArm();							// EDMAT stays set, next block follows on
+		return 0;
+		}
+	pPort->COMIEN &= ~COMIEN_EDMAT;				// Drop the request before masking
+	pADI_DMA->DMARMSKSET = DMARMSKSET_UARTTX;
+	iUrtDmaTxBusy = 0;
+	if(pfUrtDmaTxDone)
+		pfUrtDmaTxDone();
+	return 1;
+	}
+
+/**
+	@brief static void UrtRxDmaArm(int iAlt)
+			==========Programs one UARTRX_C descriptor for a ping-pong cycle.
+	@param iAlt :{0,1}	\n
+		0 for the primary descriptor, which fills the first half of the buffer.
+		1 for the alternate descriptor, which fills the second half.
+**/
+
+static void UrtRxDmaArm(int iAlt)
+	{
+	DmaDesc *pDesc;
+
+	if(iAlt)
+		pDesc = (DmaDesc *)pADI_DMA->DMAADBPTR + (UARTRX_C-1);
+	else
+		pDesc = (DmaDesc *)pADI_DMA->DMAPDBPTR + (UARTRX_C-1);
+	pDesc->srcEndPtr = (unsigned int)(&pADI_UART->COMRX);
+	pDesc->destEndPtr = (unsigned int)(pucUrtDmaRx + (iAlt+1)*uiUrtDmaRxHalf - 1);
+	pDesc->ctrlCfg.ctrlCfgVal = DMA_DSTINC_BYTE|DMA_SRCINC_NO|DMA_SIZE_BYTE|
+		((uiUrtDmaRxHalf-1)<<4)|DMA_PING;
+	}
+
+/**
+	@brief static unsigned int UrtRxDmaHead(void)
+			==========Returns the free running index of the next byte the DMA will write.
+	@note
+		- Reads the remaining count of the descriptor being filled, which the
+		controller writes back after every byte because R_power is 0.
+		- Retries if UrtRxDmaInt() ran part way through.
+**/
+
+static unsigned int UrtRxDmaHead(void)
+	{
+	DmaDesc *pDesc;
+	unsigned int uiDone, uiCfg, uiLeft;
+
+	do
+		{
+		uiDone = uiUrtDmaRxDone;
+		if(iUrtDmaRxAlt)
+			pDesc = (DmaDesc *)pADI_DMA->DMAADBPTR + (UARTRX_C-1);
+		else
+			pDesc = (DmaDesc *)pADI_DMA->DMAPDBPTR + (UARTRX_C-1);
+		uiCfg = pDesc->ctrlCfg.ctrlCfgVal;
+		}
+	while(uiDone != uiUrtDmaRxDone);
+	if((uiCfg & 0x7) == DMA_STOP)				// Finished, UrtRxDmaInt() not run yet
+		uiLeft = 0;
+	else
+		uiLeft = ((uiCfg>>4) & 0x3ff) + 1;
+	return (uiDone+1)*uiUrtDmaRxHalf - uiLeft;
+	}
+
+/**
+	@brief int UrtRxDmaCfg(ADI_UART_TypeDef *pPort, unsigned char *pucBuf, int iSize)
+			==========Starts continuous reception into a circular buffer with the UART Rx DMA channel.
+	@param pPort :{pADI_UART,}	\n
+		Set to pADI_UART. Only one channel available.
+	@param pucBuf :{}	\n
+		Receive buffer, iSize bytes. Owned by UrtLib until the channel is disabled.
+	@param iSize :{4,8,16,32,64,128,256,512,1024,2048}	\n
+		Size of pucBuf in bytes. Must be a power of two.
+	@return 1 if successful or 0 if iSize is not valid.
+	@note
+		- DmaBase() must have been called and DMA_UART_RX_IRQn enabled. The
+		channel is enabled with DmaSet(), call DmaErrInt() from
+		DMA_Err_Int_Handler() to re-arm it after a bus error.
+		- The primary descriptor fills the first half of pucBuf and the alternate
+		the second half. Each is re-armed by UrtRxDmaInt() while the other is
+		being filled, so no received byte falls between two transfers.
+		- UrtRxDmaRd() must be called at least once per half buffer of received
+		bytes or the oldest bytes are overwritten.
+**/
+
+int UrtRxDmaCfg(ADI_UART_TypeDef *pPort, unsigned char *pucBuf, int iSize)
+	{
+	if((iSize < 4) || (iSize > 2*URT_DMA_MAX) || (iSize & (iSize-1)))
+		return 0;
+	pucUrtDmaRx = pucBuf;
+	uiUrtDmaRxHalf = iSize/2;
+	uiUrtDmaRxDone = 0;
+	uiUrtDmaRxTail = 0;
+	uiUrtErrTail = uiUrtErrHead;
+	iUrtDmaRxAlt = 0;
+	UrtRxDmaArm(0);
+	UrtRxDmaArm(1);
+	pADI_DMA->DMAALTCLR = DMAALTCLR_UARTRX;			// Start with the primary structure
+	pADI_DMA->DMARMSKCLR = DMARMSKCLR_UARTRX;
+	DmaSet(0, DMAENSET_UARTRX, 0, 0);				// Known to DmaErrInt()
+	pPort->COMIEN |= COMIEN_EDMAR;
+	return 1;
+	}
+
+/**
+	@brief int UrtRxDmaCnt(ADI_UART_TypeDef *pPort)
+			==========Returns the number of received bytes waiting in the DMA buffer.
+	@param pPort :{pADI_UART,}	\n
+		Set to pADI_UART. Only one channel available.
+	@return Number of bytes that UrtRxDmaRd() can return, at most the buffer size.
+**/
+
+int UrtRxDmaCnt(ADI_UART_TypeDef *pPort)
+	{
+	unsigned int uiCnt = UrtRxDmaHead() - uiUrtDmaRxTail;
+
+	if(uiCnt > 2*uiUrtDmaRxHalf)
+		uiCnt = 2*uiUrtDmaRxHalf;
+	return uiCnt;
+	}
+
+/**
+	@brief int UrtRxDmaRd(ADI_UART_TypeDef *pPort, unsigned char *pucData, int iLen)
+			==========Reads received bytes from the DMA buffer.
+	@param pPort :{pADI_UART,}	\n
+		Set to pADI_UART. Only one channel available.
+	@param pucData :{}	\n
+		Destination for the bytes.
+	@param iLen :{0-}	\n
+		Space available in pucData.
+	@return Number of bytes read. 0 if nothing was pending.
+	@note
+		- If the reader fell more than a buffer behind, the bytes already
+		overwritten are skipped and the newest buffer full is returned.
+		- Line errors of the bytes read are dropped, use UrtRxDmaRdErr() to
+		have them flagged.
+**/
+
+int UrtRxDmaRd(ADI_UART_TypeDef *pPort, unsigned char *pucData, int iLen)
+	{
+	return UrtRxDmaRdErr(pPort, pucData, 0, iLen);
+	}
+
+/**
+	@brief int UrtRxDmaRdErr(ADI_UART_TypeDef *pPort, unsigned char *pucData, unsigned char *pucErr, int iLen)
+			==========Reads received bytes from the DMA buffer with their line errors.
+	@param pPort :{pADI_UART,}	\n
+		Set to pADI_UART. Only one channel available.
+	@param pucData :{}	\n
+		Destination for the bytes.
+	@param pucErr :{0,}	\n
+		Receives the COMLSR error bits of each byte read, 0 for a good byte,
+		or 0 if not needed.
+	@param iLen :{0-}	\n
+		Space available in pucData and pucErr.
+	@return Number of bytes read. 0 if nothing was pending.
+	@note
+		- As UrtRxDmaRd(). The line status interrupt can be served after the
+		DMA has taken the damaged byte, so the byte flagged can be the one
+		after it.
+**/
+
+int UrtRxDmaRdErr(ADI_UART_TypeDef *pPort, unsigned char *pucData, unsigned char *pucErr, int iLen)
+	{
+	unsigned int uiHead = UrtRxDmaHead();
+	unsigned int uiTail = uiUrtDmaRxTail;
+	unsigned int uiMask = 2*uiUrtDmaRxHalf - 1;
+	int i1;
+
+	if((uiHead - uiTail) > uiMask+1)
+		uiTail = uiHead - (uiMask+1);
+	if(iLen > (int)(uiHead - uiTail))
+		iLen = uiHead - uiTail;
+	for(i1=0; i1<iLen; i1++)
+		pucData[i1] = pucUrtDmaRx[(uiTail+i1) & uiMask];
+	uiUrtDmaRxTail = uiTail+iLen;
+	UrtErrFlg(uiTail, pucErr, iLen);
+	return iLen;
+	}
+
+/**
+	@brief int UrtRxDmaInt(ADI_UART_TypeDef *pPort)
+			==========Services the UART Rx DMA completion interrupt.
+	@param pPort :{pADI_UART,}	\n
+		Set to pADI_UART. Only one channel available.
+	@return Number of half buffers completed since the last call, normally 1.
+	@note
+		- Call from DMA_UART_RX_Int_Handler().
+		- Re-arms each finished descriptor. The controller is already filling
+		the other half, so reception continues while this runs.
+**/
+
+int UrtRxDmaInt(ADI_UART_TypeDef *pPort)
+	{
+	DmaDesc *pDesc;
+	int iCnt = 0;
+
+	while(iCnt < 2)
+		{
+		if(iUrtDmaRxAlt)
+			pDesc = (DmaDesc *)pADI_DMA->DMAADBPTR + (UARTRX_C-1);
+		else
+			pDesc = (DmaDesc *)pADI_DMA->DMAPDBPTR + (UARTRX_C-1);
+		if((pDesc->ctrlCfg.ctrlCfgVal & 0x7) != DMA_STOP)
+			break;
+		UrtRxDmaArm(iUrtDmaRxAlt);
+		uiUrtDmaRxDone++;
+		iUrtDmaRxAlt ^= 1;
+		iCnt++;
+		}
+	DmaSet(0, DMAENSET_UARTRX, 0, 0);				// Restart if both halves had filled
+	if(iUrtIdleStop)
+		UrtIdleRun(pPort);						// In case the UART interrupt was missed
+	return iCnt;
+	}
+
+/**
+	@brief int UrtRxIdleCfg(ADI_UART_TypeDef *pPort, ADI_TIMER_TypeDef *pTMR, int iBaud, int iChars, void (*pfCallback)(int iLen))
+			==========Starts idle line detection on the DMA receive buffer.
+	@param pPort :{pADI_UART,}	\n
+		Set to pADI_UART. Only one channel available.
+	@param pTMR :{pADI_TM0,pADI_TM1}	\n
+		- pADI_TM0 for timer 0.
+		- pADI_TM1 for timer 1.
+	@param iBaud :{B1200,B2200,B2400,B4800,B9600,B19200,B38400,B57600,B115200,B230400,B460800}	\n
+		Baud rate passed to UrtCfg().
+	@param iChars :{1-}	\n
+		Number of silent character times that end a frame. 2 to 4 suits most
+		protocols, HART requires a gap of less than 1 character inside a frame.
+	@param pfCallback :{}	\n
+		Function raised from the timer interrupt with the number of bytes in
+		the frame. The bytes are read with UrtRxDmaRd().
+	@return 1 if successful or 0 if the timer is busy.
+	@note
+		- Call after UrtCfg() and UrtRxDmaCfg(). Uses the word length, parity
+		and stop bits in COMLCR to work out the character time.
+		- The timer is clocked from UCLK/16, enable its clock with ClkDis()
+		and its interrupt in the NVIC.
+		- The timer ticks once per character time while a frame is coming in.
+		The silence count restarts whenever a tick sees the DMA write index
+		has moved, so a frame is handed over between iChars and iChars+1
+		character times after its last byte.
+		- Once the frame is handed over, or on a tick that finds nothing
+		new, the timer stops and COMIEN_ERBFI is set. The first byte of the
+		next frame raises the UART interrupt, where UrtBufInt() clears
+		COMIEN_ERBFI and restarts the timer, leaving the byte to the DMA.
+		An idle line costs no interrupts and a frame of n bytes about
+		n+iChars ticks and one UART interrupt.
+		- Call UrtBufInt() from UART_Int_Handler() and enable UART_IRQn in
+		the NVIC, even if the UART is only used with DMA.
+**/
+
+int UrtRxIdleCfg(ADI_UART_TypeDef *pPort, ADI_TIMER_TypeDef *pTMR, int iBaud, int iChars, void (*pfCallback)(int iLen))
+	{
+	int iLcr = pPort->COMLCR;
+	int iBits;
+	int iClk;
+
+	iBits = 1 + 5 + (iLcr&3) + 1;				// Start, data and one stop bit
+	if(iLcr & COMLCR_PEN_EN)
+		iBits++;
+	if(iLcr & COMLCR_STOP_EN)
+		iBits++;
+	iClk = 16000000/16;							// UCLK/16 timer clock
+	if(pADI_CLKCTL->CLKSYSDIV & 0x1)
+		iClk /= 2;
+	pUrtIdleTmr = pTMR;
+	iUrtIdleStop = 0;
+	pPort->COMIEN &= ~COMIEN_ERBFI;
+	iUrtIdleChars = iChars;
+	iUrtIdleCnt = 0;
+	uiUrtIdleLast = uiUrtIdleMark = UrtRxDmaHead();
+	pfUrtIdleFrame = pfCallback;
+	GptLd(pTMR, (iClk*iBits)/iBaud);
+	return GptCfg(pTMR, TCON_CLK_UCLK, TCON_PRE_DIV16,
+		TCON_MOD_PERIODIC|TCON_RLD|TCON_ENABLE);
+	}
+
+/**
+	@brief int UrtRxStartFn(ADI_UART_TypeDef *pPort, void (*pfStart)(void))
+			==========Sets a function raised when an idle line frame starts.
+	@param pPort :{pADI_UART,}	\n
+		Set to pADI_UART. Only one channel available.
+	@param pfStart :{}	\n
+		Function raised when bytes follow the end of the last frame, 0 for
+		none. It is raised from UrtBufInt() when the first byte restarts the
+		stopped timer, otherwise from the timer interrupt on the first tick
+		that sees the bytes.
+	@return 1.
+	@note
+		- The frame started less than one character time earlier, so the
+		function can timestamp it, for example with TsMark().
+**/
+
+int UrtRxStartFn(ADI_UART_TypeDef *pPort, void (*pfStart)(void))
+	{
+	pfUrtIdleStart = pfStart;
+	return 1;
+	}
+
+/**
+	@brief int UrtRxIdleInt(ADI_UART_TypeDef *pPort)
+			==========Services the idle line timer interrupt.
+	@param pPort :{pADI_UART,}	\n
+		Set to pADI_UART. Only one channel available.
+	@return 1 if a frame was handed to the callback or 0 otherwise.
+	@note
+		- Call from the interrupt handler of the timer passed to UrtRxIdleCfg().
+**/
+
+int UrtRxIdleInt(ADI_UART_TypeDef *pPort)
+	{
+	unsigned int uiHead;
+
+	GptClrInt(pUrtIdleTmr, TSTA_TMOUT);
+	uiHead = UrtRxDmaHead();
+	if(uiHead != uiUrtIdleLast)					// Still receiving, restart the silence count
+		{
+		if((uiUrtIdleLast == uiUrtIdleMark) && pfUrtIdleStart)
+			pfUrtIdleStart();					// First bytes since the last frame
+		uiUrtIdleLast = uiHead;
+		iUrtIdleCnt = 0;
+		return 0;
+		}
+	if(uiHead == uiUrtIdleMark)
+		{
+		UrtIdleStop(pPort);						// Nothing since the last frame
+		return 0;
+		}
+	if(++iUrtIdleCnt < iUrtIdleChars)
+		return 0;
+	iUrtIdleCnt = 0;
+	if(pfUrtIdleFrame)
+		pfUrtIdleFrame(uiHead - uiUrtIdleMark);
+	uiUrtIdleMark = uiHead;
+	UrtIdleStop(pPort);
+	return 1;
+	}
+
+/**
+	@brief static void UrtIdleStop(ADI_UART_TypeDef *pPort)
+			==========Stops the idle line timer until the next received byte.
+	@note
+		- If the timer control register is still synchronising the timer runs
+		on and the next tick tries again.
+**/
+
+static void UrtIdleStop(ADI_UART_TypeDef *pPort)
+	{
+	unsigned long ulPri;
+
+	if(!GptCfg(pUrtIdleTmr, TCON_CLK_UCLK, TCON_PRE_DIV16, TCON_MOD_PERIODIC|TCON_RLD))
+		return;
+	ulPri = __get_PRIMASK();
+	__disable_irq();							// COMIEN is also written from other contexts
+	iUrtIdleStop = 1;
+	pPort->COMIEN |= COMIEN_ERBFI;
+	__set_PRIMASK(ulPri);
+	if(UrtRxDmaHead() != uiUrtIdleMark)
+		UrtIdleRun(pPort);						// A byte came in before ERBFI was set
+	}
+
+/**
+	@brief static void UrtIdleRun(ADI_UART_TypeDef *pPort)
+			==========Restarts the stopped idle line timer, the next frame has started.
+**/
+
+static void UrtIdleRun(ADI_UART_TypeDef *pPort)
+	{
+	unsigned long ulPri;
+
+	ulPri = __get_PRIMASK();
+	__disable_irq();
+	if(!iUrtIdleStop)
+		{
+		__set_PRIMASK(ulPri);					// Already restarted
+		return;
+		}
+	iUrtIdleStop = 0;
+	pPort->COMIEN &= ~COMIEN_ERBFI;
+	__set_PRIMASK(ulPri);
+	uiUrtIdleLast = UrtRxDmaHead();
+	iUrtIdleCnt = 0;
+	while(GptBsy(pUrtIdleTmr))
+		;										// A few timer clocks after the stop
+	GptCfg(pUrtIdleTmr, TCON_CLK_UCLK, TCON_PRE_DIV16,
+		TCON_MOD_PERIODIC|TCON_RLD|TCON_ENABLE);
+	if(pfUrtIdleStart)
+		pfUrtIdleStart();
+	}
+
    /**@}*/
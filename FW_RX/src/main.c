@@ -9,18 +9,36 @@
 #include <IntLib.h>
 #include <UrtLib.h>
 #include <GptLib.h>
+#include <DmaLib.h>
+#include <CobsLib.h>
+#include <ArqLib.h>
+#include <TsLib.h>
 
 #define TRUE		1
 #define FALSE		0
 
-volatile uint8_t ucTxBufferEmpty  = 0; // Used to indicate that the UART Tx buffer is empty
-volatile uint8_t ucRxBufferFull  = 0; // Used to indicate that the UART Rx buffer is full
+#define UART_TX_RING_SIZE	256	// Must be a power of two
+#define UART_RX_DMA_SIZE	64	// Must be a power of two
+#define UART_IDLE_CHARS		2	// Silent character times that end a frame
+#define FRAME_SIZE			(ARQ_MAX+4)	// ARQ header, payload and CRC
+#define TS_HZ				125000		// Timestamp ticks per second, PCLK/16
+
+uint8_t ucTxRingBuf[UART_TX_RING_SIZE];	// Storage for the UART transmit ring
+uint8_t ucRxDmaBuf[UART_RX_DMA_SIZE];	// Ping-pong buffer filled by the UART Rx DMA
+RingBuf UartTxRing;						// Drained by the THRE interrupt
+uint8_t ucFrame[2][FRAME_SIZE];			// One frame decodes while main reads the other
+uint8_t *pucRxFrame;					// Frame handed to main
+CobsDec FrameDec;						// Fed from the Rx DMA buffer in the interrupts
+volatile int iFrameLen = 0;				// Length of *pucRxFrame, 0 once main has read it
+ArqLink Link;							// Acknowledges the frames from FW_TX
+uint32_t ulRxBytes = 0;					// Payload bytes received in order
+volatile uint64_t ullRxStart = 0;		// Timestamp of the start of the frame on the line
+uint64_t ullFrameStart = 0;				// Timestamp of the start of *pucRxFrame
+uint32_t ulRxLatUs = 0;					// Frame start to payload delivered, last frame
+uint32_t ulRxLatMaxUs = 0;				// Same, largest so far
 
 uint8_t szTemp[128] = "";
 
-volatile uint8_t ucCOMIID0 = 0;
-volatile uint8_t ucComRx = 0;
-
 void WatchDogInit(void){
 	//---------- Disable Watchdog timer resets ----------
    pADI_WDT->T3CON = 0;
@@ -29,7 +47,7 @@ void WatchDogInit(void){
 
 void ClockInit(void){
 	//---------- Disable clock to unused peripherals ----------
-   ClkDis(CLKDIS_DISSPI0CLK|CLKDIS_DISSPI1CLK|CLKDIS_DISI2CCLK|CLKDIS_DISPWMCLK|CLKDIS_DIST0CLK|CLKDIS_DIST1CLK);
+   ClkDis(CLKDIS_DISSPI0CLK|CLKDIS_DISSPI1CLK|CLKDIS_DISI2CCLK|CLKDIS_DISPWMCLK);   // T0 times the idle line, T1 the timestamps
 
    // Select CD0 for CPU clock - 2Mhz clock
    ClkCfg(CLK_CD2,CLK_HF,CLKSYSDIV_DIV2EN_EN,CLK_UCLKCG);     
@@ -51,73 +69,115 @@ void GPIOInit(void){
    DioPul(pADI_GP2, 0x00);
 }
 
+void FrameDone(int len){
+   if(iFrameLen)
+      return;									// Main still busy, drop it and let ARQ resend
+   pucRxFrame = FrameDec.pucBuf;				// Swap buffers instead of copying
+   CobsDecInit(&FrameDec, (pucRxFrame == ucFrame[0]) ? ucFrame[1] : ucFrame[0], FRAME_SIZE);
+   ullFrameStart = ullRxStart;
+   iFrameLen = len;
+}
+
+void DecodeRx(void){
+   uint8_t ch;
+   int len;
+
+   while(UrtRxDmaRd(pADI_UART, &ch, 1)){		// Each byte is decoded into ucFrame once
+      len = CobsDecPut(&FrameDec, ch);
+      if(len > 0)
+         FrameDone(len);
+   }
+}
+
+void FrameRcvd(int iLen){
+   DecodeRx();									// Line went quiet, finish the frame now
+}
+
+void FrameStart(void){
+   ullRxStart = TsNow();						// Within one character time of the first byte
+}
+
 void UARTInit(void){
    //Select IO pins for UART.
    pADI_GP0->GPCON |= 0x9000;                   // Configure P0.6/P0.7 for UART
    UrtCfg(pADI_UART,B1200,COMLCR_WLS_8BITS,COMLCR_PEN_EN);  // setup baud rate for 9600, 8-bits
    UrtMod(pADI_UART,COMMCR_DTR,0);              // Setup modem bits
-   UrtIntCfg(pADI_UART,COMIEN_ERBFI|COMIEN_ETBEI);  // Setup UART IRQ sources
+   RingInit(&UartTxRing, ucTxRingBuf, UART_TX_RING_SIZE);
+   UrtBufCfg(pADI_UART,&UartTxRing,0);          // Interrupt driven Tx, Rx is left to the DMA
+   DmaBase();
+   UrtRxDmaCfg(pADI_UART,ucRxDmaBuf,UART_RX_DMA_SIZE);
+   UrtRxIdleCfg(pADI_UART,pADI_TM0,B1200,UART_IDLE_CHARS,FrameRcvd);
+   UrtRxStartFn(pADI_UART,FrameStart);
+   CobsDecInit(&FrameDec, ucFrame[0], FRAME_SIZE);
+}
+
+void TIMER1_Init(void){
+   //--------- Timer 1 free running for timestamps -------------
+   TsCfg(pADI_TM1,TCON_CLK_PCLK,TCON_PRE_DIV16,TS_HZ);
 }
 
 void Chip_Initialize(){
    WatchDogInit();
    ClockInit();
    GPIOInit();
+   TIMER1_Init();
    UARTInit();
    NVIC_EnableIRQ(UART_IRQn);
+   NVIC_EnableIRQ(DMA_UART_RX_IRQn);
+   NVIC_EnableIRQ(DMA_ERR_IRQn);
+   NVIC_EnableIRQ(TIMER0_IRQn);
+   NVIC_EnableIRQ(TIMER1_IRQn);
    NVIC_EnableIRQ(ADC1_IRQn);
 }
 
-void SendChar(uint8_t ch){
-	ucTxBufferEmpty = 0;
-    UrtTx(pADI_UART, ch);
-    while (ucTxBufferEmpty == 0) {};
-}
-
-void SendMsg(uint8_t *str){
-	uint16_t len =0 , i;
+void SendBlk(const uint8_t *data, int len){
+	int i = 0;
 
-	len = strlen((char*)str);
-	for(i=0; i<len; i++){
-		SendChar(str[i]);
+	while(i < len){
+		i += UrtBufWr(pADI_UART, &data[i], len - i);	// Only waits while the Tx ring is full
 	}
 }
 
-uint8_t* ReadMsg(void){
-	uint8_t cnt = 0;
-	static uint8_t str[20] = "";
-	while(TRUE){
-		if(ucRxBufferFull){
-			str[cnt++] = ucComRx;
-			ucRxBufferFull = FALSE;
-			if(ucComRx == 0xFF)
-				break;
-		}
-	}
-	return str;
+void RxPayload(const uint8_t *data, int len){
+	ulRxBytes += len;
+	ulRxLatUs = (uint32_t)TsUs(TsNow() - ullFrameStart);
+	if(ulRxLatUs > ulRxLatMaxUs)
+		ulRxLatMaxUs = ulRxLatUs;
+	DioTgl(pADI_GP0,PIN5);
 }
 
 int main(){
 	//Initialize
    	Chip_Initialize();
+	ArqInit(&Link, SendBlk, RxPayload, 1);		// Only acknowledges, never times out
 	DioSet(pADI_GP0,PIN5);
 
    	while(TRUE){
-		if(ucRxBufferFull){
-			SendChar(0x10);
-			SendMsg(ReadMsg());
-			ucRxBufferFull = FALSE;
+		if(iFrameLen){
+			ArqRx(&Link, pucRxFrame, iFrameLen);
+			iFrameLen = 0;						// Buffer free for the next frame
 		}
+		ArqPoll(&Link);							// Sends the cumulative ACK
    	}
 }
 void UART_Int_Handler()
 {
-	ucCOMIID0 = UrtIntSta(pADI_UART);   	// Read UART Interrupt ID register
-   	if ((ucCOMIID0 & 0x7) == 0x2){       	// Transmit buffer empty
-   		ucTxBufferEmpty = TRUE;
-   	}
-   	if ((ucCOMIID0 & 0x7) == 0x4){       	// Receive byte
-   		ucComRx = UrtRx(pADI_UART);
-   		ucRxBufferFull = TRUE;
-   	}
+	UrtBufInt(pADI_UART);					// Feed COMTX from the transmit ring
+}
+void DMA_UART_RX_Int_Handler()
+{
+	UrtRxDmaInt(pADI_UART);					// Re-arm the half just filled
+	DecodeRx();
+}
+void DMA_Err_Int_Handler()
+{
+	DmaErrInt();							// Re-arms the Rx channel after a bus error
+}
+void GP_Tmr0_Int_Handler()
+{
+	UrtRxIdleInt(pADI_UART);				// Raises FrameRcvd() after a gap on the line
+}
+void GP_Tmr1_Int_Handler()
+{
+	TsInt();								// Extends the timestamps past the 16-bit wrap
 }
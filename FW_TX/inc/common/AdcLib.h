@@ -8,11 +8,20 @@
    - Start conversion with AdcGo().
    - Check with AdcSta() that result is available.
    - Read result with AdcRd().
+   - Or stream results without gaps with AdcStreamStart(), calling
+     AdcStreamInt() from the ADC DMA interrupt.
+   - Or measure a list of inputs with AdcScanStart(), calling AdcScanInt()
+     from the ADC DMA interrupt.
+   - Read the SINC2 filter next to the main filter with AdcFastStart() and
+     AdcFastRd(), calling AdcFastInt() from the SINC2 DMA interrupt.
+   - Let AdcAutoCfg() and AdcAutoRes() choose the PGA gain from the results.
+   - Or start ADC0 and ADC1 together with AdcDualStart() for paired results.
+   - Interrupt only on a step of the input with AdcStpCfg().
    - Example:
 
-   @version    V0.4
+   @version    V0.10
    @author     ADI
-   @date       April 2013
+   @date       October 2026
    @par Revision History:
    - V0.1, November 2010: initial version. 
    - V0.2, September 2012: Fixed AdcDiag() - correct bits are modified now.
@@ -21,6 +30,18 @@
                            Changed AdcDetCon(), AdcDetSta(), AdcStpRd() to use
                            the pPort passed in.
    - V0.4, April 2013:     Added parameters definitions for AdcBias function
+   - V0.5, October 2026:   Added AdcStreamStart(), AdcStreamInt(), AdcStreamSta()
+                           and AdcStreamStop() for gapless DMA streaming.
+   - V0.6, October 2026:   Added AdcScanStart(), AdcScanInt() and AdcScanSta()
+                           for scan lists run by the DMA.
+   - V0.7, October 2026:   Added AdcFastStart(), AdcFastInt(), AdcFastRd(),
+                           AdcFastLast(), AdcFastSta() and AdcFastStop() for a
+                           SINC2 fast channel.
+   - V0.8, October 2026:   Added AdcAutoCfg(), AdcAutoRes() and AdcAutoSta() for
+                           automatic PGA gain selection.
+   - V0.9, October 2026:   Added AdcDualStart(), AdcDualSta() and AdcDualStop()
+                           for simultaneous ADC0 and ADC1 streams.
+   - V0.10, October 2026:  Added AdcStpCfg() to interrupt on steps only.
 
 All files for ADuCM360/361 provided by ADI, including this file, are
 provided  as is without warranty of any kind, either expressed or implied.
@@ -30,6 +51,39 @@ to ensure that the resulting application performs as required and is safe.
 
 **/
 #include <ADuCM360.h>
+#include "DmaLib.h"
+
+// Order of the ADC control registers in DMA writes, which start at ADCxMSKI
+#define	ADCSCAN_MSKI	0
+#define	ADCSCAN_CON		1
+#define	ADCSCAN_OF		2
+#define	ADCSCAN_INTGN	3
+#define	ADCSCAN_MDE		4
+#define	ADCSCAN_CTL		5
+
+// Gain control of AdcAutoRes(), magnitudes of signed integer results
+#define	ADCAUTO_DN		0x0E666666	// Gain down above 90% of full scale
+#define	ADCAUTO_UP		0x06666666	// Gain up below 40% of full scale...
+#define	ADCAUTO_TGT		0x0CCCCCCC	// ...as far as keeps results below 80%
+#define	ADCAUTO_UP_CNT	2			// Results in a row below ADCAUTO_UP to gain up
+#define	ADCAUTO_STA_OVR	0x6			// ADCxSTA_OVR and ADCxSTA_THEX
+#define	ADCAUTO_PGA_MSK	0x70		// ADCMDE_PGA_ bits
+
+// Task list size of AdcScanStart() for n entries
+#define	ADCSCAN_TASKS(n)	(4*(n)-1)
+
+// Entry of an AdcScanStart() list
+typedef struct
+{
+	int iInN;					// AdcPin() iInN, ADCCON_ADCCN_
+	int iInP;					// AdcPin() iInP, ADCCON_ADCCP_
+	int iGain;					// AdcRng() iGain, ADCMDE_PGA_
+	int iRef;					// AdcRng() iRef, ADCCON_ADCREF_
+	int iBuf;					// AdcBuf() iBufCfg, ADC_BUF_ON or ADCCON_BUF
+	int iNum;					// Results, 1 to 1024
+	int *piData;				// Buffer of iNum results
+	unsigned long ulCtl[ADCSCAN_CTL];	// Filled by AdcScanStart(), read by the DMA
+} AdcScanEntry;
 
 extern int AdcRng(ADI_ADC_TypeDef *pPort, int iRef, int iGain, int iCode);
 extern int AdcGo(ADI_ADC_TypeDef *pPort, int iStart);
@@ -46,7 +100,27 @@ extern int AdcPGAErr(ADI_ADC_TypeDef *pPort, int iAdcSta);
 extern int AdcDetSta(ADI_ADCSTEP_TypeDef *pPort);
 extern int AdcDetCon(ADI_ADCSTEP_TypeDef *pPort, int iCtrl, int iAdcSel, int iRate );
 extern int AdcStpRd(ADI_ADCSTEP_TypeDef *pPort);
+extern int AdcStpCfg(ADI_ADCSTEP_TypeDef *pPort, int iAdcSel, int iRate, int iTh);
 extern int AdcDmaCon(int iChan, int iEnable);
+extern int AdcStreamStart(ADI_ADC_TypeDef *pPort, int *piBuf, int iHalf, void (*pfHalf)(int *piData, int iNum));
+extern int AdcStreamInt(ADI_ADC_TypeDef *pPort);
+extern int AdcStreamSta(ADI_ADC_TypeDef *pPort);
+extern int AdcStreamStop(ADI_ADC_TypeDef *pPort);
+extern int AdcScanStart(ADI_ADC_TypeDef *pPort, AdcScanEntry *pEntry, int iNum, DmaDesc *pList, void (*pfDone)(ADI_ADC_TypeDef *pPort));
+extern int AdcScanInt(ADI_ADC_TypeDef *pPort);
+extern int AdcScanSta(ADI_ADC_TypeDef *pPort);
+extern int AdcFastStart(ADI_ADC_TypeDef *pPort, int iRate, int *piRing, int iHalf);
+extern int AdcFastInt(void);
+extern int AdcFastRd(int *piData, int iMax);
+extern int AdcFastLast(void);
+extern int AdcFastSta(int *piGaps);
+extern int AdcFastStop(void);
+extern int AdcDualStart(int *piBuf0, int *piBuf1, int iHalf, void (*pfPair)(int *piAdc0, int *piAdc1, int iNum));
+extern int AdcDualSta(unsigned long *pulPairs);
+extern int AdcDualStop(void);
+extern int AdcAutoCfg(ADI_ADC_TypeDef *pPort, int iMinGain, int iMaxGain, int iSettle);
+extern int AdcAutoRes(ADI_ADC_TypeDef *pPort, int iSta, int iRes, int *piGain);
+extern int AdcAutoSta(ADI_ADC_TypeDef *pPort, unsigned long *pulChg, unsigned long *pulOvr);
 
 
 	
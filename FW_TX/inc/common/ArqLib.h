@@ -0,0 +1,71 @@
+/**
+ *****************************************************************************
+   @file     ArqLib.h
+   @brief    Set of sliding window ARQ functions for a COBS framed link.
+   - Initialise a link with ArqInit().
+   - Queue payloads with ArqSend(), pass received frames to ArqRx().
+   - Call ArqTick() from a periodic timer interrupt and ArqPoll() from the
+     main loop.
+
+   @version  V0.1
+   @author   ADI
+   @date     October 2026
+   @par Revision History:
+   - V0.1, October 2026: initial version.
+
+
+
+All files for ADuCM360 provided by ADI, including this file, are
+provided  as is without warranty of any kind, either expressed or implied.
+The user assumes any and all risk from the use of this code.
+It is the responsibility of the person integrating this code into an application
+to ensure that the resulting application performs as required and is safe.
+
+**/
+#ifndef ARQLIB_H
+#define ARQLIB_H
+
+#include "CobsLib.h"
+
+// Frames in flight, a power of two up to 64 so slots follow the 8-bit sequence
+#ifndef ARQ_WIN
+#define ARQ_WIN		4
+#endif
+
+// Largest payload per frame in bytes
+#ifndef ARQ_MAX
+#define ARQ_MAX		64
+#endif
+
+// First payload byte of each frame, followed by the sequence number
+#define ARQ_DATA	0x44    // Data, sequence number of this frame
+#define ARQ_ACK		0x41    // Cumulative ACK, sequence number expected next
+
+// Link state. Frames are kept until acknowledged so they can be resent.
+typedef struct
+{
+   unsigned char    aaucTx[ARQ_WIN][ARQ_MAX];    // Payloads not yet acknowledged
+   int              aiTxLen[ARQ_WIN];            // Length of each payload
+   unsigned char    ucBase;                      // Oldest sequence number not acknowledged
+   unsigned char    ucNext;                      // Sequence number of the next new frame
+   unsigned char    ucExp;                       // Sequence number expected from the peer
+   int              iAckDue;                     // 1 when an ACK must be sent
+   volatile int     iTmr;                        // Ticks since the window last moved
+   int              iTimeout;                    // Ticks before the window is resent
+   CobsEnc          Enc;                         // Frame encoder
+   void           (*pfWr)(const unsigned char *pucData, int iLen);   // Sends encoded bytes
+   void           (*pfRx)(const unsigned char *pucData, int iLen);   // Takes payloads in order
+   unsigned int     uiTx;                        // Frames sent for the first time
+   unsigned int     uiRetx;                      // Frames resent after a timeout
+   unsigned int     uiDup;                       // Data frames dropped as out of order
+} ArqLink;
+
+extern int ArqInit(ArqLink *pLink, void (*pfWr)(const unsigned char *pucData, int iLen),
+   void (*pfRx)(const unsigned char *pucData, int iLen), int iTimeout);
+extern int ArqSend(ArqLink *pLink, const unsigned char *pucData, int iLen);
+extern int ArqRx(ArqLink *pLink, const unsigned char *pucFrame, int iLen);
+extern int ArqTick(ArqLink *pLink);
+extern int ArqPoll(ArqLink *pLink);
+extern int ArqFree(ArqLink *pLink);
+
+#endif
@@ -4,10 +4,23 @@
    @brief   Set of DMA peripheral functions.
    - DmaBase(), DmaSet(), DmaClr(), DmaSta() and DmaErr() apply to all DMA channels together.
    - DmaOn() apply for each channel separately. 
+   - Check structures with DmaDescChk() and call DmaErrInt() from
+     DMA_Err_Int_Handler() to re-arm channels stopped by bus errors.
    
-   @version    V0.1
+   @version    V0.5
    @author     ADI
-   @date       October 2012
+   @date       October 2026
+   @par Revision History:
+   - V0.1, October 2012: initial version.
+   - V0.2, October 2026: peripheral registers and transfer sizes of the channels
+     taken from the table DmaMap[] by one setup path. Alternate channel numbers
+     decoded the same way by all functions.
+   - V0.3, October 2026: DmaSgBuild() for memory and peripheral scatter-gather.
+   - V0.4, October 2026: DmaStructMemSetup() for memory to memory transfers.
+   - V0.5, October 2026: DmaDescChk(), DmaErrInt() with re-arming of faulted
+     channels and DmaDiagRd() counts. Counts over 1024 refused.
+     DmaPeripheralStructSetup() keeps the count of the structure.
+     DmaSgTaskSet() and DmaSgListSetup() to build task lists one task at a time.
 
 
 All files for ADuCM360/361 provided by ADI, including this file, are
@@ -16,6 +29,9 @@ The user assumes any and all risk from the use of this code.
 It is the responsibility of the person integrating this code into an application
 to ensure that the resulting application performs as required and is safe.
 **/
+#ifndef DMALIB_H
+#define DMALIB_H
+
 #include <ADuCM360.h>
 
 typedef struct
@@ -44,6 +60,24 @@ typedef struct dmaDesc
    } ctrlCfg ;
    unsigned int reserved4Bytes;
 } DmaDesc;
+// Scatter-gather task for DmaSgBuild()
+typedef struct
+{
+   volatile void *pSrc;       // First source value
+   volatile void *pDst;       // First destination value
+   int iNumVals;              // Values to move, 1 to 1024
+   int iCfg;                  // DMA_SIZE_, DMA_SRCINC_ and DMA_DSTINC_ values
+} DmaSgTask;
+// Bus error counts kept by DmaErrInt(), see DmaDiagRd()
+typedef struct
+{
+   unsigned long ulErrors;    // Bus error interrupts
+   unsigned short usStops;    // Channel bits of the channels left stopped after a fault
+   unsigned char ucLastChan;  // Channel of the last fault, 0 for none
+   unsigned short usFaults[12];  // Faults of each channel, SPI1TX_C first
+   unsigned short usRearms[12];  // Re-arms of each channel, SPI1TX_C first
+} DmaDiag;
+
 //typedef enum {false = 0, true = !false} boolean;
 // Suitable aLignment for the DMA descriptors
 #define DMACHAN_DSC_ALIGN 0x200
@@ -65,6 +99,15 @@ extern int DmaPeripheralStructSetup(int iChan, int iCfg);
 extern int DmaStructPtrOutSetup(int iChan, int iNumVals, unsigned char *pucTX_DMA);
 extern int DmaStructPtrInSetup(int iChan, int iNumVals, unsigned char *pucRX_DMA);
 extern int DmaCycleCntCtrl(unsigned int iChan, int iNumx, int iCfg);
+extern int DmaStructMemSetup(int iChan, int iCfg, int iNumVals, volatile void *pSrc, volatile void *pDst);
+extern int DmaSgBuild(int iChan, const DmaSgTask *pTask, int iNum, DmaDesc *pList, int iMode);
+extern int DmaSgTaskSet(DmaDesc *pDesc, const DmaSgTask *pTask, int iCyc);
+extern int DmaSgListSetup(int iChan, DmaDesc *pList, int iNum, int iMode);
+extern int DmaDescChk(int iChan);
+extern int DmaErrInt(void);
+extern int DmaRearmCfg(int iChans);
+extern const DmaDiag *DmaDiagRd(void);
+extern int DmaDiagClr(void);
 //DMA channel numbers.
 #define	SPI1TX_C	1
 #define	SPI1RX_C	2
@@ -99,11 +142,39 @@ extern int DmaCycleCntCtrl(unsigned int iChan, int iNumx, int iCfg);
 #define ADC1DMAWRITE 2
 #define ADC1DMAREAD  3
 #define SINC2DMAREAD 4
+// Added to the types above to set up the alternate structure
+#define iALTERNATE   12
 
 //DMA error bit.
 #define	DMA_ERR_RD		0
 #define	DMA_ERR_CLR		1
 
+//DmaDescChk() results.
+#define	DMA_CHK_CHAN	0x1
+#define	DMA_CHK_STOP	0x2
+#define	DMA_CHK_SIZE	0x4
+#define	DMA_CHK_ALIGN	0x8
+#define	DMA_CHK_SRC		0x10
+#define	DMA_CHK_DST		0x20
+
+// Faults in a row without progress after which DmaErrInt() leaves a channel stopped
+#ifndef DMA_REARM_MAX
+#define DMA_REARM_MAX	3
+#endif
+
+// Memory the DMA can reach, checked by DmaDescChk(). End addresses are exclusive.
+#ifndef DMA_FLASH_END
+#define DMA_FLASH_END	0x00020000	// 128kB flash, read only
+#endif
+#ifndef DMA_SRAM_BASE
+#define DMA_SRAM_BASE	0x20000000
+#define DMA_SRAM_END	0x20002000	// 8kB SRAM
+#endif
+#ifndef DMA_PERIPH_BASE
+#define DMA_PERIPH_BASE	0x40000000
+#define DMA_PERIPH_END	0x40050000
+#endif
+
 //DMA type (Cycl_ctrl)
 #define	DMA_STOP		0
 #define	DMA_BASIC		1
@@ -135,5 +206,4 @@ extern int DmaCycleCntCtrl(unsigned int iChan, int iNumx, int iCfg);
 #define iPrimary        0
 #define ALTERNATE      CCD_SIZE
 
-
-
+#endif
@@ -0,0 +1,363 @@
+/**
+ *****************************************************************************
+   @addtogroup dsp
+   @{
+   @file     DspLib.c
+   @brief    Set of integer streaming filter functions for ADC results.
+   - Moving average over 2^n results with DspMaInit() and DspMa().
+   - Exponential average with DspEmaInit() and DspEma().
+   - Decimating CIC or boxcar filter with DspCicInit() and DspCic().
+   - Biquad IIR section with DspBqInit() and DspBq().
+   - Each filter keeps its state in its own structure, one per channel.
+     The *Blk() functions filter a DMA buffer, for example from the
+     AdcStreamStart() callback.
+
+   @version  V0.1
+   @author   ADI
+   @date     October 2026
+   @par Revision History:
+   - V0.1, October 2026: initial version.
+
+   @note
+      Inputs are signed ADC results of up to 29 bits. Sums are kept in 64
+      bits so no filter overflows. The moving and exponential averages cost
+      the same per input whatever their length. The CIC divides once per
+      output, and not at all when its gain is a power of two. The biquad
+      uses five 32x32 to 64-bit multiplies per input.
+
+All files for ADuCM360 provided by ADI, including this file, are
+provided  as is without warranty of any kind, either expressed or implied.
+The user assumes any and all risk from the use of this code.
+It is the responsibility of the person integrating this code into an application
+to ensure that the resulting application performs as required and is safe.
+
+**/
+
+#include "DspLib.h"
+
+/**
+	@brief int DspMaInit(DspMaFlt *pMa, long *plHist, int iLog2)
+			==========Initialises a moving average.
+	@param pMa :{}	\n
+		State to initialise.
+	@param plHist :{}	\n
+		History of 2^iLog2 inputs, kept by the caller.
+	@param iLog2 :{0-12}	\n
+		Length of the average is 2^iLog2 inputs.
+	@return 1 if successful or 0 if iLog2 is out of range.
+	@note The history starts at 0, so the first 2^iLog2-1 outputs ramp up.
+**/
+
+int DspMaInit(DspMaFlt *pMa, long *plHist, int iLog2)
+	{
+	int i1;
+
+	if((iLog2 < 0) || (iLog2 > 12))
+		return 0;
+	pMa->plHist = plHist;
+	pMa->iLog2 = iLog2;
+	pMa->iPos = 0;
+	pMa->llSum = 0;
+	for(i1=0; i1<(1<<iLog2); i1++)
+		plHist[i1] = 0;
+	return 1;
+	}
+
+/**
+	@brief long DspMa(DspMaFlt *pMa, long lIn)
+			==========Adds one input to a moving average.
+	@param pMa :{}	\n
+		State from DspMaInit().
+	@param lIn :{}	\n
+		New input.
+	@return The average of the last 2^iLog2 inputs, rounded down.
+**/
+
+long DspMa(DspMaFlt *pMa, long lIn)
+	{
+	pMa->llSum += lIn - pMa->plHist[pMa->iPos];	// Replace the oldest input
+	pMa->plHist[pMa->iPos] = lIn;
+	pMa->iPos = (pMa->iPos + 1) & ((1 << pMa->iLog2) - 1);
+	return (long)(pMa->llSum >> pMa->iLog2);
+	}
+
+/**
+	@brief int DspMaBlk(DspMaFlt *pMa, const int *piIn, long *plOut, int iNum)
+			==========Adds a buffer of inputs to a moving average.
+	@param pMa :{}	\n
+		State from DspMaInit().
+	@param piIn :{}	\n
+		iNum inputs.
+	@param plOut :{}	\n
+		iNum outputs, one per input. May be piIn to filter in place.
+	@param iNum :{0-}	\n
+		Number of inputs.
+	@return iNum.
+**/
+
+int DspMaBlk(DspMaFlt *pMa, const int *piIn, long *plOut, int iNum)
+	{
+	int i1;
+
+	for(i1=0; i1<iNum; i1++)
+		plOut[i1] = DspMa(pMa, piIn[i1]);
+	return iNum;
+	}
+
+/**
+	@brief int DspEmaInit(DspEmaFlt *pEma, int iShift)
+			==========Initialises an exponential average.
+	@param pEma :{}	\n
+		State to initialise.
+	@param iShift :{0-30}	\n
+		Each output moves 1/2^iShift of the way to the input.
+	@return 1 if successful or 0 if iShift is out of range.
+	@note The first input sets the output, so there is no ramp from 0.
+**/
+
+int DspEmaInit(DspEmaFlt *pEma, int iShift)
+	{
+	if((iShift < 0) || (iShift > 30))
+		return 0;
+	pEma->iShift = iShift;
+	pEma->llAcc = 0;
+	pEma->iPrimed = 0;
+	return 1;
+	}
+
+/**
+	@brief long DspEma(DspEmaFlt *pEma, long lIn)
+			==========Adds one input to an exponential average.
+	@param pEma :{}	\n
+		State from DspEmaInit().
+	@param lIn :{}	\n
+		New input.
+	@return The new average, rounded down.
+**/
+
+long DspEma(DspEmaFlt *pEma, long lIn)
+	{
+	if(pEma->iPrimed == 0)
+		{
+		pEma->llAcc = (long long)lIn << pEma->iShift;
+		pEma->iPrimed = 1;
+		}
+	else
+		pEma->llAcc += lIn - (long)(pEma->llAcc >> pEma->iShift);
+	return (long)(pEma->llAcc >> pEma->iShift);
+	}
+
+/**
+	@brief int DspEmaBlk(DspEmaFlt *pEma, const int *piIn, long *plOut, int iNum)
+			==========Adds a buffer of inputs to an exponential average.
+	@param pEma :{}	\n
+		State from DspEmaInit().
+	@param piIn :{}	\n
+		iNum inputs.
+	@param plOut :{}	\n
+		iNum outputs, one per input. May be piIn to filter in place.
+	@param iNum :{0-}	\n
+		Number of inputs.
+	@return iNum.
+**/
+
+int DspEmaBlk(DspEmaFlt *pEma, const int *piIn, long *plOut, int iNum)
+	{
+	int i1;
+
+	for(i1=0; i1<iNum; i1++)
+		plOut[i1] = DspEma(pEma, piIn[i1]);
+	return iNum;
+	}
+
+/**
+	@brief int DspCicInit(DspCicFlt *pCic, int iOrder, int iDecim)
+			==========Initialises a decimating CIC filter.
+	@param pCic :{}	\n
+		State to initialise.
+	@param iOrder :{1-DSP_CIC_MAX}	\n
+		Number of integrator and comb stages. 1 for a boxcar average.
+	@param iDecim :{2-1024}	\n
+		Inputs per output. The nulls of the response fall at multiples of
+		the ADC rate/iDecim.
+	@return 1 if successful or 0 if a parameter is out of range.
+**/
+
+int DspCicInit(DspCicFlt *pCic, int iOrder, int iDecim)
+	{
+	int i1;
+
+	if((iOrder < 1) || (iOrder > DSP_CIC_MAX) || (iDecim < 2) || (iDecim > 1024))
+		return 0;
+	pCic->iOrder = iOrder;
+	pCic->iDecim = iDecim;
+	pCic->iCnt = 0;
+	pCic->llGain = 1;
+	for(i1=0; i1<iOrder; i1++)
+		{
+		pCic->llGain *= iDecim;
+		pCic->ullInt[i1] = 0;
+		pCic->ullComb[i1] = 0;
+		}
+	pCic->iShift = -1;
+	if((iDecim & (iDecim - 1)) == 0)
+		{
+		pCic->iShift = 0;
+		while((1ll << pCic->iShift) < pCic->llGain)
+			pCic->iShift++;
+		}
+	return 1;
+	}
+
+/**
+	@brief int DspCic(DspCicFlt *pCic, long lIn, long *plOut)
+			==========Adds one input to a CIC filter.
+	@param pCic :{}	\n
+		State from DspCicInit().
+	@param lIn :{}	\n
+		New input.
+	@param plOut :{}	\n
+		Output, written once every iDecim inputs.
+	@return 1 if an output was written, 0 otherwise.
+	@note The output is scaled back to the input range. With iOrder above 1
+		the first iOrder-1 outputs ramp up.
+**/
+
+int DspCic(DspCicFlt *pCic, long lIn, long *plOut)
+	{
+	unsigned long long ullVal = (unsigned long long)(long long)lIn;
+	unsigned long long ullTmp;
+	long long llOut;
+	int i1;
+
+	for(i1=0; i1<pCic->iOrder; i1++)
+		{
+		pCic->ullInt[i1] += ullVal;
+		ullVal = pCic->ullInt[i1];
+		}
+	if(++pCic->iCnt < pCic->iDecim)
+		return 0;
+	pCic->iCnt = 0;
+	for(i1=0; i1<pCic->iOrder; i1++)	// Combs run at the output rate
+		{
+		ullTmp = ullVal;
+		ullVal -= pCic->ullComb[i1];
+		pCic->ullComb[i1] = ullTmp;
+		}
+	llOut = (long long)ullVal;
+	if(pCic->iShift >= 0)
+		*plOut = (long)(llOut >> pCic->iShift);	// Rounded down
+	else
+		*plOut = (long)(llOut / pCic->llGain);		// Rounded toward 0
+	return 1;
+	}
+
+/**
+	@brief int DspCicBlk(DspCicFlt *pCic, const int *piIn, int iNum, long *plOut)
+			==========Adds a buffer of inputs to a CIC filter.
+	@param pCic :{}	\n
+		State from DspCicInit().
+	@param piIn :{}	\n
+		iNum inputs.
+	@param iNum :{0-}	\n
+		Number of inputs.
+	@param plOut :{}	\n
+		Outputs, room for iNum/iDecim+1. May be piIn to filter in place.
+	@return The number of outputs written.
+	@note Outputs carry on across buffers, iNum need not be a multiple of
+		iDecim.
+**/
+
+int DspCicBlk(DspCicFlt *pCic, const int *piIn, int iNum, long *plOut)
+	{
+	int iOut = 0;
+	int i1;
+
+	for(i1=0; i1<iNum; i1++)
+		iOut += DspCic(pCic, piIn[i1], &plOut[iOut]);
+	return iOut;
+	}
+
+/**
+	@brief int DspBqInit(DspBqFlt *pBq, long lB0, long lB1, long lB2, long lA1, long lA2)
+			==========Initialises a biquad IIR section.
+	@param pBq :{}	\n
+		State to initialise.
+	@param lB0 :{}	\n
+		Coefficients of y = b0.x + b1.x1 + b2.x2 - a1.y1 - a2.y2, with
+		DSP_BQ_Q fraction bits. Use DSP_BQ_COEF() for constants.
+	@param lB1 :{}
+	@param lB2 :{}
+	@param lA1 :{}
+	@param lA2 :{}
+	@return 1.
+	@note Cascade sections for higher orders, feeding the output of one to
+		the next.
+**/
+
+int DspBqInit(DspBqFlt *pBq, long lB0, long lB1, long lB2, long lA1, long lA2)
+	{
+	pBq->lB0 = lB0;
+	pBq->lB1 = lB1;
+	pBq->lB2 = lB2;
+	pBq->lA1 = lA1;
+	pBq->lA2 = lA2;
+	pBq->lX1 = 0;
+	pBq->lX2 = 0;
+	pBq->lY1 = 0;
+	pBq->lY2 = 0;
+	return 1;
+	}
+
+/**
+	@brief long DspBq(DspBqFlt *pBq, long lIn)
+			==========Adds one input to a biquad IIR section.
+	@param pBq :{}	\n
+		State from DspBqInit().
+	@param lIn :{}	\n
+		New input.
+	@return The output rounded to nearest.
+**/
+
+long DspBq(DspBqFlt *pBq, long lIn)
+	{
+	long long llAcc = 1ll << (DSP_BQ_Q-1);
+	long lOut;
+
+	llAcc += (long long)pBq->lB0 * lIn;
+	llAcc += (long long)pBq->lB1 * pBq->lX1;
+	llAcc += (long long)pBq->lB2 * pBq->lX2;
+	llAcc -= (long long)pBq->lA1 * pBq->lY1;
+	llAcc -= (long long)pBq->lA2 * pBq->lY2;
+	lOut = (long)(llAcc >> DSP_BQ_Q);
+	pBq->lX2 = pBq->lX1;
+	pBq->lX1 = lIn;
+	pBq->lY2 = pBq->lY1;
+	pBq->lY1 = lOut;
+	return lOut;
+	}
+
+/**
+	@brief int DspBqBlk(DspBqFlt *pBq, const int *piIn, long *plOut, int iNum)
+			==========Adds a buffer of inputs to a biquad IIR section.
+	@param pBq :{}	\n
+		State from DspBqInit().
+	@param piIn :{}	\n
+		iNum inputs.
+	@param plOut :{}	\n
+		iNum outputs, one per input. May be piIn to filter in place.
+	@param iNum :{0-}	\n
+		Number of inputs.
+	@return iNum.
+**/
+
+int DspBqBlk(DspBqFlt *pBq, const int *piIn, long *plOut, int iNum)
+	{
+	int i1;
+
+	for(i1=0; i1<iNum; i1++)
+		plOut[i1] = DspBq(pBq, piIn[i1]);
+	return iNum;
+	}
+
+/**@}*/
@@ -0,0 +1,89 @@
+/**
+ *****************************************************************************
+   @file     DspLib.h
+   @brief    Set of integer streaming filter functions for ADC results.
+   - Moving average over 2^n results with DspMaInit() and DspMa().
+   - Exponential average with DspEmaInit() and DspEma().
+   - Decimating CIC or boxcar filter with DspCicInit() and DspCic().
+   - Biquad IIR section with DspBqInit() and DspBq().
+   - Each filter keeps its state in its own structure, one per channel.
+     The *Blk() functions filter a DMA buffer, for example from the
+     AdcStreamStart() callback.
+
+   @version  V0.1
+   @author   ADI
+   @date     October 2026
+   @par Revision History:
+   - V0.1, October 2026: initial version.
+
+
+
+All files for ADuCM360 provided by ADI, including this file, are
+provided  as is without warranty of any kind, either expressed or implied.
+The user assumes any and all risk from the use of this code.
+It is the responsibility of the person integrating this code into an application
+to ensure that the resulting application performs as required and is safe.
+
+**/
+#ifndef DSPLIB_H
+#define DSPLIB_H
+
+// Fraction bits of the biquad coefficients, which range from -4 to 4
+#define DSP_BQ_Q		29
+
+// Biquad coefficient from a constant, for example DSP_BQ_COEF(-1.8)
+#define DSP_BQ_COEF(x)	((long)((x)*(double)(1L<<DSP_BQ_Q) + (((x) < 0) ? -0.5 : 0.5)))
+
+// Moving average state
+typedef struct
+{
+   long *plHist;                 // Last 2^iLog2 inputs
+   long long llSum;              // Sum of plHist
+   int iLog2;                    // Length is 2^iLog2
+   int iPos;                     // Oldest input in plHist
+} DspMaFlt;
+
+// Exponential average state
+typedef struct
+{
+   long long llAcc;              // Output scaled by 2^iShift
+   int iShift;                   // Time constant of 2^iShift inputs
+   int iPrimed;                  // 0 until the first input
+} DspEmaFlt;
+
+// CIC decimator state, order 1 is a boxcar average of iDecim inputs
+#define DSP_CIC_MAX		3		// Highest order
+typedef struct
+{
+   unsigned long long ullInt[DSP_CIC_MAX];	// Integrators, wrap around on purpose
+   unsigned long long ullComb[DSP_CIC_MAX];	// Last integrator output seen by each comb
+   long long llGain;             // iDecim^iOrder
+   int iShift;                   // log2 of llGain, -1 if not a power of two
+   int iOrder;                   // 1 to DSP_CIC_MAX
+   int iDecim;                   // Inputs per output
+   int iCnt;                     // Inputs since the last output
+} DspCicFlt;
+
+// Biquad IIR section, direct form I
+typedef struct
+{
+   long lB0, lB1, lB2;           // Feed forward coefficients, DSP_BQ_Q fraction bits
+   long lA1, lA2;                // Feedback coefficients with a0 = 1, same format
+   long lX1, lX2;                // Last two inputs
+   long lY1, lY2;                // Last two outputs
+} DspBqFlt;
+
+extern int DspMaInit(DspMaFlt *pMa, long *plHist, int iLog2);
+extern long DspMa(DspMaFlt *pMa, long lIn);
+extern int DspMaBlk(DspMaFlt *pMa, const int *piIn, long *plOut, int iNum);
+extern int DspEmaInit(DspEmaFlt *pEma, int iShift);
+extern long DspEma(DspEmaFlt *pEma, long lIn);
+extern int DspEmaBlk(DspEmaFlt *pEma, const int *piIn, long *plOut, int iNum);
+extern int DspCicInit(DspCicFlt *pCic, int iOrder, int iDecim);
+extern int DspCic(DspCicFlt *pCic, long lIn, long *plOut);
+extern int DspCicBlk(DspCicFlt *pCic, const int *piIn, int iNum, long *plOut);
+extern int DspBqInit(DspBqFlt *pBq, long lB0, long lB1, long lB2, long lA1, long lA2);
+extern long DspBq(DspBqFlt *pBq, long lIn);
+extern int DspBqBlk(DspBqFlt *pBq, const int *piIn, long *plOut, int iNum);
+
+#endif
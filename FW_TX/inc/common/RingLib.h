@@ -0,0 +1,46 @@
+/**
+ *****************************************************************************
+   @file     RingLib.h
+   @brief    Set of single-producer/single-consumer byte ring buffer functions.
+   - Initialise a ring over caller supplied storage with RingInit().
+   - Producer side: RingPut(), RingWr(), RingFree().
+   - Consumer side: RingGet(), RingRd(), RingCnt(), RingFlush().
+
+   @version  V0.1
+   @author   ADI
+   @date     October 2026
+   @par Revision History:
+   - V0.1, October 2026: initial version.
+
+
+
+All files for ADuCM360 provided by ADI, including this file, are
+provided  as is without warranty of any kind, either expressed or implied.
+The user assumes any and all risk from the use of this code.
+It is the responsibility of the person integrating this code into an application
+to ensure that the resulting application performs as required and is safe.
+
+**/
+#ifndef RINGLIB_H
+#define RINGLIB_H
+
+// Ring control block. uiHead is only written by the producer and uiTail only
+// by the consumer, so one side may run in an interrupt without locking.
+typedef struct
+{
+   volatile unsigned char  *pucBuf;     // Storage, uiMask+1 bytes
+   unsigned int             uiMask;     // Size-1, size must be a power of two
+   volatile unsigned int    uiHead;     // Free running write index
+   volatile unsigned int    uiTail;     // Free running read index
+} RingBuf;
+
+extern int RingInit(RingBuf *pRing, unsigned char *pucBuf, int iSize);
+extern int RingPut(RingBuf *pRing, int iByte);
+extern int RingGet(RingBuf *pRing);
+extern int RingWr(RingBuf *pRing, const unsigned char *pucData, int iLen);
+extern int RingRd(RingBuf *pRing, unsigned char *pucData, int iLen);
+extern int RingCnt(RingBuf *pRing);
+extern int RingFree(RingBuf *pRing);
+extern int RingFlush(RingBuf *pRing);
+
+#endif
@@ -3,18 +3,60 @@
    @file     UrtLib.h
    @brief    Set of UART peripheral functions.
    - Configure the UART pins by setting the mux options in GPCON
-   - Configure UART with UrtCfg().
+   - Configure UART with UrtCfg(). Check the baud rate achieved with UrtBaudRd().
+   - For a fixed clock setup UrtCfgDiv() takes dividers from URT_COMDIV() and
+     URT_COMFBR() worked out at compile time.
    - Set modem control with UrtMod() if desired.
    - Check space in Tx buffer with UrtLinSta().
    - Output character with UrtTx().
    - Read characters with UrtRx().
+   - For interrupt driven buffered operation attach rings with UrtBufCfg(),
+     queue with UrtBufWr(), read with UrtBufRd() and call UrtBufInt() from
+     UART_Int_Handler(). UrtBufRxFn() hands received bytes to a function
+     instead, for example a COBS decoder.
+   - For RTS/CTS hardware flow control call UrtFlowCfg() and UrtBufInt() from
+     UART_Int_Handler().
+   - Read line error counts with UrtErrRd(). UrtBufRdErr() and
+     UrtRxDmaRdErr() flag each damaged byte read.
+   - For DMA transmission start a block with UrtTxDma() and call UrtTxDmaInt()
+     from DMA_UART_TX_Int_Handler().
+   - For continuous DMA reception start with UrtRxDmaCfg(), read with
+     UrtRxDmaRd() and call UrtRxDmaInt() from DMA_UART_RX_Int_Handler().
+   - To hand short frames over after a gap on the line start a timer with
+     UrtRxIdleCfg() and call UrtRxIdleInt() from GP_Tmr0_Int_Handler() or
+     GP_Tmr1_Int_Handler(). UrtRxStartFn() adds a function raised when a
+     frame starts, for example to timestamp it. The timer stops while the
+     line is idle, UrtBufInt() restarts it from UART_Int_Handler().
    
-   @version  V0.2
+   @version  V0.16
    @author   ADI
-   @date     October 2012
+   @date     October 2026
    @par Revision History:
    - V0.1, March 2012: initial version. 
    - V0.2, October 2012: Fixed Baud rate generation function
+   - V0.4, October 2026: Added interrupt driven ring buffered transfers.
+   - V0.5, October 2026: Added DMA transmit with completion callback.
+   - V0.6, October 2026: Added continuous ping-pong DMA receive.
+   - V0.7, October 2026: Added idle line detection for DMA receive.
+   - V0.8, October 2026: UrtCfg() searches COMDIV, DIVM and DIVN for the
+     lowest baud rate error at the actual UART clock. Added UrtBaudCalc(),
+     UrtBaudRd() and UrtCfgDiv().
+   - V0.9, October 2026: Added UrtBufRxFn() to decode received bytes in the
+     interrupt.
+   - V0.10, October 2026: Added RTS/CTS flow control with UrtFlowCfg().
+   - V0.11, October 2026: UrtBufInt() counts and flags line errors, added
+     UrtErrRd().
+   - V0.12, October 2026: Added UrtRxStartFn() for the start of idle line
+     frames.
+   - V0.13, October 2026: UrtBufWr() starts the transmitter with interrupts
+     masked, the CTS edge could start it at the same time.
+   - V0.14, October 2026: Keeps the positions of up to URT_ERR_MAX damaged
+     bytes, flagged by UrtBufRdErr() and UrtRxDmaRdErr().
+   - V0.15, October 2026: The UART DMA channels are enabled with DmaSet(),
+     so DmaErrInt() re-arms them after a bus error. DmaLib.c is needed.
+   - V0.16, October 2026: The idle line timer stops once a frame is handed
+     over and the first byte of the next one restarts it, no interrupts
+     while the line is idle.
  
 
 
@@ -26,9 +68,38 @@ to ensure that the resulting application performs as required and is safe.
 
 **/
 
+#ifndef URTLIB_H
+#define URTLIB_H
+
 #include <ADuCM360.h>
+#include "RingLib.h"
+
+// Line error counts kept by UrtBufInt(), read with UrtErrRd()
+typedef struct
+{
+   unsigned int   uiOe;      // Overrun, a byte was lost before it was read
+   unsigned int   uiPe;      // Parity error
+   unsigned int   uiFe;      // Framing error, no valid stop bit
+   unsigned int   uiBi;      // Break condition
+   unsigned int   uiFull;    // Bytes dropped because the receive ring was full
+   unsigned int   uiUnflg;   // Errors not flagged, URT_ERR_MAX were waiting to be read
+   unsigned int   uiPos;     // Receive index of the last byte with an error only
+} UrtErr;
+
+// Damaged bytes kept for UrtBufRdErr() and UrtRxDmaRdErr() until read
+#ifndef URT_ERR_MAX
+#define URT_ERR_MAX	8
+#endif
+
+// Bytes passed to the UrtBufRxFn() function carry the COMLSR error bits of
+// a damaged byte in bits 8-15, so any value above 0xFF is a flagged byte.
+#define URT_RX_ERR(iByte)	((iByte) >> 8)
 
 extern int UrtCfg(ADI_UART_TypeDef *pPort, int iBaud, int iBits, int iFormat);
+extern int UrtCfgDiv(ADI_UART_TypeDef *pPort, int iDiv, int iFbr, int iBits, int iFormat);
+extern int UrtClk(void);
+extern int UrtBaudCalc(int iClk, int iBaud, int *piDiv, int *piFbr);
+extern int UrtBaudRd(ADI_UART_TypeDef *pPort, int iBaud, int *piPpm);
 extern int UrtBrk(ADI_UART_TypeDef *pPort, int iBrk);
 extern int UrtLinSta(ADI_UART_TypeDef *pPort);
 extern int UrtTx(ADI_UART_TypeDef *pPort, int iTx);
@@ -39,6 +110,31 @@ extern int UrtDma(ADI_UART_TypeDef *pPort, int iDmaSel);
 extern int UrtIntCfg(ADI_UART_TypeDef *pPort, int iIrq);
 extern int UrtIntSta(ADI_UART_TypeDef *pPort);
 
+extern int UrtBufCfg(ADI_UART_TypeDef *pPort, RingBuf *pTxRing, RingBuf *pRxRing);
+extern int UrtFlowCfg(ADI_UART_TypeDef *pPort, int iHigh, int iLow);
+extern int UrtBufRxFn(ADI_UART_TypeDef *pPort, void (*pfRx)(int iByte));
+extern int UrtBufWr(ADI_UART_TypeDef *pPort, const unsigned char *pucData, int iLen);
+extern int UrtBufRd(ADI_UART_TypeDef *pPort, unsigned char *pucData, int iLen);
+extern int UrtBufRdErr(ADI_UART_TypeDef *pPort, unsigned char *pucData, unsigned char *pucErr, int iLen);
+extern int UrtBufRxCnt(ADI_UART_TypeDef *pPort);
+extern int UrtBufTxCnt(ADI_UART_TypeDef *pPort);
+extern int UrtBufInt(ADI_UART_TypeDef *pPort);
+extern int UrtErrRd(ADI_UART_TypeDef *pPort, UrtErr *pErr, int iClr);
+
+extern int UrtTxDma(ADI_UART_TypeDef *pPort, const unsigned char *pucBuf, int iLen, void (*pfCallback)(void));
+extern int UrtTxDmaBusy(ADI_UART_TypeDef *pPort);
+extern int UrtTxDmaInt(ADI_UART_TypeDef *pPort);
+
+extern int UrtRxDmaCfg(ADI_UART_TypeDef *pPort, unsigned char *pucBuf, int iSize);
+extern int UrtRxDmaCnt(ADI_UART_TypeDef *pPort);
+extern int UrtRxDmaRd(ADI_UART_TypeDef *pPort, unsigned char *pucData, int iLen);
+extern int UrtRxDmaRdErr(ADI_UART_TypeDef *pPort, unsigned char *pucData, unsigned char *pucErr, int iLen);
+extern int UrtRxDmaInt(ADI_UART_TypeDef *pPort);
+
+extern int UrtRxIdleCfg(ADI_UART_TypeDef *pPort, ADI_TIMER_TypeDef *pTMR, int iBaud, int iChars, void (*pfCallback)(int iLen));
+extern int UrtRxStartFn(ADI_UART_TypeDef *pPort, void (*pfStart)(void));
+extern int UrtRxIdleInt(ADI_UART_TypeDef *pPort);
+
 
 // baud rate settings
 #define B1200	1200
@@ -52,3 +148,14 @@ extern int UrtIntSta(ADI_UART_TypeDef *pPort);
 #define B115200	115200
 #define B230400	230400
 #define B430800	430800
+#define B460800	460800
+
+// Compile time dividers for UrtCfgDiv() where the UART clock is fixed, for
+// example UrtCfgDiv(pADI_UART,URT_COMDIV(16000000,B460800),URT_COMFBR(16000000,B460800),...).
+// Uses the smallest COMDIV, so the error is at most 0.5/(DIVM*2048+DIVN): below
+// 125ppm whenever COMDIV>1 and below 250ppm up to clk/32, the fastest rate
+// possible. UrtCfg() may find a closer pair at run time.
+#define URT_COMDIV(clk,baud)	((((clk)*64UL/(baud)+8190)/8191) ? (((clk)*64UL/(baud)+8190)/8191) : 1)
+#define URT_COMFBR(clk,baud)	(0x8000|(((clk)*64UL+(baud)*URT_COMDIV(clk,baud)/2)/((baud)*URT_COMDIV(clk,baud))))
+
+#endif
@@ -10,15 +10,23 @@
 #include <UrtLib.h>
 #include <IntLib.h>
 #include <GptLib.h>
+#include <CobsLib.h>
+#include <ArqLib.h>
 
 #define TRUE		1
 #define FALSE		0
 
-volatile uint8_t ucTxBufferEmpty  = 0; // Used to indicate that the UART Tx buffer is empty
-volatile uint8_t ucRxBufferFull  = 0; // Used to indicate that the UART Rx buffer is full
+#define UART_TX_RING_SIZE	256	// Must be a power of two
+#define FRAME_SIZE			(ARQ_MAX+4)	// ARQ header, payload and CRC
+#define ARQ_TIMEOUT_MS		2000	// Longer than a full frame and its ACK at 1200 baud
 
-volatile uint8_t ucCOMIID0 = 0;
-volatile uint8_t ucComRx = 0;
+uint8_t ucTxRingBuf[UART_TX_RING_SIZE];	// Storage for the UART transmit ring
+RingBuf UartTxRing;						// Drained by the THRE interrupt
+uint8_t ucFrame[2][FRAME_SIZE];			// One frame decodes while main reads the other
+uint8_t *pucRxFrame;					// Frame handed to main
+CobsDec FrameDec;						// Fed by the receive interrupt
+volatile int iFrameLen = 0;				// Length of *pucRxFrame, 0 once main has read it
+ArqLink Link;							// Keeps up to ARQ_WIN frames in flight to FW_RX
 
 uint32_t dly_cnt = 0;
 
@@ -36,7 +44,7 @@ void WatchDogInit(void){
 
 void ClockInit(void){
 	//---------- Disable clock to unused peripherals ----------
-   ClkDis(CLKDIS_DISSPI0CLK|CLKDIS_DISSPI1CLK|CLKDIS_DISI2CCLK|CLKDIS_DISPWMCLK|CLKDIS_DIST0CLK|CLKDIS_DIST1CLK);
+   ClkDis(CLKDIS_DISSPI0CLK|CLKDIS_DISSPI1CLK|CLKDIS_DISI2CCLK|CLKDIS_DISPWMCLK|CLKDIS_DIST1CLK);   // T0 ticks the ARQ timers
 
    // Select CD0 for CPU clock - 2Mhz clock
    ClkCfg(CLK_CD2,CLK_HF,CLKSYSDIV_DIV2EN_EN,CLK_UDIV);   
@@ -58,11 +66,29 @@ void GPIOInit(void){
    DioPul(pADI_GP2, 0x00);
 }
 
+void FrameDone(int len){
+   if(iFrameLen)
+      return;									// Main still busy, drop it and let ARQ resend
+   pucRxFrame = FrameDec.pucBuf;				// Swap buffers instead of copying
+   CobsDecInit(&FrameDec, (pucRxFrame == ucFrame[0]) ? ucFrame[1] : ucFrame[0], FRAME_SIZE);
+   iFrameLen = len;
+}
+
+void RxByte(int ch){
+   int len = CobsDecPut(&FrameDec, ch);		// Decoded into ucFrame as it arrives
+
+   if(len > 0)
+      FrameDone(len);
+}
+
 void UARTInit(void){
    //Select IO pins for UART.
    UrtCfg(pADI_UART,B1200,COMLCR_WLS_8BITS,COMLCR_PEN_EN);  // setup baud rate for 9600, 8-bits
    UrtMod(pADI_UART,COMMCR_DTR,0);              			// Setup modem bits
-   UrtIntCfg(pADI_UART,COMIEN_ERBFI|COMIEN_ETBEI);  		// Setup UART IRQ sources
+   RingInit(&UartTxRing, ucTxRingBuf, UART_TX_RING_SIZE);
+   UrtBufCfg(pADI_UART,&UartTxRing,0);  		// Setup UART IRQ sources and Tx ring
+   CobsDecInit(&FrameDec, ucFrame[0], FRAME_SIZE);
+   UrtBufRxFn(pADI_UART,RxByte);  				// Decode received bytes in the interrupt
 }
 
 void TIMER0_Init(void){
@@ -84,76 +110,45 @@ void Chip_Initialize(){
    NVIC_EnableIRQ(UART_IRQn);
 }
 
-void SendChar(uint8_t ch){
-	ucTxBufferEmpty = 0;
-    UrtTx(pADI_UART, ch);
-    while (ucTxBufferEmpty == 0) {};
-}
-
-void SendMsg(uint8_t *str){
-	uint16_t len =0 , i;
-
-	len = strlen((char*)str);
-	for(i=0; i<len; i++){
-		SendChar(str[i]);
-	}
-}
+void SendBlk(const uint8_t *data, int len){
+	int i = 0;
 
-uint8_t* ReadMsg(void){
-	uint8_t cnt = 0;
-	static uint8_t str[20] = "";
-	while(TRUE){
-		if(ucRxBufferFull){
-			str[cnt++] = ucComRx;
-			ucRxBufferFull = FALSE;
-			if(ucComRx == 0xff)
-				break;
-		}
+	while(i < len){
+		i += UrtBufWr(pADI_UART, &data[i], len - i);	// Only waits while the Tx ring is full
 	}
-	return str;
 }
 
 int main(){
-	//uint8_t data[10]={0x01,0x02,0x03,0x04,0x05,0x06,0x07,0x08,0x09,0xff};
-	//uint8_t sendFlag = FALSE;
-	volatile int i;
+	uint8_t data[ARQ_MAX];
+	uint8_t seq = 0;
+	int i;
+
    	Chip_Initialize();
-    while(TRUE){
-        DioClr(pADI_GP0,BIT5);
-        delay_ms(1000);
-        //for(i=0; i< 5000; i++);
-        DioSet(pADI_GP0,BIT5);
-        //for(i=0; i< 5000; i++);
-        delay_ms(1000);
-	}
- /*  	while(TRUE){
-		if(!sendFlag){
-			DioClr(pADI_GP0,PIN5);
-			SendMsg(data);
-			sendFlag = TRUE;
-			DioSet(pADI_GP0,PIN5);
+	ArqInit(&Link, SendBlk, 0, ARQ_TIMEOUT_MS);
+	for(i=0; i<ARQ_MAX; i++)
+		data[i] = i;
+	while(TRUE){
+		if(iFrameLen){
+			ArqRx(&Link, pucRxFrame, iFrameLen);	// ACKs move the window on
+			iFrameLen = 0;						// Buffer free for the next frame
 		}
-		if(ucRxBufferFull){
-			ReadMsg();
-			sendFlag = FALSE;
-			ucRxBufferFull = FALSE;
+		ArqPoll(&Link);							// Resends the window on timeout
+		data[0] = seq;
+		if(ArqSend(&Link, data, ARQ_MAX))		// Returns 0 while the window is full
+			seq++;
+		if(dly_cnt >= 1000){
+			dly_cnt = 0;
+			DioTgl(pADI_GP0,BIT5);
 		}
-		delay_ms(1000);
-   	}*/
+	}
 }
 void UART_Int_Handler(){
-	ucCOMIID0 = UrtIntSta(pADI_UART);   	// Read UART Interrupt ID register
-   	if ((ucCOMIID0 & 0x7) == 0x2){       	// Transmit buffer empty
-   		ucTxBufferEmpty = TRUE;
-   	}
-   	if ((ucCOMIID0 & 0x7) == 0x4){       	// Receive byte
-   		ucComRx = UrtRx(pADI_UART);
-   		ucRxBufferFull = TRUE;
-   	}
+	UrtBufInt(pADI_UART);					// Feed COMTX and pass received bytes to RxByte()
 }
 
 void GP_Tmr0_Int_Handler(void){
    // Timer0 Interrupt : 1msec
    GptClrInt(pADI_TM0, TSTA_TMOUT);
    dly_cnt++;
+   ArqTick(&Link);
 }
\ No newline at end of file